@@ -762,6 +762,26 @@ namespace dawn::wire {
 
     }  // anonymous namespace
 
+    const char* GetWireCmdName(WireCmd command) {
+        switch (command) {
+            {% for command in cmd_records["command"] %}
+                case WireCmd::{{command.name.CamelCase()}}:
+                    return "{{command.name.CamelCase()}}";
+            {% endfor %}
+        }
+        return nullptr;
+    }
+
+    const char* GetReturnWireCmdName(ReturnWireCmd command) {
+        switch (command) {
+            {% for command in cmd_records["return command"] %}
+                case ReturnWireCmd::{{command.name.CamelCase()}}:
+                    return "{{command.name.CamelCase()}}";
+            {% endfor %}
+        }
+        return nullptr;
+    }
+
     {% for command in cmd_records["command"] %}
         {{ write_command_serialization_methods(command, False) }}
     {% endfor %}
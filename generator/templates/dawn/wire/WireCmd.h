@@ -56,6 +56,7 @@ namespace dawn::wire {
             {{command.name.CamelCase()}},
         {% endfor %}
     };
+    constexpr size_t kWireCmdCount = {{cmd_records["command"] | length}};
 
     //* Enum used as a prefix to each command on the return wire format.
     enum class ReturnWireCmd : uint32_t {
@@ -64,6 +65,10 @@ namespace dawn::wire {
         {% endfor %}
     };
 
+    //* Returns the name of a command, or nullptr if it isn't a valid command. Used for profiling.
+    const char* GetWireCmdName(WireCmd command);
+    const char* GetReturnWireCmdName(ReturnWireCmd command);
+
     struct CmdHeader {
         uint64_t commandSize;
     };
@@ -88,6 +88,17 @@ namespace dawn::wire::server {
         }
     {% endfor %}
 
+    bool Server::HandleCommand(WireCmd cmdId, DeserializeBuffer* deserializeBuffer) {
+        switch (cmdId) {
+            {% for command in cmd_records["command"] %}
+                case WireCmd::{{command.name.CamelCase()}}:
+                    return Handle{{command.name.CamelCase()}}(deserializeBuffer);
+            {% endfor %}
+            default:
+                return false;
+        }
+    }
+
     const volatile char* Server::HandleCommandsImpl(const volatile char* commands, size_t size) {
         DeserializeBuffer deserializeBuffer(commands, size);
 
@@ -105,15 +116,11 @@ namespace dawn::wire::server {
 
             WireCmd cmdId = *static_cast<const volatile WireCmd*>(static_cast<const volatile void*>(
                 deserializeBuffer.Buffer() + sizeof(CmdHeader)));
-            bool success = false;
-            switch (cmdId) {
-                {% for command in cmd_records["command"] %}
-                    case WireCmd::{{command.name.CamelCase()}}:
-                        success = Handle{{command.name.CamelCase()}}(&deserializeBuffer);
-                        break;
-                {% endfor %}
-                default:
-                    success = false;
+            bool success;
+            if (DAWN_UNLIKELY(IsCommandProfilingEnabled())) {
+                success = HandleCommandWithProfiling(cmdId, &deserializeBuffer);
+            } else {
+                success = HandleCommand(cmdId, &deserializeBuffer);
             }
 
             if (!success) {
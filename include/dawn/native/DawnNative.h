@@ -183,6 +183,17 @@ DAWN_NATIVE_EXPORT const DawnProcTable& GetProcs();
 // Query the names of all the toggles that are enabled in device
 DAWN_NATIVE_EXPORT std::vector<const char*> GetTogglesUsed(WGPUDevice device);
 
+// Shader modules keep the parsed Tint program of their shader to compile pipelines from it.
+// Limits how many modules of the device keep it in memory: the programs of the least recently used
+// modules over the budget are released, and parsed again if they are needed later. There is no
+// limit by default.
+DAWN_NATIVE_EXPORT void SetTintProgramResidencyBudget(WGPUDevice device,
+                                                      size_t maxResidentPrograms);
+
+// Returns the number of shader modules of the device with a resident / evicted Tint program.
+DAWN_NATIVE_EXPORT size_t GetResidentTintProgramCount(WGPUDevice device);
+DAWN_NATIVE_EXPORT size_t GetEvictedTintProgramCount(WGPUDevice device);
+
 // Backdoor to get the number of lazy clears for testing
 DAWN_NATIVE_EXPORT size_t GetLazyClearCountForTesting(WGPUDevice device);
 
@@ -65,12 +65,24 @@ class DAWN_PLATFORM_EXPORT WaitableEvent {
 
 using PostWorkerTaskCallback = void (*)(void* userdata);
 
+// Tasks with a higher priority are run before the queued tasks with a lower priority.
+enum class WorkerTaskPriority : uint8_t {
+    High = 0,    // Work the application is actively waiting on (e.g. async pipeline creation).
+    Normal = 1,  // Default priority of PostWorkerTask().
+    Low = 2,     // Background work like cache warming.
+};
+
 class DAWN_PLATFORM_EXPORT WorkerTaskPool {
   public:
     WorkerTaskPool() = default;
     virtual ~WorkerTaskPool() = default;
     virtual std::unique_ptr<WaitableEvent> PostWorkerTask(PostWorkerTaskCallback,
                                                           void* userdata) = 0;
+    // The default implementation ignores the priority and calls PostWorkerTask().
+    virtual std::unique_ptr<WaitableEvent> PostWorkerTaskWithPriority(
+        PostWorkerTaskCallback callback,
+        void* userdata,
+        WorkerTaskPriority priority);
 };
 
 class DAWN_PLATFORM_EXPORT Platform {
@@ -105,6 +105,16 @@ class DAWN_WIRE_EXPORT MemoryTransferService {
     // This may fail and return nullptr.
     virtual WriteHandle* CreateWriteHandle(size_t) = 0;
 
+    // Create a handle to send the payload of a Queue::WriteBuffer or Queue::WriteTexture by
+    // reference instead of copying it in the command. The data of the handle doesn't need to be
+    // zero-initialized since it is entirely overwritten.
+    // Returns nullptr to send the payload in the command, which is the default.
+    virtual WriteHandle* CreateQueueWriteHandle(size_t size);
+
+    // Called when the client is disconnected. The server won't deserialize any of the handles
+    // that it didn't process yet, nor any later handle.
+    virtual void OnDisconnect();
+
     class DAWN_WIRE_EXPORT ReadHandle {
       public:
         ReadHandle();
@@ -54,6 +54,19 @@ void RefCount::Increment() {
     mRefCount.fetch_add(kRefCountIncrement, std::memory_order_relaxed);
 }
 
+bool RefCount::TryIncrement() {
+    // Relaxed ordering is enough for the same reason as in Increment(): the caller guarantees by
+    // other means (typically a lock) that the memory isn't freed while we look at it.
+    uint64_t current = mRefCount.load(std::memory_order_relaxed);
+    do {
+        if ((current & ~kPayloadMask) == 0) {
+            return false;
+        }
+    } while (!mRefCount.compare_exchange_weak(current, current + kRefCountIncrement,
+                                              std::memory_order_relaxed));
+    return true;
+}
+
 bool RefCount::Decrement() {
     ASSERT((mRefCount & ~kPayloadMask) != 0);
 
@@ -102,6 +115,10 @@ void RefCounted::Reference() {
     mRefCount.Increment();
 }
 
+bool RefCounted::TryReference() {
+    return mRefCount.TryIncrement();
+}
+
 void RefCounted::Release() {
     if (mRefCount.Decrement()) {
         DeleteThis();
@@ -30,6 +30,9 @@ class RefCount {
 
     // Add a reference.
     void Increment();
+    // Add a reference only if the refcount hasn't already dropped to zero. Returns false if the
+    // object is already being destroyed.
+    bool TryIncrement();
 
     // Remove a reference. Returns true if this was the last reference.
     bool Decrement();
@@ -46,6 +49,10 @@ class RefCounted {
     uint64_t GetRefCountPayload() const;
 
     void Reference();
+    // Like Reference(), but fails instead of resurrecting an object whose last reference is
+    // already gone. Only useful when the object is still reachable from a weak cache whose lock
+    // prevents the memory from being freed concurrently.
+    bool TryReference();
     // Release() is called by internal code, so it's assumed that there is already a thread
     // synchronization in place for destruction.
     void Release();
@@ -23,7 +23,7 @@ namespace dawn::native {
 AsyncTaskManager::AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPool)
     : mWorkerTaskPool(workerTaskPool) {}
 
-void AsyncTaskManager::PostTask(AsyncTask asyncTask) {
+void AsyncTaskManager::PostTask(AsyncTask asyncTask, dawn::platform::WorkerTaskPriority priority) {
     // If these allocations becomes expensive, we can slab-allocate tasks.
     Ref<WaitableTask> waitableTask = AcquireRef(new WaitableTask());
     waitableTask->taskManager = this;
@@ -42,7 +42,7 @@ void AsyncTaskManager::PostTask(AsyncTask asyncTask) {
     // The worker function will acquire and release the task upon completion.
     waitableTask->Reference();
     waitableTask->waitableEvent =
-        mWorkerTaskPool->PostWorkerTask(DoWaitableTask, waitableTask.Get());
+        mWorkerTaskPool->PostWorkerTaskWithPriority(DoWaitableTask, waitableTask.Get(), priority);
 }
 
 void AsyncTaskManager::HandleTaskCompletion(WaitableTask* task) {
@@ -508,6 +508,10 @@ const ityp::span<uint32_t, uint64_t>& BindGroupBase::GetUnverifiedBufferSizes()
     return mBindingData.unverifiedBufferSizes;
 }
 
+uint64_t BindGroupBase::GetValidationCacheId() const {
+    return mValidationCacheId;
+}
+
 BufferBinding BindGroupBase::GetBindingAsBufferBinding(BindingIndex bindingIndex) {
     ASSERT(!IsError());
     ASSERT(bindingIndex < mLayout->GetBindingCount());
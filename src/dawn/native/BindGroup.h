@@ -20,6 +20,7 @@
 
 #include "dawn/common/Constants.h"
 #include "dawn/common/Math.h"
+#include "dawn/native/BindGroupValidationCache.h"
 #include "dawn/native/BindGroupLayout.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/Forward.h"
@@ -54,6 +55,7 @@ class BindGroupBase : public ApiObjectBase {
     SamplerBase* GetBindingAsSampler(BindingIndex bindingIndex) const;
     TextureViewBase* GetBindingAsTextureView(BindingIndex bindingIndex);
     const ityp::span<uint32_t, uint64_t>& GetUnverifiedBufferSizes() const;
+    uint64_t GetValidationCacheId() const;
     const std::vector<Ref<ExternalTextureBase>>& GetBoundExternalTextures() const;
 
     void ForEachUnverifiedBufferBindingIndex(std::function<void(BindingIndex, uint32_t)> fn) const;
@@ -92,6 +94,8 @@ class BindGroupBase : public ApiObjectBase {
     // TODO(dawn:1293): Store external textures in
     // BindGroupLayoutBase::BindingDataPointers::bindings
     std::vector<Ref<ExternalTextureBase>> mBoundExternalTextures;
+
+    const uint64_t mValidationCacheId = AcquireValidationCacheId();
 };
 
 }  // namespace dawn::native
@@ -0,0 +1,65 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/BindGroupValidationCache.h"
+
+#include <atomic>
+
+#include "dawn/common/HashUtils.h"
+
+namespace dawn::native {
+
+uint64_t AcquireValidationCacheId() {
+    static std::atomic<uint64_t> sNextId{1};
+    return sNextId.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool BindGroupValidationCache::Key::operator==(const Key& other) const {
+    return pipelineId == other.pipelineId && bindGroupIds == other.bindGroupIds;
+}
+
+size_t BindGroupValidationCache::Key::HashFunc::operator()(const Key& key) const {
+    size_t hash = 0;
+    HashCombine(&hash, key.pipelineId);
+    for (uint64_t id : key.bindGroupIds) {
+        HashCombine(&hash, id);
+    }
+    return hash;
+}
+
+BindGroupValidationCache::BindGroupValidationCache() = default;
+
+BindGroupValidationCache::~BindGroupValidationCache() = default;
+
+bool BindGroupValidationCache::Contains(const Key& key) const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mValidatedKeys.count(key) != 0;
+}
+
+void BindGroupValidationCache::Insert(const Key& key) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    // The entries of destroyed objects are never hit again, start over instead of tracking
+    // which entries are still useful.
+    if (mValidatedKeys.size() >= kMaxEntries) {
+        mValidatedKeys.clear();
+    }
+    mValidatedKeys.insert(key);
+}
+
+size_t BindGroupValidationCache::GetEntryCountForTesting() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mValidatedKeys.size();
+}
+
+}  // namespace dawn::native
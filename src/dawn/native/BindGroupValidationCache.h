@@ -0,0 +1,69 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_NATIVE_BINDGROUPVALIDATIONCACHE_H_
+#define SRC_DAWN_NATIVE_BINDGROUPVALIDATIONCACHE_H_
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+
+#include "dawn/common/Constants.h"
+
+namespace dawn::native {
+
+// Returns an id for a pipeline or a bind group that is never reused, unlike its address.
+uint64_t AcquireValidationCacheId();
+
+// Remembers which pipelines and bind groups were validated to be compatible by the
+// CommandBufferStateTracker, so that it can skip the validation when the same combination is set
+// again, for example in each frame. Pipelines and bind groups are immutable so the result only
+// depends on their identity, except for the aliasing of writable storage buffers that depends on
+// the dynamic offsets: bind groups with dynamic storage buffers are never cached.
+//
+// Objects are identified by their validation cache id so that the entries of destroyed objects
+// can't match new objects. They are only removed when the cache is full.
+class BindGroupValidationCache {
+  public:
+    struct Key {
+        uint64_t pipelineId = 0;
+        // The ids of the bind groups used by the pipeline layout, 0 for the other groups.
+        std::array<uint64_t, kMaxBindGroups> bindGroupIds = {};
+
+        bool operator==(const Key& other) const;
+
+        struct HashFunc {
+            size_t operator()(const Key& key) const;
+        };
+    };
+
+    BindGroupValidationCache();
+    ~BindGroupValidationCache();
+
+    bool Contains(const Key& key) const;
+    void Insert(const Key& key);
+
+    size_t GetEntryCountForTesting() const;
+
+  private:
+    static constexpr size_t kMaxEntries = 16384;
+
+    mutable std::mutex mMutex;
+    std::unordered_set<Key, Key::HashFunc> mValidatedKeys;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_BINDGROUPVALIDATIONCACHE_H_
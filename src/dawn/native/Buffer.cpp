@@ -641,6 +641,10 @@ void BufferBase::MarkUsedInPendingCommands() {
     mLastUsageSerial = serial;
 }
 
+UsageTrackingSlot* BufferBase::GetUsageTrackingSlot() {
+    return &mUsageTrackingSlot;
+}
+
 bool BufferBase::IsFullBufferRange(uint64_t offset, uint64_t size) const {
     return offset == 0 && size == GetSize();
 }
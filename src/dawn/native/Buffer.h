@@ -24,6 +24,7 @@
 #include "dawn/native/Forward.h"
 #include "dawn/native/IntegerTypes.h"
 #include "dawn/native/ObjectBase.h"
+#include "dawn/native/PassResourceUsage.h"
 
 #include "dawn/native/dawn_platform.h"
 
@@ -75,6 +76,7 @@ class BufferBase : public ApiObjectBase {
     bool IsDataInitialized() const;
     void SetIsDataInitialized();
     void MarkUsedInPendingCommands();
+    UsageTrackingSlot* GetUsageTrackingSlot();
 
     virtual void* GetMappedPointer() = 0;
     void* GetMappedRange(size_t offset, size_t size, bool writable = true);
@@ -131,6 +133,7 @@ class BufferBase : public ApiObjectBase {
     wgpu::BufferUsage mUsage = wgpu::BufferUsage::None;
     BufferState mState;
     bool mIsDataInitialized = false;
+    UsageTrackingSlot mUsageTrackingSlot;
 
     // mStagingBuffer is used to implement mappedAtCreation for
     // buffers with non-mappable usage. It is transiently allocated
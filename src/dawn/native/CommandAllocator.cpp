@@ -24,6 +24,123 @@
 
 namespace dawn::native {
 
+namespace {
+
+void FreeBlock(const BlockDef& block) {
+    if (block.pool != nullptr) {
+        block.pool->Release(block.block, block.size);
+    } else {
+        free(block.block);
+    }
+}
+
+}  // anonymous namespace
+
+CommandBlockPool::CommandBlockPool() = default;
+
+CommandBlockPool::~CommandBlockPool() {
+    for (SizeClass& sizeClass : mSizeClasses) {
+        ASSERT(sizeClass.blocksInUse == 0);
+        for (uint8_t* block : sizeClass.cachedBlocks) {
+            free(block);
+        }
+    }
+}
+
+uint8_t* CommandBlockPool::Acquire(size_t minimumSize, size_t* size) {
+    size_t sizeLog2 = std::max(kMinSizeClassLog2, size_t(Log2Ceil(uint64_t(minimumSize))));
+    if (sizeLog2 >= kMinSizeClassLog2 + kSizeClassCount) {
+        // Blocks that are too large to be pooled.
+        mAllocatedBlockCount.fetch_add(1, std::memory_order_relaxed);
+        *size = minimumSize;
+        return static_cast<uint8_t*>(malloc(minimumSize));
+    }
+
+    size_t blockSize = size_t(1) << sizeLog2;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        SizeClass& sizeClass = mSizeClasses[sizeLog2 - kMinSizeClassLog2];
+        sizeClass.acquiredSinceTrim = true;
+        if (!sizeClass.cachedBlocks.empty()) {
+            uint8_t* block = sizeClass.cachedBlocks.back();
+            sizeClass.cachedBlocks.pop_back();
+            sizeClass.blocksInUse++;
+            sizeClass.highWaterMark = std::max(sizeClass.highWaterMark, sizeClass.blocksInUse);
+            *size = blockSize;
+            return block;
+        }
+    }
+
+    uint8_t* block = static_cast<uint8_t*>(malloc(blockSize));
+    if (DAWN_UNLIKELY(block == nullptr)) {
+        return nullptr;
+    }
+    mAllocatedBlockCount.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    SizeClass& sizeClass = mSizeClasses[sizeLog2 - kMinSizeClassLog2];
+    sizeClass.blocksInUse++;
+    sizeClass.highWaterMark = std::max(sizeClass.highWaterMark, sizeClass.blocksInUse);
+    *size = blockSize;
+    return block;
+}
+
+void CommandBlockPool::Release(uint8_t* block, size_t size) {
+    if (size > (size_t(1) << (kMinSizeClassLog2 + kSizeClassCount - 1))) {
+        free(block);
+        return;
+    }
+    ASSERT(IsPowerOfTwo(size) && size >= (size_t(1) << kMinSizeClassLog2));
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    SizeClass& sizeClass = mSizeClasses[Log2(size) - kMinSizeClassLog2];
+    ASSERT(sizeClass.blocksInUse > 0);
+    sizeClass.blocksInUse--;
+    sizeClass.cachedBlocks.push_back(block);
+}
+
+void CommandBlockPool::Trim() {
+    std::vector<uint8_t*> blocksToFree;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (SizeClass& sizeClass : mSizeClasses) {
+            // Size classes that weren't used since the last trim keep their cached blocks, so
+            // that idle periods don't make the next burst of encoding allocate again.
+            if (!sizeClass.acquiredSinceTrim) {
+                continue;
+            }
+
+            // Keep enough blocks to reach the high-water mark again without allocating.
+            ASSERT(sizeClass.highWaterMark >= sizeClass.blocksInUse);
+            size_t blocksToKeep = sizeClass.highWaterMark - sizeClass.blocksInUse;
+            while (sizeClass.cachedBlocks.size() > blocksToKeep) {
+                blocksToFree.push_back(sizeClass.cachedBlocks.back());
+                sizeClass.cachedBlocks.pop_back();
+            }
+
+            sizeClass.highWaterMark = sizeClass.blocksInUse;
+            sizeClass.acquiredSinceTrim = false;
+        }
+    }
+
+    for (uint8_t* block : blocksToFree) {
+        free(block);
+    }
+}
+
+size_t CommandBlockPool::GetCachedBlockCountForTesting() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    size_t count = 0;
+    for (const SizeClass& sizeClass : mSizeClasses) {
+        count += sizeClass.cachedBlocks.size();
+    }
+    return count;
+}
+
+uint64_t CommandBlockPool::GetAllocatedBlockCountForTesting() const {
+    return mAllocatedBlockCount.load(std::memory_order_relaxed);
+}
+
 // TODO(cwallez@chromium.org): figure out a way to have more type safety for the iterator
 
 CommandIterator::CommandIterator() {
@@ -102,8 +219,8 @@ void CommandIterator::MakeEmptyAsDataWasDestroyed() {
         return;
     }
 
-    for (BlockDef& block : mBlocks) {
-        free(block.block);
+    for (const BlockDef& block : mBlocks) {
+        FreeBlock(block);
     }
     mBlocks.clear();
     Reset();
@@ -128,12 +245,18 @@ CommandAllocator::CommandAllocator() {
     ResetPointers();
 }
 
+CommandAllocator::CommandAllocator(CommandBlockPool* pool) : mPool(pool) {
+    ResetPointers();
+}
+
 CommandAllocator::~CommandAllocator() {
     Reset();
 }
 
 CommandAllocator::CommandAllocator(CommandAllocator&& other)
-    : mBlocks(std::move(other.mBlocks)), mLastAllocationSize(other.mLastAllocationSize) {
+    : mPool(other.mPool),
+      mBlocks(std::move(other.mBlocks)),
+      mLastAllocationSize(other.mLastAllocationSize) {
     other.mBlocks.clear();
     if (!other.IsEmpty()) {
         mCurrentPtr = other.mCurrentPtr;
@@ -146,6 +269,7 @@ CommandAllocator::CommandAllocator(CommandAllocator&& other)
 
 CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
     Reset();
+    mPool = other.mPool;
     if (!other.IsEmpty()) {
         std::swap(mBlocks, other.mBlocks);
         mLastAllocationSize = other.mLastAllocationSize;
@@ -157,8 +281,8 @@ CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
 }
 
 void CommandAllocator::Reset() {
-    for (BlockDef& block : mBlocks) {
-        free(block.block);
+    for (const BlockDef& block : mBlocks) {
+        FreeBlock(block);
     }
     mBlocks.clear();
     mLastAllocationSize = kDefaultBaseAllocationSize;
@@ -207,14 +331,18 @@ bool CommandAllocator::GetNewBlock(size_t minimumSize) {
     // Allocate blocks doubling sizes each time, to a maximum of 16k (or at least minimumSize).
     mLastAllocationSize = std::max(minimumSize, std::min(mLastAllocationSize * 2, size_t(16384)));
 
-    uint8_t* block = static_cast<uint8_t*>(malloc(mLastAllocationSize));
+    // The pool may return a larger block than requested.
+    size_t blockSize = mLastAllocationSize;
+    uint8_t* block = mPool != nullptr
+                         ? mPool->Acquire(mLastAllocationSize, &blockSize)
+                         : static_cast<uint8_t*>(malloc(mLastAllocationSize));
     if (DAWN_UNLIKELY(block == nullptr)) {
         return false;
     }
 
-    mBlocks.push_back({mLastAllocationSize, block});
+    mBlocks.push_back({blockSize, block, mPool});
     mCurrentPtr = AlignPtr(block, alignof(uint32_t));
-    mEndPtr = block + mLastAllocationSize;
+    mEndPtr = block + blockSize;
     return true;
 }
 
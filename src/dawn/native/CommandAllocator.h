@@ -15,9 +15,12 @@
 #ifndef SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 #define SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <mutex>
 #include <vector>
 
 #include "dawn/common/Assert.h"
@@ -53,11 +56,56 @@ namespace dawn::native {
 // and must tell the CommandIterator when the allocated commands have been processed for
 // deletion.
 
+// Allocating and freeing the command blocks for each encoder shows up in profiles of
+// applications that encode many command buffers or render bundles each frame. CommandAllocators
+// created with a CommandBlockPool take their blocks from the pool and return them to it when the
+// commands are destroyed, so that the encoders of the next frame reuse the same memory.
+//
+// Blocks are cached in power of two size classes, larger blocks are always allocated and freed
+// directly. To not hold on to the memory of a burst of encoding forever, Trim() frees the cached
+// blocks that weren't needed since the previous call to Trim(), based on the high-water mark of
+// the blocks in use of each size class. The pool is thread-safe since a device's encoders can be
+// used on multiple threads.
+class CommandBlockPool : public NonCopyable {
+  public:
+    CommandBlockPool();
+    ~CommandBlockPool();
+
+    // Returns a block of at least minimumSize bytes and sets *size to its actual size, or returns
+    // nullptr if the allocation failed.
+    uint8_t* Acquire(size_t minimumSize, size_t* size);
+    void Release(uint8_t* block, size_t size);
+
+    void Trim();
+
+    size_t GetCachedBlockCountForTesting() const;
+    // The number of blocks that had to be allocated because there was no cached block to reuse.
+    uint64_t GetAllocatedBlockCountForTesting() const;
+
+  private:
+    static constexpr size_t kMinSizeClassLog2 = 12;
+    static constexpr size_t kSizeClassCount = 5;
+
+    struct SizeClass {
+        std::vector<uint8_t*> cachedBlocks;
+        size_t blocksInUse = 0;
+        // The maximum of blocksInUse since the previous call to Trim().
+        size_t highWaterMark = 0;
+        bool acquiredSinceTrim = false;
+    };
+
+    mutable std::mutex mMutex;
+    std::array<SizeClass, kSizeClassCount> mSizeClasses;
+    std::atomic<uint64_t> mAllocatedBlockCount{0};
+};
+
 // These are the lists of blocks, should not be used directly, only through CommandAllocator
 // and CommandIterator
 struct BlockDef {
     size_t size;
     uint8_t* block;
+    // The pool the block must be returned to, or nullptr if it must be freed.
+    CommandBlockPool* pool = nullptr;
 };
 using CommandBlocks = std::vector<BlockDef>;
 
@@ -150,9 +198,11 @@ class CommandIterator : public NonCopyable {
 class CommandAllocator : public NonCopyable {
   public:
     CommandAllocator();
+    // Takes the blocks from the pool instead of allocating them, if the pool isn't nullptr.
+    explicit CommandAllocator(CommandBlockPool* pool);
     ~CommandAllocator();
 
-    // NOTE: A moved-from CommandAllocator is reset to its initial empty state.
+    // NOTE: A moved-from CommandAllocator is reset to its initial empty state but keeps its pool.
     CommandAllocator(CommandAllocator&&);
     CommandAllocator& operator=(CommandAllocator&&);
 
@@ -252,6 +302,7 @@ class CommandAllocator : public NonCopyable {
 
     void ResetPointers();
 
+    CommandBlockPool* mPool = nullptr;
     CommandBlocks mBlocks;
     size_t mLastAllocationSize = kDefaultBaseAllocationSize;
 
@@ -24,8 +24,11 @@
 #include "dawn/common/BitSetIterator.h"
 #include "dawn/common/StackContainer.h"
 #include "dawn/native/BindGroup.h"
+#include "dawn/native/BindGroupLayout.h"
+#include "dawn/native/BindGroupValidationCache.h"
 #include "dawn/native/ComputePassEncoder.h"
 #include "dawn/native/ComputePipeline.h"
+#include "dawn/native/Device.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/ObjectType_autogen.h"
 #include "dawn/native/PipelineLayout.h"
@@ -441,6 +444,14 @@ void CommandBufferStateTracker::RecomputeLazyAspects(ValidationAspects aspects)
     ASSERT(mAspects[VALIDATION_ASPECT_PIPELINE]);
     ASSERT((aspects & ~kLazyAspects).none());
 
+    if (aspects[VALIDATION_ASPECT_BIND_GROUPS]) {
+        std::optional<BindGroupValidationCache::Key> cacheKey = GetBindGroupValidationCacheKey();
+        if (cacheKey.has_value() && mBindGroupValidationCache->Contains(*cacheKey)) {
+            mAspects.set(VALIDATION_ASPECT_BIND_GROUPS);
+            aspects.reset(VALIDATION_ASPECT_BIND_GROUPS);
+        }
+    }
+
     if (aspects[VALIDATION_ASPECT_BIND_GROUPS]) {
         bool matches = true;
 
@@ -465,6 +476,12 @@ void CommandBufferStateTracker::RecomputeLazyAspects(ValidationAspects aspects)
 
         if (matches) {
             mAspects.set(VALIDATION_ASPECT_BIND_GROUPS);
+
+            std::optional<BindGroupValidationCache::Key> cacheKey =
+                GetBindGroupValidationCacheKey();
+            if (cacheKey.has_value()) {
+                mBindGroupValidationCache->Insert(*cacheKey);
+            }
         }
     }
 
@@ -659,6 +676,25 @@ MaybeError CommandBufferStateTracker::CheckMissingAspects(ValidationAspects aspe
     UNREACHABLE();
 }
 
+std::optional<BindGroupValidationCache::Key>
+CommandBufferStateTracker::GetBindGroupValidationCacheKey() const {
+    if (mBindGroupValidationCache == nullptr) {
+        return {};
+    }
+
+    BindGroupValidationCache::Key key;
+    key.pipelineId = mLastPipeline->GetValidationCacheId();
+    for (BindGroupIndex i : IterateBitSet(mLastPipelineLayout->GetBindGroupLayoutsMask())) {
+        // The aliasing of storage buffers with dynamic offsets depends on the offsets too.
+        if (mBindgroups[i] == nullptr ||
+            mBindgroups[i]->GetLayout()->GetBindingCountInfo().dynamicStorageBufferCount > 0) {
+            return {};
+        }
+        key.bindGroupIds[static_cast<uint32_t>(i)] = mBindgroups[i]->GetValidationCacheId();
+    }
+    return key;
+}
+
 void CommandBufferStateTracker::SetComputePipeline(ComputePipelineBase* pipeline) {
     SetPipelineCommon(pipeline);
 }
@@ -696,6 +732,8 @@ void CommandBufferStateTracker::SetPipelineCommon(PipelineBase* pipeline) {
     mLastPipeline = pipeline;
     mLastPipelineLayout = pipeline != nullptr ? pipeline->GetLayout() : nullptr;
     mMinBufferSizes = pipeline != nullptr ? &pipeline->GetMinBufferSizes() : nullptr;
+    mBindGroupValidationCache =
+        pipeline != nullptr ? pipeline->GetDevice()->GetBindGroupValidationCache() : nullptr;
 
     mAspects.set(VALIDATION_ASPECT_PIPELINE);
 
@@ -15,11 +15,13 @@
 #ifndef SRC_DAWN_NATIVE_COMMANDBUFFERSTATETRACKER_H_
 #define SRC_DAWN_NATIVE_COMMANDBUFFERSTATETRACKER_H_
 
+#include <optional>
 #include <vector>
 
 #include "dawn/common/Constants.h"
 #include "dawn/common/ityp_array.h"
 #include "dawn/common/ityp_bitset.h"
+#include "dawn/native/BindGroupValidationCache.h"
 #include "dawn/native/BindingInfo.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/Forward.h"
@@ -71,6 +73,9 @@ class CommandBufferStateTracker {
   private:
     MaybeError ValidateOperation(ValidationAspects requiredAspects);
     void RecomputeLazyAspects(ValidationAspects aspects);
+    // Returns the key of the current pipeline and bind groups in the device's
+    // BindGroupValidationCache, or nothing if their validation result can't be cached.
+    std::optional<BindGroupValidationCache::Key> GetBindGroupValidationCacheKey() const;
     MaybeError CheckMissingAspects(ValidationAspects aspects);
 
     void SetPipelineCommon(PipelineBase* pipeline);
@@ -88,6 +93,7 @@ class CommandBufferStateTracker {
 
     PipelineLayoutBase* mLastPipelineLayout = nullptr;
     PipelineBase* mLastPipeline = nullptr;
+    BindGroupValidationCache* mBindGroupValidationCache = nullptr;
 
     const RequiredBufferSizes* mMinBufferSizes = nullptr;
 };
@@ -730,6 +730,9 @@ void CommandEncoder::DestroyImpl() {
 }
 
 CommandBufferResourceUsage CommandEncoder::AcquireResourceUsages() {
+    RemoveDuplicateResources(&mTopLevelBuffers);
+    RemoveDuplicateResources(&mTopLevelTextures);
+    RemoveDuplicateResources(&mUsedQuerySets);
     return CommandBufferResourceUsage{
         mEncodingContext.AcquireRenderPassUsages(), mEncodingContext.AcquireComputePassUsages(),
         std::move(mTopLevelBuffers), std::move(mTopLevelTextures), std::move(mUsedQuerySets)};
@@ -740,7 +743,7 @@ CommandIterator CommandEncoder::AcquireCommands() {
 }
 
 void CommandEncoder::TrackUsedQuerySet(QuerySetBase* querySet) {
-    mUsedQuerySets.insert(querySet);
+    mUsedQuerySets.push_back(querySet);
 }
 
 void CommandEncoder::TrackQueryAvailability(QuerySetBase* querySet, uint32_t queryIndex) {
@@ -1142,8 +1145,8 @@ void CommandEncoder::APICopyBufferToBuffer(BufferBase* source,
                                  "validating destination %s usage.", destination);
             }
 
-            mTopLevelBuffers.insert(source);
-            mTopLevelBuffers.insert(destination);
+            mTopLevelBuffers.push_back(source);
+            mTopLevelBuffers.push_back(destination);
 
             CopyBufferToBufferCmd* copy =
                 allocator->Allocate<CopyBufferToBufferCmd>(Command::CopyBufferToBuffer);
@@ -1193,8 +1196,8 @@ void CommandEncoder::APICopyBufferToTexture(const ImageCopyBuffer* source,
                                                    blockInfo, *copySize));
             }
 
-            mTopLevelBuffers.insert(source->buffer);
-            mTopLevelTextures.insert(destination->texture);
+            mTopLevelBuffers.push_back(source->buffer);
+            mTopLevelTextures.push_back(destination->texture);
 
             TextureDataLayout srcLayout = source->layout;
             ApplyDefaultTextureDataLayoutOptions(&srcLayout, blockInfo, *copySize);
@@ -1280,8 +1283,8 @@ void CommandEncoder::APICopyTextureToBuffer(const ImageCopyTexture* source,
                     destination->layout, destination->buffer->GetSize(), blockInfo, *copySize));
             }
 
-            mTopLevelTextures.insert(source->texture);
-            mTopLevelBuffers.insert(destination->buffer);
+            mTopLevelTextures.push_back(source->texture);
+            mTopLevelBuffers.push_back(destination->buffer);
 
             TextureDataLayout dstLayout = destination->layout;
             ApplyDefaultTextureDataLayoutOptions(&dstLayout, blockInfo, *copySize);
@@ -1355,8 +1358,8 @@ void CommandEncoder::APICopyTextureToTextureHelper(const ImageCopyTexture* sourc
                 }
             }
 
-            mTopLevelTextures.insert(source->texture);
-            mTopLevelTextures.insert(destination->texture);
+            mTopLevelTextures.push_back(source->texture);
+            mTopLevelTextures.push_back(destination->texture);
 
             Aspect aspect = ConvertAspect(source->texture->GetFormat(), source->aspect);
             ASSERT(aspect == ConvertAspect(destination->texture->GetFormat(), destination->aspect));
@@ -1448,7 +1451,7 @@ void CommandEncoder::APIClearBuffer(BufferBase* buffer, uint64_t offset, uint64_
                 }
             }
 
-            mTopLevelBuffers.insert(buffer);
+            mTopLevelBuffers.push_back(buffer);
 
             ClearBufferCmd* cmd = allocator->Allocate<ClearBufferCmd>(Command::ClearBuffer);
             cmd->buffer = buffer;
@@ -1538,7 +1541,7 @@ void CommandEncoder::APIResolveQuerySet(QuerySetBase* querySet,
                 TrackUsedQuerySet(querySet);
             }
 
-            mTopLevelBuffers.insert(destination);
+            mTopLevelBuffers.push_back(destination);
 
             ResolveQuerySetCmd* cmd =
                 allocator->Allocate<ResolveQuerySetCmd>(Command::ResolveQuerySet);
@@ -1585,7 +1588,7 @@ void CommandEncoder::APIWriteBuffer(BufferBase* buffer,
             uint8_t* inlinedData = allocator->AllocateData<uint8_t>(size);
             memcpy(inlinedData, data, size);
 
-            mTopLevelBuffers.insert(buffer);
+            mTopLevelBuffers.push_back(buffer);
 
             return {};
         },
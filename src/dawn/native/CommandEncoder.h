@@ -15,8 +15,8 @@
 #ifndef SRC_DAWN_NATIVE_COMMANDENCODER_H_
 #define SRC_DAWN_NATIVE_COMMANDENCODER_H_
 
-#include <set>
 #include <string>
+#include <vector>
 
 #include "dawn/native/dawn_platform.h"
 
@@ -140,9 +140,9 @@ class CommandEncoder final : public ApiObjectBase {
     MaybeError ValidateFinish() const;
 
     EncodingContext mEncodingContext;
-    std::set<BufferBase*> mTopLevelBuffers;
-    std::set<TextureBase*> mTopLevelTextures;
-    std::set<QuerySetBase*> mUsedQuerySets;
+    std::vector<BufferBase*> mTopLevelBuffers;
+    std::vector<TextureBase*> mTopLevelTextures;
+    std::vector<QuerySetBase*> mUsedQuerySets;
 
     uint64_t mDebugGroupStackSize = 0;
 
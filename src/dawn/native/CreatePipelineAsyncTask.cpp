@@ -160,7 +160,9 @@ void CreateComputePipelineAsyncTask::RunAsync(
     TRACE_EVENT_FLOW_BEGIN1(device->GetPlatform(), General,
                             "CreateComputePipelineAsyncTask::RunAsync", task.get(), "label",
                             eventLabel);
-    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask));
+    // The application is waiting on the callback, so run the task ahead of background work.
+    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask),
+                                            dawn::platform::WorkerTaskPriority::High);
 }
 
 CreateRenderPipelineAsyncTask::CreateRenderPipelineAsyncTask(
@@ -213,6 +215,8 @@ void CreateRenderPipelineAsyncTask::RunAsync(std::unique_ptr<CreateRenderPipelin
     TRACE_EVENT_FLOW_BEGIN1(device->GetPlatform(), General,
                             "CreateRenderPipelineAsyncTask::RunAsync", task.get(), "label",
                             eventLabel);
-    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask));
+    // The application is waiting on the callback, so run the task ahead of background work.
+    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask),
+                                            dawn::platform::WorkerTaskPriority::High);
 }
 }  // namespace dawn::native
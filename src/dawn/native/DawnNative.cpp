@@ -22,6 +22,7 @@
 #include "dawn/native/Device.h"
 #include "dawn/native/Instance.h"
 #include "dawn/native/Texture.h"
+#include "dawn/native/TintProgramResidency.h"
 #include "dawn/platform/DawnPlatform.h"
 #include "tint/tint.h"
 
@@ -205,6 +206,18 @@ WGPUInstance Instance::Get() const {
     return ToAPI(mImpl);
 }
 
+void SetTintProgramResidencyBudget(WGPUDevice device, size_t maxResidentPrograms) {
+    FromAPI(device)->GetTintProgramResidencyManager()->SetBudget(maxResidentPrograms);
+}
+
+size_t GetResidentTintProgramCount(WGPUDevice device) {
+    return FromAPI(device)->GetTintProgramResidencyManager()->GetResidentCount();
+}
+
+size_t GetEvictedTintProgramCount(WGPUDevice device) {
+    return FromAPI(device)->GetTintProgramResidencyManager()->GetEvictedCount();
+}
+
 size_t GetLazyClearCountForTesting(WGPUDevice device) {
     return FromAPI(device)->GetLazyClearCountForTesting();
 }
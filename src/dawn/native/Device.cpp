@@ -25,10 +25,12 @@
 #include "dawn/native/AttachmentState.h"
 #include "dawn/native/BindGroup.h"
 #include "dawn/native/BindGroupLayout.h"
+#include "dawn/native/BindGroupValidationCache.h"
 #include "dawn/native/BlitBufferToDepthStencil.h"
 #include "dawn/native/BlobCache.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/ChainUtils_autogen.h"
+#include "dawn/native/CommandAllocator.h"
 #include "dawn/native/CommandBuffer.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/CompilationMessages.h"
@@ -51,6 +53,7 @@
 #include "dawn/native/Surface.h"
 #include "dawn/native/SwapChain.h"
 #include "dawn/native/Texture.h"
+#include "dawn/native/TintProgramResidency.h"
 #include "dawn/native/ValidationUtils_autogen.h"
 #include "dawn/native/utils/WGPUHelpers.h"
 #include "dawn/platform/DawnPlatform.h"
@@ -246,6 +249,9 @@ MaybeError DeviceBase::Initialize(Ref<QueueBase> defaultQueue) {
 #endif  // DAWN_ENABLE_ASSERTS
 
     mCaches = std::make_unique<DeviceBase::Caches>();
+    mTintProgramResidency = std::make_unique<TintProgramResidencyManager>();
+    mCommandBlockPool = std::make_unique<CommandBlockPool>();
+    mBindGroupValidationCache = std::make_unique<BindGroupValidationCache>();
     mErrorScopeStack = std::make_unique<ErrorScopeStack>();
     mDynamicUploader = std::make_unique<DynamicUploader>(this);
     mCallbackTaskManager = AcquireRef(new CallbackTaskManager());
@@ -729,6 +735,22 @@ dawn::platform::Platform* DeviceBase::GetPlatform() const {
     return GetPhysicalDevice()->GetInstance()->GetPlatform();
 }
 
+TintProgramCache* DeviceBase::GetTintProgramCache() const {
+    return GetPhysicalDevice()->GetInstance()->GetTintProgramCache();
+}
+
+TintProgramResidencyManager* DeviceBase::GetTintProgramResidencyManager() const {
+    return mTintProgramResidency.get();
+}
+
+CommandBlockPool* DeviceBase::GetCommandBlockPool() const {
+    return mCommandBlockPool.get();
+}
+
+BindGroupValidationCache* DeviceBase::GetBindGroupValidationCache() const {
+    return mBindGroupValidationCache.get();
+}
+
 ExecutionSerial DeviceBase::GetCompletedCommandSerial() const {
     return mCompletedSerial;
 }
@@ -1343,6 +1365,7 @@ MaybeError DeviceBase::Tick() {
     // reclaiming resources one tick earlier.
     mDynamicUploader->Deallocate(mCompletedSerial);
     mQueue->Tick(mCompletedSerial);
+    mCommandBlockPool->Trim();
 
     return {};
 }
@@ -47,12 +47,16 @@ namespace dawn::native {
 class AsyncTaskManager;
 class AttachmentState;
 class AttachmentStateBlueprint;
+class BindGroupValidationCache;
 class Blob;
 class BlobCache;
 class CallbackTaskManager;
+class CommandBlockPool;
 class DynamicUploader;
 class ErrorScopeStack;
 class OwnedCompilationMessages;
+class TintProgramCache;
+class TintProgramResidencyManager;
 struct CallbackTask;
 struct InternalPipelineStore;
 struct ShaderModuleParseResult;
@@ -157,6 +161,13 @@ class DeviceBase : public RefCountedWithExternalCount {
     AdapterBase* GetAdapter() const;
     PhysicalDeviceBase* GetPhysicalDevice() const;
     virtual dawn::platform::Platform* GetPlatform() const;
+    // The cache of parsed shader programs shared by all the devices of the instance.
+    virtual TintProgramCache* GetTintProgramCache() const;
+    TintProgramResidencyManager* GetTintProgramResidencyManager() const;
+    // The pool of the blocks of the device's command encoders and render bundle encoders.
+    CommandBlockPool* GetCommandBlockPool() const;
+    // The combinations of pipelines and bind groups that were validated to be compatible.
+    BindGroupValidationCache* GetBindGroupValidationCache() const;
 
     // Returns the Format corresponding to the wgpu::TextureFormat or an error if the format
     // isn't a valid wgpu::TextureFormat or isn't supported by this device.
@@ -582,6 +593,13 @@ class DeviceBase : public RefCountedWithExternalCount {
 
     Ref<AdapterBase> mAdapter;
 
+    // Declared early so that it outlives the shader modules referenced by the other members.
+    std::unique_ptr<TintProgramResidencyManager> mTintProgramResidency;
+    // Declared early so that it outlives the commands of the objects referenced by the other
+    // members.
+    std::unique_ptr<CommandBlockPool> mCommandBlockPool;
+    std::unique_ptr<BindGroupValidationCache> mBindGroupValidationCache;
+
     // The object caches aren't exposed in the header as they would require a lot of
     // additional includes.
     struct Caches;
@@ -137,6 +137,11 @@ IndirectDrawMetadata::GetIndexedIndirectBufferValidationInfo() {
 }
 
 void IndirectDrawMetadata::AddBundle(RenderBundleBase* bundle) {
+    // Most bundles don't have indexed indirect draws, skip them without looking them up.
+    if (bundle->GetIndirectDrawMetadata().mIndexedIndirectBufferValidationInfo.empty()) {
+        return;
+    }
+
     auto [_, inserted] = mAddedBundles.insert(bundle);
     if (!inserted) {
         return;
@@ -25,6 +25,7 @@
 #include "dawn/native/Device.h"
 #include "dawn/native/ErrorData.h"
 #include "dawn/native/Surface.h"
+#include "dawn/native/TintProgramCache.h"
 #include "dawn/native/Toggles.h"
 #include "dawn/native/ValidationUtils_autogen.h"
 #include "dawn/platform/DawnPlatform.h"
@@ -145,7 +146,8 @@ Ref<InstanceBase> InstanceBase::Create(const InstanceDescriptor* descriptor) {
     return instance;
 }
 
-InstanceBase::InstanceBase(const TogglesState& instanceToggles) : mToggles(instanceToggles) {}
+InstanceBase::InstanceBase(const TogglesState& instanceToggles)
+    : mTintProgramCache(std::make_unique<TintProgramCache>()), mToggles(instanceToggles) {}
 
 InstanceBase::~InstanceBase() = default;
 
@@ -541,6 +543,10 @@ BlobCache* InstanceBase::GetBlobCache(bool enabled) {
     return &mPassthroughBlobCache;
 }
 
+TintProgramCache* InstanceBase::GetTintProgramCache() {
+    return mTintProgramCache.get();
+}
+
 uint64_t InstanceBase::GetDeviceCountForTesting() const {
     std::lock_guard<std::mutex> lg(mDevicesListMutex);
     return mDevicesList.size();
@@ -42,6 +42,7 @@ namespace dawn::native {
 class CallbackTaskManager;
 class DeviceBase;
 class Surface;
+class TintProgramCache;
 class XlibXcbFunctions;
 
 using BackendsBitset = ityp::bitset<wgpu::BackendType, kEnumCount<wgpu::BackendType>>;
@@ -105,6 +106,7 @@ class InstanceBase final : public RefCountedWithExternalCount {
     void SetPlatformForTesting(dawn::platform::Platform* platform);
     dawn::platform::Platform* GetPlatform();
     BlobCache* GetBlobCache(bool enabled = true);
+    TintProgramCache* GetTintProgramCache();
 
     uint64_t GetDeviceCountForTesting() const;
     void AddDevice(DeviceBase* device);
@@ -155,6 +157,7 @@ class InstanceBase final : public RefCountedWithExternalCount {
     std::unique_ptr<dawn::platform::Platform> mDefaultPlatform;
     std::unique_ptr<BlobCache> mBlobCache;
     BlobCache mPassthroughBlobCache;
+    std::unique_ptr<TintProgramCache> mTintProgramCache;
 
     std::vector<std::unique_ptr<BackendConnection>> mBackends;
     std::vector<Ref<PhysicalDeviceBase>> mPhysicalDevices;
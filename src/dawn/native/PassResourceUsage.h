@@ -15,7 +15,9 @@
 #ifndef SRC_DAWN_NATIVE_PASSRESOURCEUSAGE_H_
 #define SRC_DAWN_NATIVE_PASSRESOURCEUSAGE_H_
 
-#include <set>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <vector>
 
 #include "dawn/native/SubresourceStorage.h"
@@ -35,6 +37,25 @@ class TextureBase;
 // The texture usage inside passes must be tracked per-subresource.
 using TextureSubresourceUsage = SubresourceStorage<wgpu::TextureUsage>;
 
+// Stored in buffers and textures by the SyncScopeUsageTracker that is currently tracking them,
+// with their index in the tracker's usages, so that the tracker can find their usage in O(1).
+// Encoders on different threads can track the same resource, so the slot is claimed with a
+// compare-exchange of the scope from 0. Only the tracker whose scope is in the slot writes or
+// reads the index, or sets the scope back to 0.
+struct UsageTrackingSlot {
+    // The scope of the tracker, or 0 if no tracker uses the slot.
+    std::atomic<uint64_t> scope{0};
+    uint32_t index = 0;
+};
+
+// Sorts the resources and removes the duplicates, for the lists of resources that are appended
+// to without checking whether they were already added.
+template <typename T>
+void RemoveDuplicateResources(std::vector<T*>* resources) {
+    std::sort(resources->begin(), resources->end());
+    resources->erase(std::unique(resources->begin(), resources->end()), resources->end());
+}
+
 // Which resources are used by a synchronization scope and how they are used. The command
 // buffer validation pre-computes this information so that backends with explicit barriers
 // don't have to re-compute it.
@@ -63,10 +84,11 @@ struct ComputePassResourceUsage {
 
     std::vector<SyncScopeResourceUsage> dispatchUsages;
 
-    // All the resources referenced by this compute pass for validation in Queue::Submit.
-    std::set<BufferBase*> referencedBuffers;
-    std::set<TextureBase*> referencedTextures;
-    std::set<ExternalTextureBase*> referencedExternalTextures;
+    // All the resources referenced by this compute pass for validation in Queue::Submit, without
+    // duplicates.
+    std::vector<BufferBase*> referencedBuffers;
+    std::vector<TextureBase*> referencedTextures;
+    std::vector<ExternalTextureBase*> referencedExternalTextures;
 };
 
 // Contains all the resource usage data for a render pass.
@@ -89,10 +111,10 @@ struct CommandBufferResourceUsage {
     RenderPassUsages renderPasses;
     ComputePassUsages computePasses;
 
-    // Resources used in commands that aren't in a pass.
-    std::set<BufferBase*> topLevelBuffers;
-    std::set<TextureBase*> topLevelTextures;
-    std::set<QuerySetBase*> usedQuerySets;
+    // Resources used in commands that aren't in a pass, without duplicates.
+    std::vector<BufferBase*> topLevelBuffers;
+    std::vector<TextureBase*> topLevelTextures;
+    std::vector<QuerySetBase*> usedQuerySets;
 };
 
 }  // namespace dawn::native
@@ -14,6 +14,8 @@
 
 #include "dawn/native/PassResourceUsageTracker.h"
 
+#include <algorithm>
+#include <atomic>
 #include <utility>
 
 #include "dawn/native/BindGroup.h"
@@ -22,22 +24,132 @@
 #include "dawn/native/ExternalTexture.h"
 #include "dawn/native/Format.h"
 #include "dawn/native/QuerySet.h"
+#include "dawn/native/RenderBundle.h"
 #include "dawn/native/Texture.h"
 
 namespace dawn::native {
 
-SyncScopeUsageTracker::SyncScopeUsageTracker() = default;
+namespace {
 
-SyncScopeUsageTracker::SyncScopeUsageTracker(SyncScopeUsageTracker&&) = default;
+// Scopes are never reused so that a stale slot can't be mistaken for one of the current scope.
+uint64_t AcquireUsageTrackingScope() {
+    static std::atomic<uint64_t> sNextScope{1};
+    return sNextScope.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // anonymous namespace
+
+SyncScopeUsageTracker::SyncScopeUsageTracker() : mScope(AcquireUsageTrackingScope()) {}
+
+SyncScopeUsageTracker::SyncScopeUsageTracker(SyncScopeUsageTracker&& other)
+    : mScope(other.mScope),
+      mBuffers(std::move(other.mBuffers)),
+      mBufferUsages(std::move(other.mBufferUsages)),
+      mTextures(std::move(other.mTextures)),
+      mTextureUsages(std::move(other.mTextureUsages)),
+      mExternalTextureUsages(std::move(other.mExternalTextureUsages)),
+      mOtherScopeBufferIndices(std::move(other.mOtherScopeBufferIndices)),
+      mOtherScopeTextureIndices(std::move(other.mOtherScopeTextureIndices)) {
+    // The slots of the resources now belong to this tracker, the moved-from tracker gets a new
+    // empty scope.
+    other.mScope = AcquireUsageTrackingScope();
+    other.mOtherScopeBufferIndices.clear();
+    other.mOtherScopeTextureIndices.clear();
+}
+
+SyncScopeUsageTracker::~SyncScopeUsageTracker() {
+    ReleaseUsageTrackingSlots();
+}
+
+SyncScopeUsageTracker& SyncScopeUsageTracker::operator=(SyncScopeUsageTracker&& other) {
+    if (this == &other) {
+        return *this;
+    }
+    ReleaseUsageTrackingSlots();
+
+    mScope = other.mScope;
+    mBuffers = std::move(other.mBuffers);
+    mBufferUsages = std::move(other.mBufferUsages);
+    mTextures = std::move(other.mTextures);
+    mTextureUsages = std::move(other.mTextureUsages);
+    mExternalTextureUsages = std::move(other.mExternalTextureUsages);
+    mOtherScopeBufferIndices = std::move(other.mOtherScopeBufferIndices);
+    mOtherScopeTextureIndices = std::move(other.mOtherScopeTextureIndices);
+
+    // Reset the moved-from tracker to a new empty scope without releasing the slots that now
+    // belong to this tracker.
+    other.mScope = AcquireUsageTrackingScope();
+    other.mBuffers.clear();
+    other.mBufferUsages.clear();
+    other.mTextures.clear();
+    other.mTextureUsages.clear();
+    other.mExternalTextureUsages.clear();
+    other.mOtherScopeBufferIndices.clear();
+    other.mOtherScopeTextureIndices.clear();
+    return *this;
+}
+
+template <typename T>
+bool SyncScopeUsageTracker::TrackResource(T* resource,
+                                          std::vector<Ref<T>>* resources,
+                                          std::unordered_map<T*, size_t>* otherScopeIndices,
+                                          size_t* index) {
+    UsageTrackingSlot* slot = resource->GetUsageTrackingSlot();
+    // Only this tracker sets the scope of a slot to mScope, so a relaxed load is enough to know
+    // whether the slot is ours.
+    uint64_t slotScope = slot->scope.load(std::memory_order_relaxed);
+    if (slotScope == mScope) {
+        *index = slot->index;
+        return false;
+    }
 
-SyncScopeUsageTracker::~SyncScopeUsageTracker() = default;
+    // The resource may have been added while its slot was used by another scope, and the slot
+    // freed since then.
+    if (!otherScopeIndices->empty()) {
+        auto it = otherScopeIndices->find(resource);
+        if (it != otherScopeIndices->end()) {
+            *index = it->second;
+            return false;
+        }
+    }
 
-SyncScopeUsageTracker& SyncScopeUsageTracker::operator=(SyncScopeUsageTracker&&) = default;
+    if (slotScope == 0 &&
+        slot->scope.compare_exchange_strong(slotScope, mScope, std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+        *index = resources->size();
+        slot->index = static_cast<uint32_t>(*index);
+        resources->emplace_back(resource);
+        return true;
+    }
+
+    // The slot is used by another scope that is still alive.
+    *index = resources->size();
+    otherScopeIndices->emplace(resource, *index);
+    resources->emplace_back(resource);
+    return true;
+}
+
+void SyncScopeUsageTracker::ReleaseUsageTrackingSlots() {
+    for (const Ref<BufferBase>& buffer : mBuffers) {
+        UsageTrackingSlot* slot = buffer->GetUsageTrackingSlot();
+        if (slot->scope.load(std::memory_order_relaxed) == mScope) {
+            slot->scope.store(0, std::memory_order_release);
+        }
+    }
+    for (const Ref<TextureBase>& texture : mTextures) {
+        UsageTrackingSlot* slot = texture->GetUsageTrackingSlot();
+        if (slot->scope.load(std::memory_order_relaxed) == mScope) {
+            slot->scope.store(0, std::memory_order_release);
+        }
+    }
+}
 
 void SyncScopeUsageTracker::BufferUsedAs(BufferBase* buffer, wgpu::BufferUsage usage) {
-    // std::map's operator[] will create the key and return 0 if the key didn't exist
-    // before.
-    mBufferUsages[buffer] |= usage;
+    size_t index;
+    if (TrackResource(buffer, &mBuffers, &mOtherScopeBufferIndices, &index)) {
+        mBufferUsages.push_back(wgpu::BufferUsage::None);
+    }
+    mBufferUsages[index] |= usage;
 }
 
 void SyncScopeUsageTracker::TextureViewUsedAs(TextureViewBase* view, wgpu::TextureUsage usage) {
@@ -46,11 +158,7 @@ void SyncScopeUsageTracker::TextureViewUsedAs(TextureViewBase* view, wgpu::Textu
 
     // Get or create a new TextureSubresourceUsage for that texture (initially filled with
     // wgpu::TextureUsage::None)
-    auto it = mTextureUsages.emplace(
-        std::piecewise_construct, std::forward_as_tuple(texture),
-        std::forward_as_tuple(texture->GetFormat().aspects, texture->GetArrayLayers(),
-                              texture->GetNumMipLevels(), wgpu::TextureUsage::None));
-    TextureSubresourceUsage& textureUsage = it.first->second;
+    TextureSubresourceUsage& textureUsage = GetTextureUsage(texture);
 
     textureUsage.Update(range, [usage](const SubresourceRange&, wgpu::TextureUsage* storedUsage) {
         // TODO(crbug.com/dawn/1001): Consider optimizing to have fewer
@@ -72,11 +180,7 @@ void SyncScopeUsageTracker::AddRenderBundleTextureUsage(
     const TextureSubresourceUsage& textureUsage) {
     // Get or create a new TextureSubresourceUsage for that texture (initially filled with
     // wgpu::TextureUsage::None)
-    auto it = mTextureUsages.emplace(
-        std::piecewise_construct, std::forward_as_tuple(texture),
-        std::forward_as_tuple(texture->GetFormat().aspects, texture->GetArrayLayers(),
-                              texture->GetNumMipLevels(), wgpu::TextureUsage::None));
-    TextureSubresourceUsage* passTextureUsage = &it.first->second;
+    TextureSubresourceUsage* passTextureUsage = &GetTextureUsage(texture);
 
     passTextureUsage->Merge(textureUsage,
                             [](const SubresourceRange&, wgpu::TextureUsage* storedUsage,
@@ -86,6 +190,20 @@ void SyncScopeUsageTracker::AddRenderBundleTextureUsage(
                             });
 }
 
+void SyncScopeUsageTracker::AddRenderBundleUsage(RenderBundleBase* bundle) {
+    if (!bundle->SetLastUsageTrackingScope(mScope)) {
+        return;
+    }
+
+    const RenderPassResourceUsage& usages = bundle->GetResourceUsage();
+    for (size_t i = 0; i < usages.buffers.size(); ++i) {
+        BufferUsedAs(usages.buffers[i], usages.bufferUsages[i]);
+    }
+    for (size_t i = 0; i < usages.textures.size(); ++i) {
+        AddRenderBundleTextureUsage(usages.textures[i], usages.textureUsages[i]);
+    }
+}
+
 void SyncScopeUsageTracker::AddBindGroup(BindGroupBase* group) {
     for (BindingIndex bindingIndex{0}; bindingIndex < group->GetLayout()->GetBindingCount();
          ++bindingIndex) {
@@ -140,39 +258,57 @@ void SyncScopeUsageTracker::AddBindGroup(BindGroupBase* group) {
         }
     }
 
+    // There are very few external textures so a linear search is enough to deduplicate them.
     for (const Ref<ExternalTextureBase>& externalTexture : group->GetBoundExternalTextures()) {
-        mExternalTextureUsages.insert(externalTexture.Get());
+        if (std::find(mExternalTextureUsages.begin(), mExternalTextureUsages.end(),
+                      externalTexture.Get()) == mExternalTextureUsages.end()) {
+            mExternalTextureUsages.push_back(externalTexture.Get());
+        }
     }
 }
 
 SyncScopeResourceUsage SyncScopeUsageTracker::AcquireSyncScopeUsage() {
+    ReleaseUsageTrackingSlots();
+
     SyncScopeResourceUsage result;
-    result.buffers.reserve(mBufferUsages.size());
-    result.bufferUsages.reserve(mBufferUsages.size());
-    result.textures.reserve(mTextureUsages.size());
-    result.textureUsages.reserve(mTextureUsages.size());
-
-    for (auto& [buffer, usage] : mBufferUsages) {
-        result.buffers.push_back(buffer);
-        result.bufferUsages.push_back(usage);
+    result.buffers.reserve(mBuffers.size());
+    for (const Ref<BufferBase>& buffer : mBuffers) {
+        result.buffers.push_back(buffer.Get());
     }
+    result.bufferUsages = std::move(mBufferUsages);
 
-    for (auto& [texture, usage] : mTextureUsages) {
-        result.textures.push_back(texture);
-        result.textureUsages.push_back(std::move(usage));
+    result.textures.reserve(mTextures.size());
+    for (const Ref<TextureBase>& texture : mTextures) {
+        result.textures.push_back(texture.Get());
     }
+    result.textureUsages = std::move(mTextureUsages);
 
-    for (auto* const it : mExternalTextureUsages) {
-        result.externalTextures.push_back(it);
-    }
+    result.externalTextures = std::move(mExternalTextureUsages);
 
+    mBuffers.clear();
     mBufferUsages.clear();
+    mTextures.clear();
     mTextureUsages.clear();
     mExternalTextureUsages.clear();
+    mOtherScopeBufferIndices.clear();
+    mOtherScopeTextureIndices.clear();
+
+    // Start a new scope so that the render bundles executed in this one are added again if the
+    // tracker is reused.
+    mScope = AcquireUsageTrackingScope();
 
     return result;
 }
 
+TextureSubresourceUsage& SyncScopeUsageTracker::GetTextureUsage(TextureBase* texture) {
+    size_t index;
+    if (TrackResource(texture, &mTextures, &mOtherScopeTextureIndices, &index)) {
+        mTextureUsages.emplace_back(texture->GetFormat().aspects, texture->GetArrayLayers(),
+                                    texture->GetNumMipLevels(), wgpu::TextureUsage::None);
+    }
+    return mTextureUsages[index];
+}
+
 ComputePassResourceUsageTracker::ComputePassResourceUsageTracker() = default;
 
 ComputePassResourceUsageTracker::~ComputePassResourceUsageTracker() = default;
@@ -182,7 +318,7 @@ void ComputePassResourceUsageTracker::AddDispatch(SyncScopeResourceUsage scope)
 }
 
 void ComputePassResourceUsageTracker::AddReferencedBuffer(BufferBase* buffer) {
-    mUsage.referencedBuffers.insert(buffer);
+    mUsage.referencedBuffers.push_back(buffer);
 }
 
 void ComputePassResourceUsageTracker::AddResourcesReferencedByBindGroup(BindGroupBase* group) {
@@ -191,12 +327,13 @@ void ComputePassResourceUsageTracker::AddResourcesReferencedByBindGroup(BindGrou
 
         switch (bindingInfo.bindingType) {
             case BindingInfoType::Buffer: {
-                mUsage.referencedBuffers.insert(group->GetBindingAsBufferBinding(index).buffer);
+                mUsage.referencedBuffers.push_back(
+                    group->GetBindingAsBufferBinding(index).buffer);
                 break;
             }
 
             case BindingInfoType::Texture: {
-                mUsage.referencedTextures.insert(
+                mUsage.referencedTextures.push_back(
                     group->GetBindingAsTextureView(index)->GetTexture());
                 break;
             }
@@ -210,11 +347,15 @@ void ComputePassResourceUsageTracker::AddResourcesReferencedByBindGroup(BindGrou
     }
 
     for (const Ref<ExternalTextureBase>& externalTexture : group->GetBoundExternalTextures()) {
-        mUsage.referencedExternalTextures.insert(externalTexture.Get());
+        mUsage.referencedExternalTextures.push_back(externalTexture.Get());
     }
 }
 
 ComputePassResourceUsage ComputePassResourceUsageTracker::AcquireResourceUsage() {
+    // The referenced resources are appended for each bind group and deduplicated only once.
+    RemoveDuplicateResources(&mUsage.referencedBuffers);
+    RemoveDuplicateResources(&mUsage.referencedTextures);
+    RemoveDuplicateResources(&mUsage.referencedExternalTextures);
     return std::move(mUsage);
 }
 
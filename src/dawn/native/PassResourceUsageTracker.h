@@ -16,9 +16,10 @@
 #define SRC_DAWN_NATIVE_PASSRESOURCEUSAGETRACKER_H_
 
 #include <map>
-#include <set>
+#include <unordered_map>
 #include <vector>
 
+#include "dawn/common/RefCounted.h"
 #include "dawn/native/PassResourceUsage.h"
 
 #include "dawn/native/dawn_platform.h"
@@ -29,11 +30,18 @@ class BindGroupBase;
 class BufferBase;
 class ExternalTextureBase;
 class QuerySetBase;
+class RenderBundleBase;
 class TextureBase;
 
 using QueryAvailabilityMap = std::map<QuerySetBase*, std::vector<bool>>;
 
 // Helper class to build SyncScopeResourceUsages
+//
+// The usages are stored in dense vectors. Each buffer and texture tracked is stamped with the
+// scope of the tracker and its index in the vectors, so that finding the usage of a resource that
+// was already seen in the scope, like in each SetBindGroup of a pass, is O(1) instead of a tree
+// lookup. A resource only has one slot: the rare resources that are used by several scopes at the
+// same time, for example with interleaved encoders, are found with a hash map instead.
 class SyncScopeUsageTracker {
   public:
     SyncScopeUsageTracker();
@@ -46,6 +54,9 @@ class SyncScopeUsageTracker {
     void TextureViewUsedAs(TextureViewBase* texture, wgpu::TextureUsage usage);
     void AddRenderBundleTextureUsage(TextureBase* texture,
                                      const TextureSubresourceUsage& textureUsage);
+    // Adds the usages of all the resources of the bundle. Adding them again has no effect so it
+    // is skipped when the bundle was already executed in this scope.
+    void AddRenderBundleUsage(RenderBundleBase* bundle);
 
     // Walks the bind groups and tracks all its resources.
     void AddBindGroup(BindGroupBase* group);
@@ -54,9 +65,30 @@ class SyncScopeUsageTracker {
     SyncScopeResourceUsage AcquireSyncScopeUsage();
 
   private:
-    std::map<BufferBase*, wgpu::BufferUsage> mBufferUsages;
-    std::map<TextureBase*, TextureSubresourceUsage> mTextureUsages;
-    std::set<ExternalTextureBase*> mExternalTextureUsages;
+    // Sets *index to the index of the resource in resources and returns true if the resource
+    // wasn't tracked by this scope yet and was appended.
+    template <typename T>
+    bool TrackResource(T* resource,
+                       std::vector<Ref<T>>* resources,
+                       std::unordered_map<T*, size_t>* otherScopeIndices,
+                       size_t* index);
+    // Frees the slots of the tracked resources for other scopes.
+    void ReleaseUsageTrackingSlots();
+    TextureSubresourceUsage& GetTextureUsage(TextureBase* texture);
+
+    uint64_t mScope;
+
+    // The resources are referenced so that their slot can still be released when the tracker is
+    // destroyed without acquiring the usages.
+    std::vector<Ref<BufferBase>> mBuffers;
+    std::vector<wgpu::BufferUsage> mBufferUsages;
+    std::vector<Ref<TextureBase>> mTextures;
+    std::vector<TextureSubresourceUsage> mTextureUsages;
+    std::vector<ExternalTextureBase*> mExternalTextureUsages;
+
+    // The indices of the resources whose slot is used by another scope.
+    std::unordered_map<BufferBase*, size_t> mOtherScopeBufferIndices;
+    std::unordered_map<TextureBase*, size_t> mOtherScopeTextureIndices;
 };
 
 // Helper class to build ComputePassResourceUsages
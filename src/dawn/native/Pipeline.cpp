@@ -236,6 +236,10 @@ const RequiredBufferSizes& PipelineBase::GetMinBufferSizes() const {
     return mMinBufferSizes;
 }
 
+uint64_t PipelineBase::GetValidationCacheId() const {
+    return mValidationCacheId;
+}
+
 const ProgrammableStage& PipelineBase::GetStage(SingleShaderStage stage) const {
     ASSERT(!IsError());
     return mStages[stage];
@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "dawn/native/BindGroupValidationCache.h"
 #include "dawn/native/CachedObject.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/ObjectBase.h"
@@ -59,6 +60,7 @@ class PipelineBase : public ApiObjectBase, public CachedObject {
     PipelineLayoutBase* GetLayout();
     const PipelineLayoutBase* GetLayout() const;
     const RequiredBufferSizes& GetMinBufferSizes() const;
+    uint64_t GetValidationCacheId() const;
     const ProgrammableStage& GetStage(SingleShaderStage stage) const;
     const PerStage<ProgrammableStage>& GetAllStages() const;
     bool HasStage(SingleShaderStage stage) const;
@@ -91,6 +93,8 @@ class PipelineBase : public ApiObjectBase, public CachedObject {
 
     Ref<PipelineLayoutBase> mLayout;
     RequiredBufferSizes mMinBufferSizes;
+
+    const uint64_t mValidationCacheId = AcquireValidationCacheId();
 };
 
 }  // namespace dawn::native
@@ -115,6 +115,11 @@ const RenderPassResourceUsage& RenderBundleBase::GetResourceUsage() const {
     return mResourceUsage;
 }
 
+bool RenderBundleBase::SetLastUsageTrackingScope(uint64_t scope) {
+    ASSERT(!IsError());
+    return mLastUsageTrackingScope.exchange(scope, std::memory_order_relaxed) != scope;
+}
+
 const IndirectDrawMetadata& RenderBundleBase::GetIndirectDrawMetadata() {
     return mIndirectDrawMetadata;
 }
@@ -15,6 +15,7 @@
 #ifndef SRC_DAWN_NATIVE_RENDERBUNDLE_H_
 #define SRC_DAWN_NATIVE_RENDERBUNDLE_H_
 
+#include <atomic>
 #include <bitset>
 #include <string>
 
@@ -59,6 +60,9 @@ class RenderBundleBase final : public ApiObjectBase {
     bool IsStencilReadOnly() const;
     uint64_t GetDrawCount() const;
     const RenderPassResourceUsage& GetResourceUsage() const;
+    // Records that the resource usages of the bundle were added to the usage tracking scope.
+    // Returns false if they already were added to that scope.
+    bool SetLastUsageTrackingScope(uint64_t scope);
     const IndirectDrawMetadata& GetIndirectDrawMetadata();
 
   private:
@@ -74,6 +78,8 @@ class RenderBundleBase final : public ApiObjectBase {
     uint64_t mDrawCount;
     RenderPassResourceUsage mResourceUsage;
     std::string mEncoderLabel;
+    // The bundle may be executed by encoders on several threads.
+    std::atomic<uint64_t> mLastUsageTrackingScope{0};
 };
 
 }  // namespace dawn::native
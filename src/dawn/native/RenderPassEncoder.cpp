@@ -330,16 +330,7 @@ void RenderPassEncoder::APIExecuteBundles(uint32_t count, RenderBundleBase* cons
             Ref<RenderBundleBase>* bundles = allocator->AllocateData<Ref<RenderBundleBase>>(count);
             for (uint32_t i = 0; i < count; ++i) {
                 bundles[i] = renderBundles[i];
-
-                const RenderPassResourceUsage& usages = bundles[i]->GetResourceUsage();
-                for (uint32_t i = 0; i < usages.buffers.size(); ++i) {
-                    mUsageTracker.BufferUsedAs(usages.buffers[i], usages.bufferUsages[i]);
-                }
-
-                for (uint32_t i = 0; i < usages.textures.size(); ++i) {
-                    mUsageTracker.AddRenderBundleTextureUsage(usages.textures[i],
-                                                              usages.textureUsages[i]);
-                }
+                mUsageTracker.AddRenderBundleUsage(renderBundles[i]);
 
                 if (IsValidationEnabled()) {
                     mIndirectDrawMetadata.AddBundle(renderBundles[i]);
@@ -28,6 +28,8 @@
 #include "dawn/native/Pipeline.h"
 #include "dawn/native/PipelineLayout.h"
 #include "dawn/native/RenderPipeline.h"
+#include "dawn/native/TintProgramCache.h"
+#include "dawn/native/TintProgramResidency.h"
 #include "dawn/native/TintUtils.h"
 
 #include "tint/tint.h"
@@ -318,11 +320,9 @@ ResultOrError<tint::Program> ParseWGSL(const tint::Source::File* file,
 #if TINT_BUILD_SPV_READER
 ResultOrError<tint::Program> ParseSPIRV(const std::vector<uint32_t>& spirv,
                                         OwnedCompilationMessages* outMessages,
-                                        const DawnShaderModuleSPIRVOptionsDescriptor* optionsDesc) {
+                                        bool allowNonUniformDerivatives) {
     tint::reader::spirv::Options options;
-    if (optionsDesc) {
-        options.allow_non_uniform_derivatives = optionsDesc->allowNonUniformDerivatives;
-    }
+    options.allow_non_uniform_derivatives = allowNonUniformDerivatives;
     tint::Program program = tint::reader::spirv::Parse(spirv, options);
     if (outMessages != nullptr) {
         DAWN_TRY(outMessages->AddMessages(program.Diagnostics()));
@@ -336,6 +336,39 @@ ResultOrError<tint::Program> ParseSPIRV(const std::vector<uint32_t>& spirv,
 }
 #endif  // TINT_BUILD_SPV_READER
 
+// Returns the program parsed from the source in `blueprint`, reusing the one in the instance's
+// program cache if any device already parsed the same source with the same options.
+ResultOrError<Ref<SharedTintProgram>> GetOrParseTintProgram(DeviceBase* device,
+                                                            Ref<SharedTintProgram> blueprint,
+                                                            OwnedCompilationMessages* outMessages) {
+    TintProgramCache* cache = device->GetTintProgramCache();
+
+    Ref<SharedTintProgram> program = cache->Find(blueprint.Get());
+    if (program != nullptr) {
+        // Only valid programs are cached, but they can still have warnings that should be
+        // reported for this shader module too.
+        if (outMessages != nullptr) {
+            DAWN_TRY(outMessages->AddMessages(program->GetProgram()->Diagnostics()));
+        }
+        return std::move(program);
+    }
+
+    tint::Program parsed;
+    if (blueprint->GetWGSLFile() != nullptr) {
+        DAWN_TRY_ASSIGN(parsed, ParseWGSL(blueprint->GetWGSLFile(), outMessages));
+    } else {
+#if TINT_BUILD_SPV_READER
+        DAWN_TRY_ASSIGN(parsed, ParseSPIRV(blueprint->GetSPIRV(), outMessages,
+                                           blueprint->GetAllowNonUniformDerivatives()));
+#else
+        UNREACHABLE();
+#endif  // TINT_BUILD_SPV_READER
+    }
+    blueprint->SetProgram(std::move(parsed));
+
+    return cache->Insert(std::move(blueprint));
+}
+
 std::vector<uint64_t> GetBindGroupMinBufferSizes(const BindingGroupInfoMap& shaderBindings,
                                                  const BindGroupLayoutBase* layout) {
     std::vector<uint64_t> requiredBufferSizes(layout->GetUnverifiedBufferCount());
@@ -891,20 +924,11 @@ bool ShaderModuleParseResult::HasParsedShader() const {
     return tintProgram != nullptr;
 }
 
-// TintSource is a PIMPL container for a tint::Source::File, which needs to be kept alive for as
-// long as tint diagnostics are inspected / printed.
-class TintSource {
-  public:
-    template <typename... ARGS>
-    explicit TintSource(ARGS&&... args) : file(std::forward<ARGS>(args)...) {}
-
-    tint::Source::File file;
-};
-
 MaybeError ValidateAndParseShaderModule(DeviceBase* device,
                                         const ShaderModuleDescriptor* descriptor,
                                         ShaderModuleParseResult* parseResult,
-                                        OwnedCompilationMessages* outMessages) {
+                                        OwnedCompilationMessages* outMessages,
+                                        bool dumpShaders) {
     ASSERT(parseResult != nullptr);
 
     const ChainedStruct* chainedDescriptor = descriptor->nextInChain;
@@ -939,6 +963,8 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
 
     DAWN_INVALID_IF(spirvOptions != nullptr && spirvDesc == nullptr,
                     "SPIR-V options descriptor can only be used with SPIR-V input");
+    const bool allowNonUniformDerivatives =
+        spirvOptions != nullptr && spirvOptions->allowNonUniformDerivatives;
 
     // We have a temporary toggle to force the SPIRV ingestion to go through a WGSL
     // intermediate step. It is done by switching the spirvDesc for a wgslDesc below.
@@ -948,7 +974,7 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
 #if TINT_BUILD_WGSL_WRITER
         std::vector<uint32_t> spirv(spirvDesc->code, spirvDesc->code + spirvDesc->codeSize);
         tint::Program program;
-        DAWN_TRY_ASSIGN(program, ParseSPIRV(spirv, outMessages, spirvOptions));
+        DAWN_TRY_ASSIGN(program, ParseSPIRV(spirv, outMessages, allowNonUniformDerivatives));
 
         tint::writer::wgsl::Options options;
         auto result = tint::writer::wgsl::Generate(&program, options);
@@ -970,9 +996,11 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
         DAWN_INVALID_IF(device->IsToggleEnabled(Toggle::DisallowSpirv), "SPIR-V is disallowed.");
 
         std::vector<uint32_t> spirv(spirvDesc->code, spirvDesc->code + spirvDesc->codeSize);
-        tint::Program program;
-        DAWN_TRY_ASSIGN(program, ParseSPIRV(spirv, outMessages, spirvOptions));
-        parseResult->tintProgram = std::make_unique<tint::Program>(std::move(program));
+        DAWN_TRY_ASSIGN(parseResult->tintProgram,
+                        GetOrParseTintProgram(device,
+                                              SharedTintProgram::CreateFromSPIRV(
+                                                  std::move(spirv), allowNonUniformDerivatives),
+                                              outMessages));
 
         return {};
     }
@@ -985,18 +1013,15 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
                     "At least one of ShaderModuleWGSLDescriptor.source or "
                     "ShaderModuleWGSLDescriptor.code must be set.");
 
-    auto tintSource = std::make_unique<TintSource>("", code);
-
-    if (device->IsToggleEnabled(Toggle::DumpShaders)) {
+    if (dumpShaders && device->IsToggleEnabled(Toggle::DumpShaders)) {
         std::ostringstream dumpedMsg;
         dumpedMsg << "// Dumped WGSL:" << std::endl << code;
         device->EmitLog(WGPULoggingType_Info, dumpedMsg.str().c_str());
     }
 
-    tint::Program program;
-    DAWN_TRY_ASSIGN(program, ParseWGSL(&tintSource->file, outMessages));
-    parseResult->tintProgram = std::make_unique<tint::Program>(std::move(program));
-    parseResult->tintSource = std::move(tintSource);
+    DAWN_TRY_ASSIGN(
+        parseResult->tintProgram,
+        GetOrParseTintProgram(device, SharedTintProgram::CreateFromWGSL(code), outMessages));
 
     return {};
 }
@@ -1104,6 +1129,11 @@ ShaderModuleBase::ShaderModuleBase(DeviceBase* device,
     if (spirvDesc) {
         mType = Type::Spirv;
         mOriginalSpirv.assign(spirvDesc->code, spirvDesc->code + spirvDesc->codeSize);
+
+        const DawnShaderModuleSPIRVOptionsDescriptor* spirvOptions = nullptr;
+        FindInChain(descriptor->nextInChain, &spirvOptions);
+        mAllowNonUniformDerivatives =
+            spirvOptions != nullptr && spirvOptions->allowNonUniformDerivatives;
     } else if (wgslDesc) {
         mType = Type::Wgsl;
         if (wgslDesc->code) {
@@ -1132,6 +1162,7 @@ void ShaderModuleBase::DestroyImpl() {
         // Do not uncache the actual cached object if we are a blueprint.
         GetDevice()->UncacheShaderModule(this);
     }
+    GetDevice()->GetTintProgramResidencyManager()->Untrack(this);
 }
 
 // static
@@ -1165,9 +1196,44 @@ bool ShaderModuleBase::EqualityFunc::operator()(const ShaderModuleBase* a,
     return a->mType == b->mType && a->mOriginalSpirv == b->mOriginalSpirv && a->mWgsl == b->mWgsl;
 }
 
-const tint::Program* ShaderModuleBase::GetTintProgram() const {
-    ASSERT(mTintProgram);
-    return mTintProgram.get();
+ResultOrError<Ref<SharedTintProgram>> ShaderModuleBase::GetTintProgram() const {
+    TintProgramResidencyManager* residency = GetDevice()->GetTintProgramResidencyManager();
+    Ref<SharedTintProgram> program = residency->Acquire(this);
+    if (program != nullptr) {
+        return std::move(program);
+    }
+
+    // The program was evicted. Parse it again from the source that is kept for the content hash,
+    // going through the same path as the module creation so that toggles apply the same way.
+    ShaderModuleDescriptor descriptor;
+    ShaderModuleWGSLDescriptor wgslDesc;
+    ShaderModuleSPIRVDescriptor spirvDesc;
+    DawnShaderModuleSPIRVOptionsDescriptor spirvOptions;
+    switch (mType) {
+        case Type::Wgsl:
+            wgslDesc.code = mWgsl.c_str();
+            descriptor.nextInChain = &wgslDesc;
+            break;
+        case Type::Spirv:
+            spirvDesc.codeSize = static_cast<uint32_t>(mOriginalSpirv.size());
+            spirvDesc.code = mOriginalSpirv.data();
+            spirvOptions.allowNonUniformDerivatives = mAllowNonUniformDerivatives;
+            spirvDesc.nextInChain = &spirvOptions;
+            descriptor.nextInChain = &spirvDesc;
+            break;
+        case Type::Undefined:
+            UNREACHABLE();
+    }
+
+    ShaderModuleParseResult parseResult;
+    DAWN_TRY(ValidateAndParseShaderModule(GetDevice(), &descriptor, &parseResult, nullptr,
+                                          /* dumpShaders */ false));
+    return residency->MakeResident(this, std::move(parseResult.tintProgram));
+}
+
+void StreamIn(stream::Sink* sink, const ShaderModuleBase& module) {
+    StreamIn(sink, module.mType, module.mOriginalSpirv, module.mAllowNonUniformDerivatives,
+             module.mWgsl);
 }
 
 void ShaderModuleBase::APIGetCompilationInfo(wgpu::CompilationInfoCallback callback,
@@ -1218,10 +1284,10 @@ OwnedCompilationMessages* ShaderModuleBase::GetCompilationMessages() const {
 
 MaybeError ShaderModuleBase::InitializeBase(ShaderModuleParseResult* parseResult,
                                             OwnedCompilationMessages* compilationMessages) {
-    mTintProgram = std::move(parseResult->tintProgram);
-    mTintSource = std::move(parseResult->tintSource);
+    Ref<SharedTintProgram> program = GetDevice()->GetTintProgramResidencyManager()->MakeResident(
+        this, std::move(parseResult->tintProgram));
 
-    DAWN_TRY(ReflectShaderUsingTint(GetDevice(), mTintProgram.get(), compilationMessages,
+    DAWN_TRY(ReflectShaderUsingTint(GetDevice(), program->GetProgram(), compilationMessages,
                                     &mEntryPoints, &mEnabledWGSLExtensions));
     return {};
 }
@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "dawn/common/Constants.h"
+#include "dawn/common/RefCounted.h"
 #include "dawn/common/ityp_array.h"
 #include "dawn/native/BindingInfo.h"
 #include "dawn/native/CachedObject.h"
@@ -89,8 +90,8 @@ using PipelineConstantEntries = std::map<std::string, double>;
 using EntryPointMetadataTable =
     std::unordered_map<std::string, std::unique_ptr<EntryPointMetadata>>;
 
-// Source for a tint program
-class TintSource;
+// A tint program shared by all shader modules created from the same source.
+class SharedTintProgram;
 
 struct ShaderModuleParseResult {
     ShaderModuleParseResult();
@@ -100,14 +101,16 @@ struct ShaderModuleParseResult {
 
     bool HasParsedShader() const;
 
-    std::unique_ptr<tint::Program> tintProgram;
-    std::unique_ptr<TintSource> tintSource;
+    Ref<SharedTintProgram> tintProgram;
 };
 
+// `dumpShaders` is false when parsing again a source that was already dumped when the shader
+// module was created.
 MaybeError ValidateAndParseShaderModule(DeviceBase* device,
                                         const ShaderModuleDescriptor* descriptor,
                                         ShaderModuleParseResult* parseResult,
-                                        OwnedCompilationMessages* outMessages);
+                                        OwnedCompilationMessages* outMessages,
+                                        bool dumpShaders = true);
 MaybeError ValidateCompatibilityWithPipelineLayout(DeviceBase* device,
                                                    const EntryPointMetadata& entryPoint,
                                                    const PipelineLayoutBase* layout);
@@ -279,8 +282,14 @@ class ShaderModuleBase : public ApiObjectBase, public CachedObject {
         bool operator()(const ShaderModuleBase* a, const ShaderModuleBase* b) const;
     };
 
-    // This returns tint program before running transforms.
-    const tint::Program* GetTintProgram() const;
+    // This returns tint program before running transforms. The program may have been evicted to
+    // save memory, in which case it is parsed again from the shader source. The returned
+    // reference keeps the program alive while it is in use.
+    ResultOrError<Ref<SharedTintProgram>> GetTintProgram() const;
+
+    // Streams the original source of the module so that the backends can key their compilation
+    // requests on it and only need the tint program on a cache miss.
+    friend void StreamIn(stream::Sink* sink, const ShaderModuleBase& module);
 
     void APIGetCompilationInfo(wgpu::CompilationInfoCallback callback, void* userdata);
 
@@ -301,12 +310,11 @@ class ShaderModuleBase : public ApiObjectBase, public CachedObject {
     enum class Type { Undefined, Spirv, Wgsl };
     Type mType;
     std::vector<uint32_t> mOriginalSpirv;
+    bool mAllowNonUniformDerivatives = false;
     std::string mWgsl;
 
     EntryPointMetadataTable mEntryPoints;
     WGSLExtensionSet mEnabledWGSLExtensions;
-    std::unique_ptr<tint::Program> mTintProgram;
-    std::unique_ptr<TintSource> mTintSource;  // Keep the tint::Source::File alive
 
     std::unique_ptr<OwnedCompilationMessages> mCompilationMessages;
 };
@@ -82,6 +82,12 @@ namespace dawn::native {
 // would be operations that touch all Nth mips of a 2D array texture without touching the
 // others.
 //
+// Decompressing an aspect only happens on the first partial update so for large 2D array
+// textures most layers are often still compressed with the same data, for example all the
+// layers of an atlas except the one that is being updated. Consecutive compressed layers with
+// the same data are handled as a single run of layers by Iterate(), Update() and Merge() so
+// that the closures are called once per run instead of once per layer.
+//
 // There are several hot code paths that create new SubresourceStorage like the tracking of
 // resource usage per-pass. We don't want to allocate a container for the decompressed data
 // unless we have to because it would dramatically lower performance. Instead
@@ -197,7 +203,15 @@ class SubresourceStorage {
     void DecompressLayer(uint32_t aspectIndex, uint32_t layer);
     void RecompressLayer(uint32_t aspectIndex, uint32_t layer);
 
-    SubresourceRange GetFullLayerRange(Aspect aspect, uint32_t layer) const;
+    SubresourceRange GetFullLayerRange(Aspect aspect,
+                                       uint32_t layer,
+                                       uint32_t layerCount = 1) const;
+
+    // Returns the end of the run of consecutive compressed layers, starting at the compressed
+    // `layer` and ending at most at `layerEnd`, that all have the same data.
+    uint32_t FindCompressedLayerRunEnd(uint32_t aspectIndex,
+                                       uint32_t layer,
+                                       uint32_t layerEnd) const;
 
     // LayerCompressed should never be called when the aspect is compressed otherwise it would
     // need to check that mLayerCompressed is not null before indexing it.
@@ -277,12 +291,20 @@ void SubresourceStorage<T>::Update(const SubresourceRange& range, F&& updateFunc
 
         uint32_t layerEnd = range.baseArrayLayer + range.layerCount;
         for (uint32_t layer = range.baseArrayLayer; layer < layerEnd; layer++) {
-            // Call the updateFunc once for the whole layer if possible or decompress and
-            // fallback to per-level handling.
+            // Call the updateFunc once for the whole run of identical compressed layers if
+            // possible or decompress and fallback to per-level handling. The layers of the run
+            // had the same data so the updated data is copied to all of them.
             if (LayerCompressed(aspectIndex, layer)) {
                 if (fullLayers) {
-                    SubresourceRange updateRange = GetFullLayerRange(aspect, layer);
-                    updateFunc(updateRange, &Data(aspectIndex, layer));
+                    uint32_t runEnd = FindCompressedLayerRunEnd(aspectIndex, layer, layerEnd);
+                    SubresourceRange updateRange =
+                        GetFullLayerRange(aspect, layer, runEnd - layer);
+                    T& data = Data(aspectIndex, layer);
+                    updateFunc(updateRange, &data);
+                    for (uint32_t runLayer = layer + 1; runLayer < runEnd; runLayer++) {
+                        Data(aspectIndex, runLayer) = data;
+                    }
+                    layer = runEnd - 1;
                     continue;
                 }
                 DecompressLayer(aspectIndex, layer);
@@ -339,13 +361,17 @@ void SubresourceStorage<T>::Merge(const SubresourceStorage<U>& other, F&& mergeF
         }
 
         for (uint32_t layer = 0; layer < mArrayLayerCount; layer++) {
-            // Similarly to above, use a fast path if other's layer is compressed.
+            // Similarly to above, use a fast path for the runs of identical compressed layers
+            // of other.
             if (other.LayerCompressed(aspectIndex, layer)) {
+                uint32_t runEnd =
+                    other.FindCompressedLayerRunEnd(aspectIndex, layer, mArrayLayerCount);
                 const U& otherData = other.Data(aspectIndex, layer);
-                Update(GetFullLayerRange(aspect, layer),
+                Update(GetFullLayerRange(aspect, layer, runEnd - layer),
                        [&](const SubresourceRange& subrange, T* data) {
                            mergeFunc(subrange, data, otherData);
                        });
+                layer = runEnd - 1;
                 continue;
             }
 
@@ -390,14 +416,17 @@ R SubresourceStorage<T>::Iterate(F&& iterateFunc) const {
         }
 
         for (uint32_t layer = 0; layer < mArrayLayerCount; layer++) {
-            // Fast path, call iterateFunc on the whole array layer at once.
+            // Fast path, call iterateFunc on the whole run of identical compressed layers at
+            // once.
             if (LayerCompressed(aspectIndex, layer)) {
-                SubresourceRange range = GetFullLayerRange(aspect, layer);
+                uint32_t runEnd = FindCompressedLayerRunEnd(aspectIndex, layer, mArrayLayerCount);
+                SubresourceRange range = GetFullLayerRange(aspect, layer, runEnd - layer);
                 if constexpr (mayError) {
                     DAWN_TRY(iterateFunc(range, Data(aspectIndex, layer)));
                 } else {
                     iterateFunc(range, Data(aspectIndex, layer));
                 }
+                layer = runEnd - 1;
                 continue;
             }
 
@@ -540,8 +569,25 @@ void SubresourceStorage<T>::RecompressLayer(uint32_t aspectIndex, uint32_t layer
 }
 
 template <typename T>
-SubresourceRange SubresourceStorage<T>::GetFullLayerRange(Aspect aspect, uint32_t layer) const {
-    return {aspect, {layer, 1}, {0, mMipLevelCount}};
+SubresourceRange SubresourceStorage<T>::GetFullLayerRange(Aspect aspect,
+                                                          uint32_t layer,
+                                                          uint32_t layerCount) const {
+    return {aspect, {layer, layerCount}, {0, mMipLevelCount}};
+}
+
+template <typename T>
+uint32_t SubresourceStorage<T>::FindCompressedLayerRunEnd(uint32_t aspectIndex,
+                                                          uint32_t layer,
+                                                          uint32_t layerEnd) const {
+    ASSERT(LayerCompressed(aspectIndex, layer));
+    const T& layerData = Data(aspectIndex, layer);
+
+    uint32_t runEnd = layer + 1;
+    while (runEnd < layerEnd && LayerCompressed(aspectIndex, runEnd) &&
+           Data(aspectIndex, runEnd) == layerData) {
+        runEnd++;
+    }
+    return runEnd;
 }
 
 template <typename T>
@@ -745,6 +745,10 @@ MaybeError TextureBase::ValidateCanUseInSubmitNow() const {
     return {};
 }
 
+UsageTrackingSlot* TextureBase::GetUsageTrackingSlot() {
+    return &mUsageTrackingSlot;
+}
+
 bool TextureBase::IsMultisampledTexture() const {
     ASSERT(!IsError());
     return mSampleCount > 1;
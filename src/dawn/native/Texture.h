@@ -23,6 +23,7 @@
 #include "dawn/native/Format.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/ObjectBase.h"
+#include "dawn/native/PassResourceUsage.h"
 #include "dawn/native/Subresource.h"
 
 #include "dawn/native/dawn_platform.h"
@@ -76,6 +77,7 @@ class TextureBase : public ApiObjectBase {
     void SetIsSubresourceContentInitialized(bool isInitialized, const SubresourceRange& range);
 
     MaybeError ValidateCanUseInSubmitNow() const;
+    UsageTrackingSlot* GetUsageTrackingSlot();
 
     bool IsMultisampledTexture() const;
 
@@ -134,6 +136,8 @@ class TextureBase : public ApiObjectBase {
     // is destroyed.
     ApiObjectList mTextureViews;
 
+    UsageTrackingSlot mUsageTrackingSlot;
+
     // TODO(crbug.com/dawn/845): Use a more optimized data structure to save space
     std::vector<bool> mIsSubresourceContentInitializedAtIndex;
 };
@@ -0,0 +1,156 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/TintProgramCache.h"
+
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/ObjectContentHasher.h"
+
+namespace dawn::native {
+
+// static
+Ref<SharedTintProgram> SharedTintProgram::CreateFromWGSL(const char* code) {
+    return AcquireRef(
+        new SharedTintProgram(std::make_unique<tint::Source::File>("", code), {}, false));
+}
+
+// static
+Ref<SharedTintProgram> SharedTintProgram::CreateFromSPIRV(std::vector<uint32_t> spirv,
+                                                          bool allowNonUniformDerivatives) {
+    return AcquireRef(
+        new SharedTintProgram(nullptr, std::move(spirv), allowNonUniformDerivatives));
+}
+
+SharedTintProgram::SharedTintProgram(std::unique_ptr<tint::Source::File> wgslFile,
+                                     std::vector<uint32_t> spirv,
+                                     bool allowNonUniformDerivatives)
+    : mWGSLFile(std::move(wgslFile)),
+      mSpirv(std::move(spirv)),
+      mAllowNonUniformDerivatives(allowNonUniformDerivatives) {
+    ObjectContentHasher recorder;
+    recorder.Record(mWGSLFile != nullptr);
+    if (mWGSLFile != nullptr) {
+        recorder.Record(mWGSLFile->content.data);
+    }
+    recorder.Record(mSpirv);
+    recorder.Record(mAllowNonUniformDerivatives);
+    mContentHash = recorder.GetContentHash();
+}
+
+SharedTintProgram::~SharedTintProgram() = default;
+
+void SharedTintProgram::DeleteThis() {
+    // The cache can still hand out this program until it is removed from it. It uses
+    // TryReference() under its lock so it can't resurrect the program once we got here.
+    if (mCache != nullptr) {
+        mCache->Remove(this);
+    }
+    RefCounted::DeleteThis();
+}
+
+const tint::Source::File* SharedTintProgram::GetWGSLFile() const {
+    return mWGSLFile.get();
+}
+
+const std::vector<uint32_t>& SharedTintProgram::GetSPIRV() const {
+    return mSpirv;
+}
+
+bool SharedTintProgram::GetAllowNonUniformDerivatives() const {
+    return mAllowNonUniformDerivatives;
+}
+
+bool SharedTintProgram::IsParsed() const {
+    return mProgram != nullptr;
+}
+
+const tint::Program* SharedTintProgram::GetProgram() const {
+    ASSERT(IsParsed());
+    return mProgram.get();
+}
+
+void SharedTintProgram::SetProgram(tint::Program program) {
+    ASSERT(!IsParsed());
+    ASSERT(mCache == nullptr);
+    mProgram = std::make_unique<tint::Program>(std::move(program));
+}
+
+size_t SharedTintProgram::HashFunc::operator()(const SharedTintProgram* program) const {
+    return program->mContentHash;
+}
+
+bool SharedTintProgram::EqualityFunc::operator()(const SharedTintProgram* a,
+                                                 const SharedTintProgram* b) const {
+    if ((a->mWGSLFile == nullptr) != (b->mWGSLFile == nullptr)) {
+        return false;
+    }
+    if (a->mWGSLFile != nullptr && a->mWGSLFile->content.data != b->mWGSLFile->content.data) {
+        return false;
+    }
+    return a->mSpirv == b->mSpirv &&
+           a->mAllowNonUniformDerivatives == b->mAllowNonUniformDerivatives;
+}
+
+TintProgramCache::TintProgramCache() = default;
+
+TintProgramCache::~TintProgramCache() {
+    // Programs hold a pointer to the cache, so they must all be gone by now.
+    ASSERT(mPrograms.empty());
+}
+
+Ref<SharedTintProgram> TintProgramCache::Find(SharedTintProgram* blueprint) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto iter = mPrograms.find(blueprint);
+    if (iter == mPrograms.end() || !(*iter)->TryReference()) {
+        // A program that failed TryReference() is being destroyed and will remove itself.
+        return nullptr;
+    }
+    return AcquireRef(*iter);
+}
+
+Ref<SharedTintProgram> TintProgramCache::Insert(Ref<SharedTintProgram> program) {
+    ASSERT(program->IsParsed());
+    ASSERT(program->mCache == nullptr);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto [iter, inserted] = mPrograms.insert(program.Get());
+    if (!inserted) {
+        if ((*iter)->TryReference()) {
+            return AcquireRef(*iter);
+        }
+        // The existing program is being destroyed: replace it. Its Remove() will then see that
+        // it is no longer the entry for its source and leave ours alone.
+        mPrograms.erase(iter);
+        mPrograms.insert(program.Get());
+    }
+    program->mCache = this;
+    return program;
+}
+
+void TintProgramCache::Remove(SharedTintProgram* program) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto iter = mPrograms.find(program);
+    if (iter != mPrograms.end() && *iter == program) {
+        mPrograms.erase(iter);
+    }
+}
+
+size_t TintProgramCache::GetProgramCountForTesting() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mPrograms.size();
+}
+
+}  // namespace dawn::native
@@ -0,0 +1,116 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_NATIVE_TINTPROGRAMCACHE_H_
+#define SRC_DAWN_NATIVE_TINTPROGRAMCACHE_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "dawn/common/RefCounted.h"
+#include "tint/tint.h"
+
+namespace dawn::native {
+
+class TintProgramCache;
+
+// A tint::Program along with the shader source it was parsed from. Once parsed, the program is
+// immutable so it can be shared by all the shader modules, on any device of the instance, that
+// were created from the same source.
+class SharedTintProgram : public RefCounted {
+  public:
+    // Create unparsed programs for a source. They can be used as blueprints to look up an
+    // existing program in the TintProgramCache, or be parsed and inserted in the cache.
+    static Ref<SharedTintProgram> CreateFromWGSL(const char* code);
+    static Ref<SharedTintProgram> CreateFromSPIRV(std::vector<uint32_t> spirv,
+                                                  bool allowNonUniformDerivatives);
+
+    // The file containing the WGSL source, nullptr for SPIR-V programs.
+    const tint::Source::File* GetWGSLFile() const;
+    const std::vector<uint32_t>& GetSPIRV() const;
+    bool GetAllowNonUniformDerivatives() const;
+
+    bool IsParsed() const;
+    const tint::Program* GetProgram() const;
+    // Must only be called once, before the program is shared.
+    void SetProgram(tint::Program program);
+
+    // Functors necessary for the unordered_set<SharedTintProgram*>-based cache. Only the source
+    // and the parsing options are compared, not the resulting program.
+    struct HashFunc {
+        size_t operator()(const SharedTintProgram* program) const;
+    };
+    struct EqualityFunc {
+        bool operator()(const SharedTintProgram* a, const SharedTintProgram* b) const;
+    };
+
+  private:
+    friend class TintProgramCache;
+
+    SharedTintProgram(std::unique_ptr<tint::Source::File> wgslFile,
+                      std::vector<uint32_t> spirv,
+                      bool allowNonUniformDerivatives);
+    ~SharedTintProgram() override;
+
+    void DeleteThis() override;
+
+    // Kept alive for as long as the tint diagnostics referencing it may be inspected / printed.
+    std::unique_ptr<tint::Source::File> mWGSLFile;
+    std::vector<uint32_t> mSpirv;
+    bool mAllowNonUniformDerivatives = false;
+    size_t mContentHash = 0;
+
+    std::unique_ptr<tint::Program> mProgram;
+
+    // The cache this program was inserted in, if any. Guarded by the cache's mutex.
+    TintProgramCache* mCache = nullptr;
+};
+
+// An instance-wide cache of the parsed shader programs. The cache only holds weak references:
+// programs remove themselves from it when the last shader module using them is destroyed.
+class TintProgramCache {
+  public:
+    TintProgramCache();
+    ~TintProgramCache();
+
+    // Returns the parsed program with the same source and options as `blueprint`, or nullptr if
+    // there is none.
+    Ref<SharedTintProgram> Find(SharedTintProgram* blueprint);
+
+    // Inserts a parsed program in the cache and returns it. If an equivalent program was inserted
+    // in the meantime (for example by another device parsing the same source concurrently), that
+    // one is returned instead so that all users share a single copy.
+    Ref<SharedTintProgram> Insert(Ref<SharedTintProgram> program);
+
+    size_t GetProgramCountForTesting() const;
+
+  private:
+    friend class SharedTintProgram;
+
+    // Removes `program` from the cache if it is still the entry for its source.
+    void Remove(SharedTintProgram* program);
+
+    mutable std::mutex mMutex;
+    std::unordered_set<SharedTintProgram*,
+                       SharedTintProgram::HashFunc,
+                       SharedTintProgram::EqualityFunc>
+        mPrograms;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_TINTPROGRAMCACHE_H_
@@ -0,0 +1,105 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/TintProgramResidency.h"
+
+#include <utility>
+
+#include "dawn/common/Assert.h"
+
+namespace dawn::native {
+
+TintProgramResidencyManager::TintProgramResidencyManager() = default;
+
+TintProgramResidencyManager::~TintProgramResidencyManager() {
+    ASSERT(mModules.empty());
+}
+
+void TintProgramResidencyManager::SetBudget(size_t maxResidentPrograms) {
+    std::vector<Ref<SharedTintProgram>> evicted;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mBudget = maxResidentPrograms;
+    EvictOverBudget(&evicted);
+}
+
+Ref<SharedTintProgram> TintProgramResidencyManager::Acquire(const ShaderModuleBase* module) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto iter = mModules.find(module);
+    if (iter == mModules.end() || iter->second.program == nullptr) {
+        return nullptr;
+    }
+
+    Entry& entry = iter->second;
+    mResidentModules.splice(mResidentModules.begin(), mResidentModules, entry.lruPosition);
+    return entry.program;
+}
+
+Ref<SharedTintProgram> TintProgramResidencyManager::MakeResident(const ShaderModuleBase* module,
+                                                                 Ref<SharedTintProgram> program) {
+    ASSERT(program != nullptr);
+    std::vector<Ref<SharedTintProgram>> evicted;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    Entry& entry = mModules[module];
+    if (entry.program != nullptr) {
+        mResidentModules.splice(mResidentModules.begin(), mResidentModules, entry.lruPosition);
+        return entry.program;
+    }
+
+    entry.program = program;
+    mResidentModules.push_front(module);
+    entry.lruPosition = mResidentModules.begin();
+
+    // This can evict `program` right away if the budget is zero, but the caller still gets its
+    // reference for the current use.
+    EvictOverBudget(&evicted);
+    return program;
+}
+
+void TintProgramResidencyManager::Untrack(const ShaderModuleBase* module) {
+    Ref<SharedTintProgram> program;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto iter = mModules.find(module);
+    if (iter == mModules.end()) {
+        return;
+    }
+    if (iter->second.program != nullptr) {
+        mResidentModules.erase(iter->second.lruPosition);
+        program = std::move(iter->second.program);
+    }
+    mModules.erase(iter);
+}
+
+void TintProgramResidencyManager::EvictOverBudget(std::vector<Ref<SharedTintProgram>>* evicted) {
+    while (mResidentModules.size() > mBudget) {
+        Entry& entry = mModules[mResidentModules.back()];
+        evicted->push_back(std::move(entry.program));
+        entry.program = nullptr;
+        mResidentModules.pop_back();
+    }
+}
+
+size_t TintProgramResidencyManager::GetResidentCount() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mResidentModules.size();
+}
+
+size_t TintProgramResidencyManager::GetEvictedCount() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mModules.size() - mResidentModules.size();
+}
+
+}  // namespace dawn::native
@@ -0,0 +1,81 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_NATIVE_TINTPROGRAMRESIDENCY_H_
+#define SRC_DAWN_NATIVE_TINTPROGRAMRESIDENCY_H_
+
+#include <limits>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "dawn/common/RefCounted.h"
+#include "dawn/native/TintProgramCache.h"
+
+namespace dawn::native {
+
+class ShaderModuleBase;
+
+// Holds the tint::Programs of the shader modules of a device. Only the programs of the most
+// recently used modules are kept resident, up to the budget. The other ones are evicted and the
+// modules parse their shader source again when they need their program.
+class TintProgramResidencyManager {
+  public:
+    TintProgramResidencyManager();
+    ~TintProgramResidencyManager();
+
+    // Sets how many modules can keep their program resident. Evicts the programs of the least
+    // recently used modules over the budget.
+    void SetBudget(size_t maxResidentPrograms);
+
+    // Returns the resident program of `module` and marks it as the most recently used, or nullptr
+    // if its program was evicted (or it isn't tracked).
+    Ref<SharedTintProgram> Acquire(const ShaderModuleBase* module);
+
+    // Makes `program` the resident program of `module`, tracking the module if it isn't already.
+    // If another thread made a program resident for the module in the meantime, that one is
+    // returned instead. The returned reference keeps the program alive even if it gets evicted.
+    Ref<SharedTintProgram> MakeResident(const ShaderModuleBase* module,
+                                        Ref<SharedTintProgram> program);
+
+    // Stops tracking `module`, releasing its program if it is resident.
+    void Untrack(const ShaderModuleBase* module);
+
+    size_t GetResidentCount() const;
+    size_t GetEvictedCount() const;
+
+  private:
+    using LRUList = std::list<const ShaderModuleBase*>;
+
+    struct Entry {
+        Ref<SharedTintProgram> program;
+        // The position in mResidentModules, only valid if the program is resident.
+        LRUList::iterator lruPosition;
+    };
+
+    // Evicts programs until the budget is respected. The evicted references are appended to
+    // `evicted` so that the programs are destroyed after the lock is released.
+    void EvictOverBudget(std::vector<Ref<SharedTintProgram>>* evicted);
+
+    mutable std::mutex mMutex;
+    size_t mBudget = std::numeric_limits<size_t>::max();
+    // The modules with a resident program, most recently used first.
+    LRUList mResidentModules;
+    std::unordered_map<const ShaderModuleBase*, Entry> mModules;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_TINTPROGRAMRESIDENCY_H_
@@ -21,6 +21,7 @@
 
 #include "dawn/native/CacheRequest.h"
 #include "dawn/native/Serializable.h"
+#include "dawn/native/ShaderModule.h"
 #include "dawn/native/d3d/d3d_platform.h"
 
 #include "tint/tint.h"
@@ -43,7 +44,7 @@ namespace dawn::native::d3d {
 enum class Compiler { FXC, DXC };
 
 #define HLSL_COMPILATION_REQUEST_MEMBERS(X)                                                      \
-    X(const tint::Program*, inputProgram)                                                        \
+    X(const ShaderModuleBase*, inputModule)                                                      \
     X(std::string_view, entryPointName)                                                          \
     X(SingleShaderStage, stage)                                                                  \
     X(uint32_t, shaderModel)                                                                     \
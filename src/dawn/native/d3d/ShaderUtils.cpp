@@ -19,6 +19,7 @@
 #include <utility>
 #include <vector>
 
+#include "dawn/native/TintProgramCache.h"
 #include "dawn/native/d3d/BlobD3D.h"
 #include "dawn/native/d3d/D3DCompilationRequest.h"
 #include "dawn/native/d3d/D3DError.h"
@@ -172,13 +173,16 @@ ResultOrError<std::string> TranslateToHLSL(
             std::move(r.substituteOverrideConfig).value());
     }
 
+    Ref<SharedTintProgram> inputProgram;
+    DAWN_TRY_ASSIGN(inputProgram, r.inputModule->GetTintProgram());
+
     tint::Program transformedProgram;
     tint::ast::transform::DataMap transformOutputs;
     {
         TRACE_EVENT0(tracePlatform.UnsafeGetValue(), General, "RunTransforms");
         DAWN_TRY_ASSIGN(transformedProgram,
-                        RunTransforms(&transformManager, r.inputProgram, transformInputs,
-                                      &transformOutputs, nullptr));
+                        RunTransforms(&transformManager, inputProgram->GetProgram(),
+                                      transformInputs, &transformOutputs, nullptr));
     }
 
     if (auto* data = transformOutputs.Get<tint::ast::transform::Renamer::Data>()) {
@@ -153,7 +153,7 @@ ResultOrError<d3d::CompiledShader> ShaderModule::Compile(
         substituteOverrideConfig = BuildSubstituteOverridesTransformConfig(programmableStage);
     }
 
-    req.hlsl.inputProgram = GetTintProgram();
+    req.hlsl.inputModule = this;
     req.hlsl.entryPointName = programmableStage.entryPoint.c_str();
     req.hlsl.stage = stage;
     // D3D11 (HLSL SM5.0) doesn't support spaces, so we have to put the firstIndex in the default
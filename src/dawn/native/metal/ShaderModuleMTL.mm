@@ -17,6 +17,7 @@
 #include "dawn/native/BindGroupLayout.h"
 #include "dawn/native/CacheRequest.h"
 #include "dawn/native/Serializable.h"
+#include "dawn/native/TintProgramCache.h"
 #include "dawn/native/TintUtils.h"
 #include "dawn/native/metal/DeviceMTL.h"
 #include "dawn/native/metal/PipelineLayoutMTL.h"
@@ -39,7 +40,7 @@ using OptionalVertexPullingTransformConfig =
 
 #define MSL_COMPILATION_REQUEST_MEMBERS(X)                                                       \
     X(SingleShaderStage, stage)                                                                  \
-    X(const tint::Program*, inputProgram)                                                        \
+    X(const ShaderModuleBase*, inputModule)                                                      \
     X(tint::writer::ArrayLengthFromUniformOptions, arrayLengthFromUniform)                       \
     X(tint::writer::BindingRemapperOptions, bindingRemapper)                                     \
     X(tint::writer::ExternalTextureOptions, externalTextureOptions)                              \
@@ -184,7 +185,7 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
 
     MslCompilationRequest req = {};
     req.stage = stage;
-    req.inputProgram = programmableStage.module->GetTintProgram();
+    req.inputModule = programmableStage.module.Get();
     req.bindingRemapper = std::move(bindingRemapper);
     req.externalTextureOptions = BuildExternalTextureTransformBindings(layout);
     req.vertexPullingTransformConfig = std::move(vertexPullingTransformConfig);
@@ -237,13 +238,16 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
                     std::move(r.substituteOverrideConfig).value());
             }
 
+            Ref<SharedTintProgram> inputProgram;
+            DAWN_TRY_ASSIGN(inputProgram, r.inputModule->GetTintProgram());
+
             tint::Program program;
             tint::ast::transform::DataMap transformOutputs;
             {
                 TRACE_EVENT0(r.tracePlatform.UnsafeGetValue(), General, "RunTransforms");
-                DAWN_TRY_ASSIGN(program,
-                                RunTransforms(&transformManager, r.inputProgram, transformInputs,
-                                              &transformOutputs, nullptr));
+                DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager,
+                                                       inputProgram->GetProgram(), transformInputs,
+                                                       &transformOutputs, nullptr));
             }
 
             std::string remappedEntryPointName;
@@ -22,6 +22,7 @@
 #include "dawn/native/ErrorData.h"
 #include "dawn/native/Instance.h"
 #include "dawn/native/Surface.h"
+#include "dawn/native/TintProgramCache.h"
 #include "dawn/native/TintUtils.h"
 
 #include "tint/tint.h"
@@ -405,9 +406,11 @@ MaybeError ComputePipeline::Initialize() {
             BuildSubstituteOverridesTransformConfig(computeStage));
     }
 
+    Ref<SharedTintProgram> tintProgram;
+    DAWN_TRY_ASSIGN(tintProgram, computeStage.module->GetTintProgram());
     DAWN_TRY_ASSIGN(transformedProgram,
-                    RunTransforms(&transformManager, computeStage.module->GetTintProgram(),
-                                  transformInputs, nullptr, nullptr));
+                    RunTransforms(&transformManager, tintProgram->GetProgram(), transformInputs,
+                                  nullptr, nullptr));
 
     program = &transformedProgram;
 
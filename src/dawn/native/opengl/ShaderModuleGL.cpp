@@ -20,6 +20,7 @@
 #include "dawn/native/BindGroupLayout.h"
 #include "dawn/native/CacheRequest.h"
 #include "dawn/native/Pipeline.h"
+#include "dawn/native/TintProgramCache.h"
 #include "dawn/native/TintUtils.h"
 #include "dawn/native/opengl/DeviceGL.h"
 #include "dawn/native/opengl/PipelineLayoutGL.h"
@@ -58,7 +59,7 @@ tint::writer::glsl::Version::Standard ToTintGLStandard(opengl::OpenGLVersion::St
 using BindingMap = std::unordered_map<tint::writer::BindingPoint, tint::writer::BindingPoint>;
 
 #define GLSL_COMPILATION_REQUEST_MEMBERS(X)                                                      \
-    X(const tint::Program*, inputProgram)                                                        \
+    X(const ShaderModuleBase*, inputModule)                                                      \
     X(std::string, entryPointName)                                                               \
     X(SingleShaderStage, stage)                                                                  \
     X(tint::writer::ExternalTextureOptions, externalTextureOptions)                              \
@@ -179,7 +180,7 @@ ResultOrError<GLuint> ShaderModule::CompileShader(const OpenGLFunctions& gl,
     const CombinedLimits& limits = GetDevice()->GetLimits();
 
     GLSLCompilationRequest req = {};
-    req.inputProgram = GetTintProgram();
+    req.inputModule = this;
     req.stage = stage;
     req.entryPointName = programmableStage.entryPoint;
     req.externalTextureOptions = BuildExternalTextureTransformBindings(layout);
@@ -208,8 +209,11 @@ ResultOrError<GLuint> ShaderModule::CompileShader(const OpenGLFunctions& gl,
                     std::move(r.substituteOverrideConfig).value());
             }
 
+            Ref<SharedTintProgram> inputProgram;
+            DAWN_TRY_ASSIGN(inputProgram, r.inputModule->GetTintProgram());
+
             tint::Program program;
-            DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager, r.inputProgram,
+            DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager, inputProgram->GetProgram(),
                                                    transformInputs, nullptr, nullptr));
 
             if (r.stage == SingleShaderStage::Compute) {
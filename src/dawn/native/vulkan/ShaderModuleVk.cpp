@@ -23,6 +23,7 @@
 #include "dawn/native/CacheRequest.h"
 #include "dawn/native/Serializable.h"
 #include "dawn/native/SpirvValidation.h"
+#include "dawn/native/TintProgramCache.h"
 #include "dawn/native/TintUtils.h"
 #include "dawn/native/vulkan/BindGroupLayoutVk.h"
 #include "dawn/native/vulkan/DeviceVk.h"
@@ -165,7 +166,7 @@ ShaderModule::~ShaderModule() = default;
 
 #define SPIRV_COMPILATION_REQUEST_MEMBERS(X)                                                     \
     X(SingleShaderStage, stage)                                                                  \
-    X(const tint::Program*, inputProgram)                                                        \
+    X(const ShaderModuleBase*, inputModule)                                                      \
     X(tint::writer::BindingRemapperOptions, bindingRemapper)                                     \
     X(tint::writer::ExternalTextureOptions, externalTextureOptions)                              \
     X(std::optional<tint::ast::transform::SubstituteOverride::Config>, substituteOverrideConfig) \
@@ -252,7 +253,7 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
 #if TINT_BUILD_SPV_WRITER
     SpirvCompilationRequest req = {};
     req.stage = stage;
-    req.inputProgram = GetTintProgram();
+    req.inputModule = this;
     req.bindingRemapper = std::move(bindingRemapper);
     req.externalTextureOptions = std::move(externalTextureOptions);
     req.entryPointName = programmableStage.entryPoint;
@@ -294,13 +295,17 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
                     std::move(r.substituteOverrideConfig).value());
             }
 
+            // The program is only needed on a cache miss, if it was evicted it is parsed again now.
+            Ref<SharedTintProgram> inputProgram;
+            DAWN_TRY_ASSIGN(inputProgram, r.inputModule->GetTintProgram());
+
             tint::Program program;
             tint::ast::transform::DataMap transformOutputs;
             {
                 TRACE_EVENT0(r.tracePlatform.UnsafeGetValue(), General, "RunTransforms");
-                DAWN_TRY_ASSIGN(program,
-                                RunTransforms(&transformManager, r.inputProgram, transformInputs,
-                                              &transformOutputs, nullptr));
+                DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager,
+                                                       inputProgram->GetProgram(), transformInputs,
+                                                       &transformOutputs, nullptr));
             }
 
             // Get the entry point name after the renamer pass.
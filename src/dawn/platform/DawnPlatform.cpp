@@ -25,6 +25,13 @@ CachingInterface::CachingInterface() = default;
 
 CachingInterface::~CachingInterface() = default;
 
+std::unique_ptr<WaitableEvent> WorkerTaskPool::PostWorkerTaskWithPriority(
+    PostWorkerTaskCallback callback,
+    void* userdata,
+    WorkerTaskPriority priority) {
+    return PostWorkerTask(callback, userdata);
+}
+
 Platform::Platform() = default;
 
 Platform::~Platform() = default;
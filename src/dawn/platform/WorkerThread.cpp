@@ -14,77 +14,146 @@
 
 #include "dawn/platform/WorkerThread.h"
 
-#include <condition_variable>
-#include <functional>
-#include <thread>
+#include <algorithm>
+#include <atomic>
+#include <utility>
 
 #include "dawn/common/Assert.h"
 
-namespace {
+namespace dawn::platform {
 
-class AsyncWaitableEventImpl {
+// The task and its completion state share a single allocation. Checking for completion is a
+// single atomic load; the mutex is only taken to block in Wait() or to wake up waiters.
+class AsyncWorkerTask {
   public:
-    AsyncWaitableEventImpl() : mIsComplete(false) {}
-
-    void Wait() {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mCondition.wait(lock, [this] { return mIsComplete; });
-    }
+    AsyncWorkerTask(PostWorkerTaskCallback callback, void* userdata)
+        : mCallback(callback), mUserdata(userdata) {}
 
-    bool IsComplete() {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mIsComplete;
-    }
-
-    void MarkAsComplete() {
+    void Run() {
+        mCallback(mUserdata);
         {
             std::lock_guard<std::mutex> lock(mMutex);
-            mIsComplete = true;
+            mIsComplete.store(true, std::memory_order_release);
         }
         mCondition.notify_all();
     }
 
+    void Wait() {
+        if (IsComplete()) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mIsComplete.load(std::memory_order_relaxed); });
+    }
+
+    bool IsComplete() const { return mIsComplete.load(std::memory_order_acquire); }
+
   private:
+    PostWorkerTaskCallback mCallback;
+    void* mUserdata;
+
+    std::atomic<bool> mIsComplete{false};
     std::mutex mMutex;
     std::condition_variable mCondition;
-    bool mIsComplete;
 };
 
-class AsyncWaitableEvent final : public dawn::platform::WaitableEvent {
+namespace {
+
+class AsyncWaitableEvent final : public WaitableEvent {
   public:
-    AsyncWaitableEvent() : mWaitableEventImpl(std::make_shared<AsyncWaitableEventImpl>()) {}
+    explicit AsyncWaitableEvent(std::shared_ptr<AsyncWorkerTask> task) : mTask(std::move(task)) {}
 
-    void Wait() override { mWaitableEventImpl->Wait(); }
+    void Wait() override { mTask->Wait(); }
 
-    bool IsComplete() override { return mWaitableEventImpl->IsComplete(); }
-
-    std::shared_ptr<AsyncWaitableEventImpl> GetWaitableEventImpl() const {
-        return mWaitableEventImpl;
-    }
+    bool IsComplete() override { return mTask->IsComplete(); }
 
   private:
-    std::shared_ptr<AsyncWaitableEventImpl> mWaitableEventImpl;
+    std::shared_ptr<AsyncWorkerTask> mTask;
 };
 
 }  // anonymous namespace
 
-namespace dawn::platform {
+AsyncWorkerThreadPool::AsyncWorkerThreadPool(uint32_t maxThreadCount)
+    : mMaxThreadCount(maxThreadCount != 0
+                          ? maxThreadCount
+                          : std::max(1u, std::thread::hardware_concurrency())) {}
 
-std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
-    dawn::platform::PostWorkerTaskCallback callback,
+AsyncWorkerThreadPool::~AsyncWorkerThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIsShuttingDown = true;
+    }
+    mCondition.notify_all();
+
+    // Worker threads drain the remaining queued tasks before exiting so that nothing waiting
+    // on a WaitableEvent is left hanging.
+    for (std::thread& thread : mThreads) {
+        thread.join();
+    }
+}
+
+std::unique_ptr<WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
+    PostWorkerTaskCallback callback,
     void* userdata) {
-    std::unique_ptr<AsyncWaitableEvent> waitableEvent = std::make_unique<AsyncWaitableEvent>();
+    return PostWorkerTaskWithPriority(callback, userdata, WorkerTaskPriority::Normal);
+}
 
-    std::function<void()> doTask = [callback, userdata,
-                                    waitableEventImpl = waitableEvent->GetWaitableEventImpl()]() {
-        callback(userdata);
-        waitableEventImpl->MarkAsComplete();
-    };
+std::unique_ptr<WaitableEvent> AsyncWorkerThreadPool::PostWorkerTaskWithPriority(
+    PostWorkerTaskCallback callback,
+    void* userdata,
+    WorkerTaskPriority priority) {
+    auto task = std::make_shared<AsyncWorkerTask>(callback, userdata);
 
-    std::thread thread(doTask);
-    thread.detach();
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        ASSERT(!mIsShuttingDown);
+        mQueues[static_cast<size_t>(priority)].push_back(task);
 
-    return waitableEvent;
+        // Only spawn a new thread when the idle ones can't pick up all the queued tasks.
+        size_t queuedTaskCount = 0;
+        for (const auto& queue : mQueues) {
+            queuedTaskCount += queue.size();
+        }
+        if (queuedTaskCount > mIdleThreadCount && mThreads.size() < mMaxThreadCount) {
+            mThreads.emplace_back([this] { ThreadLoop(); });
+        }
+    }
+    mCondition.notify_one();
+
+    return std::make_unique<AsyncWaitableEvent>(std::move(task));
+}
+
+uint32_t AsyncWorkerThreadPool::GetMaxThreadCount() const {
+    return mMaxThreadCount;
+}
+
+void AsyncWorkerThreadPool::ThreadLoop() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        std::shared_ptr<AsyncWorkerTask> task;
+        for (auto& queue : mQueues) {
+            if (!queue.empty()) {
+                task = std::move(queue.front());
+                queue.pop_front();
+                break;
+            }
+        }
+
+        if (task == nullptr) {
+            if (mIsShuttingDown) {
+                return;
+            }
+            mIdleThreadCount++;
+            mCondition.wait(lock);
+            mIdleThreadCount--;
+            continue;
+        }
+
+        lock.unlock();
+        task->Run();
+        task = nullptr;
+        lock.lock();
+    }
 }
 
 }  // namespace dawn::platform
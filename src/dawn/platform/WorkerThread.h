@@ -15,18 +15,56 @@
 #ifndef SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 #define SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 
+#include <array>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "dawn/common/NonCopyable.h"
 #include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::platform {
 
-class AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool, public NonCopyable {
+class AsyncWorkerTask;
+
+// A fixed-size pool of persistent worker threads. Threads are created lazily on the first posted
+// task, up to the hardware concurrency, and are joined when the pool is destroyed after all the
+// queued tasks have run. Tasks with a higher priority are always dequeued before tasks with a
+// lower priority. Tasks of the same priority run in FIFO order.
+class DAWN_PLATFORM_EXPORT AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool,
+                                                  public NonCopyable {
   public:
+    // A `maxThreadCount` of 0 sizes the pool to std::thread::hardware_concurrency().
+    explicit AsyncWorkerThreadPool(uint32_t maxThreadCount = 0);
+    ~AsyncWorkerThreadPool() override;
+
     std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
         dawn::platform::PostWorkerTaskCallback callback,
         void* userdata) override;
+    std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTaskWithPriority(
+        dawn::platform::PostWorkerTaskCallback callback,
+        void* userdata,
+        dawn::platform::WorkerTaskPriority priority) override;
+
+    uint32_t GetMaxThreadCount() const;
+
+  private:
+    static constexpr size_t kPriorityCount = 3;
+
+    void ThreadLoop();
+
+    const uint32_t mMaxThreadCount;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    // All members below are protected by mMutex.
+    std::array<std::deque<std::shared_ptr<AsyncWorkerTask>>, kPriorityCount> mQueues;
+    std::vector<std::thread> mThreads;
+    uint32_t mIdleThreadCount = 0;
+    bool mIsShuttingDown = false;
 };
 
 }  // namespace dawn::platform
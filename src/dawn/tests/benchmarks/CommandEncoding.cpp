@@ -0,0 +1,268 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <vector>
+
+#include "dawn/native/CommandAllocator.h"
+#include "dawn/native/Device.h"
+#include "dawn/tests/benchmarks/NullDeviceSetup.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+static constexpr char kShader[] = R"(
+    @vertex fn vs() -> @builtin(position) vec4f {
+        return vec4f();
+    }
+    @fragment fn fs() -> @location(0) vec4f {
+        return vec4f();
+    }
+)";
+
+// Encodes a render bundle with state.range(0) draws per iteration, like an application that
+// re-encodes its draws each frame, and reports how many command blocks had to be allocated per
+// draw. The blocks of the bundles that were destroyed are reused by the next encoders so the
+// allocations per draw should drop to ~0 after the first iteration.
+static void EncodeRenderBundleDraws(benchmark::State& state) {
+    wgpu::Device device = CreateNullDevice({});
+
+    wgpu::ShaderModuleWGSLDescriptor wgslDesc;
+    wgslDesc.code = kShader;
+    wgpu::ShaderModuleDescriptor shaderDesc;
+    shaderDesc.nextInChain = &wgslDesc;
+    wgpu::ShaderModule module = device.CreateShaderModule(&shaderDesc);
+
+    wgpu::ColorTargetState target;
+    target.format = wgpu::TextureFormat::RGBA8Unorm;
+    wgpu::FragmentState fragment;
+    fragment.module = module;
+    fragment.entryPoint = "fs";
+    fragment.targetCount = 1;
+    fragment.targets = &target;
+    wgpu::RenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.vertex.module = module;
+    pipelineDesc.vertex.entryPoint = "vs";
+    pipelineDesc.fragment = &fragment;
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    wgpu::RenderBundleEncoderDescriptor bundleDesc;
+    bundleDesc.colorFormatsCount = 1;
+    bundleDesc.colorFormats = &target.format;
+
+    const dawn::native::CommandBlockPool* pool =
+        dawn::native::FromAPI(device.Get())->GetCommandBlockPool();
+    uint64_t allocatedBlockCount = pool->GetAllocatedBlockCountForTesting();
+
+    for (auto _ : state) {
+        wgpu::RenderBundleEncoder encoder = device.CreateRenderBundleEncoder(&bundleDesc);
+        encoder.SetPipeline(pipeline);
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            encoder.Draw(3);
+        }
+        wgpu::RenderBundle bundle = encoder.Finish();
+        benchmark::DoNotOptimize(bundle.Get());
+    }
+
+    uint64_t drawCount = state.iterations() * state.range(0);
+    state.counters["blockAllocationsPerDraw"] =
+        static_cast<double>(pool->GetAllocatedBlockCountForTesting() - allocatedBlockCount) /
+        drawCount;
+    state.SetItemsProcessed(drawCount);
+}
+
+BENCHMARK(EncodeRenderBundleDraws)
+    ->Setup(SetupNullBackend)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+
+// Encodes a compute pass with 1000 dispatches per iteration that each set a bind group with four
+// uniform buffers, cycling through state.range(0) different bind groups. This stresses the
+// tracking of the resource usages of each synchronization scope.
+static void EncodeComputePassSetBindGroups(benchmark::State& state) {
+    wgpu::Device device = CreateNullDevice({});
+    constexpr uint32_t kDispatchCount = 1000;
+    constexpr uint32_t kBindingCount = 4;
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, R"(
+        @group(0) @binding(0) var<uniform> u0 : vec4f;
+        @group(0) @binding(1) var<uniform> u1 : vec4f;
+        @group(0) @binding(2) var<uniform> u2 : vec4f;
+        @group(0) @binding(3) var<uniform> u3 : vec4f;
+        @compute @workgroup_size(1) fn main() {
+            _ = u0 + u1 + u2 + u3;
+        }
+    )");
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Uniform},
+                 {1, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Uniform},
+                 {2, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Uniform},
+                 {3, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Uniform}});
+
+    wgpu::ComputePipelineDescriptor pipelineDesc;
+    pipelineDesc.layout = utils::MakeBasicPipelineLayout(device, &bgl);
+    pipelineDesc.compute.module = module;
+    pipelineDesc.compute.entryPoint = "main";
+    wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&pipelineDesc);
+
+    std::vector<wgpu::BindGroup> bindGroups;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        std::vector<wgpu::Buffer> buffers;
+        for (uint32_t j = 0; j < kBindingCount; ++j) {
+            buffers.push_back(utils::CreateBufferFromData<float>(
+                device, wgpu::BufferUsage::Uniform, {0.f, 0.f, 0.f, 0.f}));
+        }
+        bindGroups.push_back(utils::MakeBindGroup(
+            device, bgl, {{0, buffers[0]}, {1, buffers[1]}, {2, buffers[2]}, {3, buffers[3]}}));
+    }
+
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+        pass.SetPipeline(pipeline);
+        for (uint32_t i = 0; i < kDispatchCount; ++i) {
+            pass.SetBindGroup(0, bindGroups[i % bindGroups.size()]);
+            pass.DispatchWorkgroups(1);
+        }
+        pass.End();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        benchmark::DoNotOptimize(commands.Get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * kDispatchCount);
+}
+
+BENCHMARK(EncodeComputePassSetBindGroups)->Setup(SetupNullBackend)->Arg(1)->Arg(16)->Arg(256);
+
+// Encodes a render bundle with 1000 draws per iteration that each set a bind group with a uniform
+// buffer, cycling through state.range(0) different bind groups. After the first iteration, the
+// validation of the pipeline and bind groups of each draw is skipped because its result is cached
+// by the device.
+static void EncodeRenderBundleSetBindGroupDraws(benchmark::State& state) {
+    wgpu::Device device = CreateNullDevice({});
+    constexpr uint32_t kDrawCount = 1000;
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, R"(
+        @group(0) @binding(0) var<uniform> u : vec4f;
+        @vertex fn vs() -> @builtin(position) vec4f {
+            return u;
+        }
+        @fragment fn fs() -> @location(0) vec4f {
+            return vec4f();
+        }
+    )");
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Vertex, wgpu::BufferBindingType::Uniform}});
+
+    utils::ComboRenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.layout = utils::MakeBasicPipelineLayout(device, &bgl);
+    pipelineDesc.vertex.module = module;
+    pipelineDesc.vertex.entryPoint = "vs";
+    pipelineDesc.cFragment.module = module;
+    pipelineDesc.cFragment.entryPoint = "fs";
+    pipelineDesc.cTargets[0].format = wgpu::TextureFormat::RGBA8Unorm;
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    std::vector<wgpu::BindGroup> bindGroups;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        wgpu::Buffer buffer = utils::CreateBufferFromData<float>(device, wgpu::BufferUsage::Uniform,
+                                                                 {0.f, 0.f, 0.f, 0.f});
+        bindGroups.push_back(utils::MakeBindGroup(device, bgl, {{0, buffer}}));
+    }
+
+    wgpu::RenderBundleEncoderDescriptor bundleDesc;
+    bundleDesc.colorFormatsCount = 1;
+    bundleDesc.colorFormats = &pipelineDesc.cTargets[0].format;
+
+    for (auto _ : state) {
+        wgpu::RenderBundleEncoder encoder = device.CreateRenderBundleEncoder(&bundleDesc);
+        encoder.SetPipeline(pipeline);
+        for (uint32_t i = 0; i < kDrawCount; ++i) {
+            encoder.SetBindGroup(0, bindGroups[i % bindGroups.size()]);
+            encoder.Draw(3);
+        }
+        wgpu::RenderBundle bundle = encoder.Finish();
+        benchmark::DoNotOptimize(bundle.Get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * kDrawCount);
+}
+
+BENCHMARK(EncodeRenderBundleSetBindGroupDraws)
+    ->Setup(SetupNullBackend)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(256);
+
+// Executes state.range(0) render bundles in a render pass per iteration. Each bundle sets its own
+// bind group and draws 10 times, like the static geometry of a scene that is recorded once.
+static void ExecuteBundles(benchmark::State& state) {
+    wgpu::Device device = CreateNullDevice({});
+    constexpr uint32_t kDrawsPerBundle = 10;
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, R"(
+        @group(0) @binding(0) var<uniform> u : vec4f;
+        @vertex fn vs() -> @builtin(position) vec4f {
+            return u;
+        }
+        @fragment fn fs() -> @location(0) vec4f {
+            return vec4f();
+        }
+    )");
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Vertex, wgpu::BufferBindingType::Uniform}});
+
+    utils::ComboRenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.layout = utils::MakeBasicPipelineLayout(device, &bgl);
+    pipelineDesc.vertex.module = module;
+    pipelineDesc.vertex.entryPoint = "vs";
+    pipelineDesc.cFragment.module = module;
+    pipelineDesc.cFragment.entryPoint = "fs";
+    pipelineDesc.cTargets[0].format = wgpu::TextureFormat::RGBA8Unorm;
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    wgpu::RenderBundleEncoderDescriptor bundleDesc;
+    bundleDesc.colorFormatsCount = 1;
+    bundleDesc.colorFormats = &pipelineDesc.cTargets[0].format;
+
+    std::vector<wgpu::RenderBundle> bundles;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        wgpu::Buffer buffer = utils::CreateBufferFromData<float>(device, wgpu::BufferUsage::Uniform,
+                                                                 {0.f, 0.f, 0.f, 0.f});
+        wgpu::RenderBundleEncoder encoder = device.CreateRenderBundleEncoder(&bundleDesc);
+        encoder.SetPipeline(pipeline);
+        encoder.SetBindGroup(0, utils::MakeBindGroup(device, bgl, {{0, buffer}}));
+        for (uint32_t j = 0; j < kDrawsPerBundle; ++j) {
+            encoder.Draw(3);
+        }
+        bundles.push_back(encoder.Finish());
+    }
+
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.ExecuteBundles(static_cast<uint32_t>(bundles.size()), bundles.data());
+        pass.End();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        benchmark::DoNotOptimize(commands.Get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ExecuteBundles)->Setup(SetupNullBackend)->Arg(1)->Arg(10)->Arg(1000);
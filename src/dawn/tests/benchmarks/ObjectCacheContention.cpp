@@ -0,0 +1,82 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <vector>
+
+#include "dawn/tests/benchmarks/NullDeviceSetup.h"
+
+// Each thread repeatedly creates and releases cached objects (samplers, bind group layouts and
+// pipeline layouts) on a shared device. The creation and release of these objects, including the
+// lookups in the device's object caches, run under the device lock, so this measures how object
+// creation scales with the threads contending on that lock. With range(0) == 0 all threads create
+// identical objects and hit the same cache entries. Otherwise each thread uses its own descriptors.
+static void CachedObjectContention(benchmark::State& state) {
+    static wgpu::Device device = nullptr;
+
+    if (state.thread_index() == 0) {
+        std::vector<wgpu::FeatureName> requiredFeatures;
+        if (state.threads() > 1) {
+            requiredFeatures.push_back(wgpu::FeatureName::ImplicitDeviceSynchronization);
+        }
+
+        wgpu::DeviceDescriptor deviceDesc = {};
+        deviceDesc.requiredFeatures = requiredFeatures.data();
+        deviceDesc.requiredFeaturesCount = requiredFeatures.size();
+        device = CreateNullDevice(deviceDesc);
+    }
+
+    const bool distinct = state.range(0) != 0;
+    const float threadOffset = distinct ? static_cast<float>(state.thread_index()) : 0.0f;
+
+    wgpu::SamplerDescriptor samplerDesc = {};
+    samplerDesc.lodMinClamp = threadOffset;
+    samplerDesc.lodMaxClamp = threadOffset + 1.0f;
+
+    wgpu::BindGroupLayoutEntry entry = {};
+    entry.binding = distinct ? state.thread_index() : 0;
+    entry.visibility = wgpu::ShaderStage::Fragment;
+    entry.buffer.type = wgpu::BufferBindingType::Uniform;
+
+    wgpu::BindGroupLayoutDescriptor bglDesc = {};
+    bglDesc.entryCount = 1;
+    bglDesc.entries = &entry;
+
+    for (auto _ : state) {
+        wgpu::Sampler sampler = device.CreateSampler(&samplerDesc);
+        wgpu::BindGroupLayout bgl = device.CreateBindGroupLayout(&bglDesc);
+
+        wgpu::PipelineLayoutDescriptor plDesc = {};
+        plDesc.bindGroupLayoutCount = 1;
+        plDesc.bindGroupLayouts = &bgl;
+        wgpu::PipelineLayout layout = device.CreatePipelineLayout(&plDesc);
+
+        benchmark::DoNotOptimize(sampler.Get());
+        benchmark::DoNotOptimize(layout.Get());
+    }
+    state.SetItemsProcessed(state.iterations() * 3);
+
+    if (state.thread_index() == 0) {
+        device = nullptr;
+    }
+}
+
+BENCHMARK(CachedObjectContention)
+    ->Setup(SetupNullBackend)
+    ->ArgName("distinct")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
@@ -0,0 +1,42 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// dawn_trace_to_json converts a trace recorded by utils::BinaryTracePlatform to the JSON trace
+// format that can be loaded in chrome://tracing or https://ui.perfetto.dev.
+//
+// Usage: dawn_trace_to_json <trace> <json>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include "dawn/utils/BinaryTracePlatform.h"
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <trace> <json>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream json(argv[2], std::ios_base::out | std::ios_base::trunc);
+    if (!json.is_open()) {
+        fprintf(stderr, "Failed to open %s.\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+    if (!utils::ConvertBinaryTraceToJSON(argv[1], &json)) {
+        fprintf(stderr, "Failed to convert the trace %s.\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
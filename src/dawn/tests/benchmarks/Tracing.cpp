@@ -0,0 +1,61 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <memory>
+
+#include "dawn/platform/tracing/TraceEvent.h"
+#include "dawn/utils/BinaryTracePlatform.h"
+
+namespace {
+
+constexpr const char kTracePath[] = "dawn_benchmarks_trace.bin";
+constexpr size_t kEventsPerFlush = 4096;
+
+std::unique_ptr<utils::BinaryTracePlatform> gTracePlatform;
+
+void SetupTracePlatform(const benchmark::State& state) {
+    gTracePlatform = utils::BinaryTracePlatform::Create(kTracePath, kEventsPerFlush);
+}
+
+void TeardownTracePlatform(const benchmark::State& state) {
+    gTracePlatform = nullptr;
+    std::remove(kTracePath);
+}
+
+// Records scoped trace events, which add two events each, on each thread. The buffers are flushed
+// regularly so that the cost of writing the events to the file is included.
+void RecordScopedTraceEvents(benchmark::State& state) {
+    dawn::platform::Platform* platform = gTracePlatform.get();
+    size_t eventCount = 0;
+    for (auto _ : state) {
+        TRACE_EVENT0(platform, Recording, "RecordScopedTraceEvents");
+        eventCount += 2;
+        if (eventCount >= kEventsPerFlush) {
+            gTracePlatform->Flush();
+            eventCount = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+    state.counters["dropped"] = gTracePlatform->GetDroppedEventCount();
+}
+
+}  // anonymous namespace
+
+BENCHMARK(RecordScopedTraceEvents)
+    ->Setup(SetupTracePlatform)
+    ->Teardown(TeardownTracePlatform)
+    ->Threads(1)
+    ->Threads(4);
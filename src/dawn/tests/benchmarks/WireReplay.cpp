@@ -0,0 +1,299 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// dawn_wire_replay replays the client to server commands of a recording made with
+// utils::WireRecorder into a WireServer on the null backend, as fast as possible, and reports how
+// much time the server spent handling each type of command. Since the null backend does almost no
+// work, this measures the cost of the wire deserialization and of the frontend validation.
+// --trace records the trace events of the replay with utils::BinaryTracePlatform, see
+// dawn_trace_to_json to view them.
+//
+// Usage: dawn_wire_replay [--iterations=<count>] [--trace=<path>] <recording>
+
+#include <dawn/webgpu_cpp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "dawn/dawn_proc.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/utils/BinaryTracePlatform.h"
+#include "dawn/utils/WireRecorder.h"
+#include "dawn/wire/WireCmd_autogen.h"
+#include "dawn/wire/WireServer.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Declared first so that it outlives the instance that uses it.
+std::unique_ptr<utils::BinaryTracePlatform> gTracePlatform;
+std::unique_ptr<dawn::native::Instance> gNativeInstance;
+wgpu::Adapter gNullAdapter;
+
+bool SetupNullBackend() {
+    dawnProcSetProcs(&dawn::native::GetProcs());
+    gNativeInstance = std::make_unique<dawn::native::Instance>();
+    gNativeInstance->DiscoverDefaultAdapters();
+    for (dawn::native::Adapter& adapter : gNativeInstance->GetAdapters()) {
+        wgpu::AdapterProperties properties;
+        adapter.GetProperties(&properties);
+        if (properties.backendType == wgpu::BackendType::Null) {
+            gNullAdapter = wgpu::Adapter(adapter.Get());
+            return true;
+        }
+    }
+    return false;
+}
+
+// The recorded application may have requested any adapter, but the replay always uses the null
+// backend.
+void RequestNullAdapter(WGPUInstance instance,
+                        const WGPURequestAdapterOptions* options,
+                        WGPURequestAdapterCallback callback,
+                        void* userdata) {
+    // The callback takes ownership of the adapter.
+    wgpu::Adapter adapter = gNullAdapter;
+    callback(WGPURequestAdapterStatus_Success, adapter.MoveToCHandle(), nullptr, userdata);
+}
+
+wgpu::Device CreateNullDevice() {
+    struct Request {
+        bool done = false;
+        wgpu::Device device;
+    } request;
+    gNullAdapter.RequestDevice(
+        nullptr,
+        [](WGPURequestDeviceStatus status, WGPUDevice cDevice, char const* message,
+           void* userdata) {
+            Request* request = static_cast<Request*>(userdata);
+            request->done = true;
+            if (status == WGPURequestDeviceStatus_Success) {
+                request->device = wgpu::Device::Acquire(cDevice);
+            }
+        },
+        &request);
+    while (!request.done) {
+        wgpuInstanceProcessEvents(gNativeInstance->Get());
+    }
+    return request.device;
+}
+
+// The server's return commands aren't needed for the replay so they are discarded.
+class DiscardCommandSerializer : public dawn::wire::CommandSerializer {
+  public:
+    size_t GetMaximumAllocationSize() const override { return mBuffer.size(); }
+
+    // Commands are fully serialized before the space for the next one is requested, so the same
+    // space can be returned each time.
+    void* GetCmdSpace(size_t size) override { return mBuffer.data(); }
+    bool Flush() override { return true; }
+
+  private:
+    std::vector<char> mBuffer = std::vector<char>(1024 * 1024);
+};
+
+struct CommandStats {
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+    Clock::duration time = Clock::duration::zero();
+};
+
+// Replays the recording once in a new WireServer. Returns false if the server failed to handle a
+// command, which means the recording is corrupt or doesn't match this version of the wire.
+bool Replay(const std::vector<utils::WireRecord>& records,
+            std::map<dawn::wire::WireCmd, CommandStats>* stats) {
+    DawnProcTable procs = dawn::native::GetProcs();
+    procs.instanceRequestAdapter = RequestNullAdapter;
+
+    DiscardCommandSerializer serializer;
+    dawn::wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &procs;
+    serverDesc.serializer = &serializer;
+    dawn::wire::WireServer server(serverDesc);
+
+    // Chunked commands are split across flushes so commands are reassembled before being handled
+    // one at a time.
+    std::vector<char> pending;
+    for (const utils::WireRecord& record : records) {
+        switch (record.type) {
+            case utils::WireRecordType::InjectInstance:
+            case utils::WireRecordType::InjectDevice: {
+                utils::WireRecordInjection injection;
+                memcpy(&injection, record.data.data(), sizeof(injection));
+                bool success = false;
+                if (record.type == utils::WireRecordType::InjectInstance) {
+                    success = server.InjectInstance(gNativeInstance->Get(), injection.id,
+                                                    injection.generation);
+                } else {
+                    wgpu::Device device = CreateNullDevice();
+                    success = device != nullptr &&
+                              server.InjectDevice(device.Get(), injection.id, injection.generation);
+                }
+                if (!success) {
+                    fprintf(stderr, "Failed to inject object %u.\n", injection.id);
+                    return false;
+                }
+                break;
+            }
+
+            case utils::WireRecordType::Commands: {
+                pending.insert(pending.end(), record.data.begin(), record.data.end());
+                size_t offset = 0;
+                while (pending.size() - offset >=
+                       sizeof(dawn::wire::CmdHeader) + sizeof(dawn::wire::WireCmd)) {
+                    dawn::wire::CmdHeader header;
+                    dawn::wire::WireCmd command;
+                    memcpy(&header, &pending[offset], sizeof(header));
+                    memcpy(&command, &pending[offset + sizeof(header)], sizeof(command));
+                    if (header.commandSize < sizeof(header) + sizeof(command)) {
+                        fprintf(stderr, "Invalid command size.\n");
+                        return false;
+                    }
+                    if (header.commandSize > pending.size() - offset) {
+                        break;
+                    }
+
+                    Clock::time_point start = Clock::now();
+                    bool success =
+                        server.HandleCommands(&pending[offset], header.commandSize) != nullptr;
+                    Clock::duration time = Clock::now() - start;
+                    if (!success) {
+                        const char* name = dawn::wire::GetWireCmdName(command);
+                        fprintf(stderr, "The server failed to handle a %s command.\n",
+                                name != nullptr ? name : "unknown");
+                        return false;
+                    }
+
+                    CommandStats& commandStats = (*stats)[command];
+                    commandStats.count++;
+                    commandStats.bytes += header.commandSize;
+                    commandStats.time += time;
+                    offset += header.commandSize;
+                }
+                pending.erase(pending.begin(), pending.begin() + offset);
+                break;
+            }
+
+            case utils::WireRecordType::ReturnCommands:
+                break;
+        }
+    }
+    return true;
+}
+
+double ToMilliseconds(Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    const char* tracePath = nullptr;
+    uint64_t iterations = 1;
+    for (int i = 1; i < argc; ++i) {
+        constexpr const char kIterationsArg[] = "--iterations=";
+        constexpr const char kTraceArg[] = "--trace=";
+        if (strncmp(argv[i], kIterationsArg, strlen(kIterationsArg)) == 0) {
+            iterations = strtoull(argv[i] + strlen(kIterationsArg), nullptr, 10);
+        } else if (strncmp(argv[i], kTraceArg, strlen(kTraceArg)) == 0) {
+            tracePath = argv[i] + strlen(kTraceArg);
+        } else if (path == nullptr && argv[i][0] != '-') {
+            path = argv[i];
+        } else {
+            path = nullptr;
+            break;
+        }
+    }
+    if (path == nullptr || iterations == 0) {
+        fprintf(stderr, "Usage: %s [--iterations=<count>] [--trace=<path>] <recording>\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<utils::WireRecord> records;
+    if (!utils::ReadWireRecording(path, &records)) {
+        fprintf(stderr, "Failed to read the wire recording %s.\n", path);
+        return EXIT_FAILURE;
+    }
+    uint64_t returnBytes = 0;
+    for (const utils::WireRecord& record : records) {
+        if (record.type == utils::WireRecordType::ReturnCommands) {
+            returnBytes += record.data.size();
+        }
+    }
+
+    if (!SetupNullBackend()) {
+        fprintf(stderr, "The null backend isn't available.\n");
+        return EXIT_FAILURE;
+    }
+
+    if (tracePath != nullptr) {
+        gTracePlatform = utils::BinaryTracePlatform::Create(tracePath);
+        if (gTracePlatform == nullptr) {
+            fprintf(stderr, "Failed to create the trace %s.\n", tracePath);
+            return EXIT_FAILURE;
+        }
+        gNativeInstance->SetPlatform(gTracePlatform.get());
+    }
+
+    std::map<dawn::wire::WireCmd, CommandStats> stats;
+    Clock::time_point start = Clock::now();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        if (!Replay(records, &stats)) {
+            return EXIT_FAILURE;
+        }
+        if (gTracePlatform != nullptr) {
+            gTracePlatform->Flush();
+        }
+    }
+    Clock::duration totalTime = Clock::now() - start;
+
+    // Report the commands that took the most time first, per iteration.
+    std::vector<std::pair<dawn::wire::WireCmd, CommandStats>> sortedStats(stats.begin(),
+                                                                          stats.end());
+    std::sort(sortedStats.begin(), sortedStats.end(),
+              [](const auto& a, const auto& b) { return a.second.time > b.second.time; });
+
+    CommandStats total;
+    printf("%-40s %10s %12s %12s %10s\n", "Command", "Count", "Bytes", "Time (ms)", "ns/cmd");
+    for (const auto& [command, commandStats] : sortedStats) {
+        const char* name = dawn::wire::GetWireCmdName(command);
+        printf("%-40s %10llu %12llu %12.3f %10.0f\n", name != nullptr ? name : "Unknown",
+               static_cast<unsigned long long>(commandStats.count / iterations),
+               static_cast<unsigned long long>(commandStats.bytes / iterations),
+               ToMilliseconds(commandStats.time) / iterations,
+               ToMilliseconds(commandStats.time) * 1e6 / commandStats.count);
+        total.count += commandStats.count;
+        total.bytes += commandStats.bytes;
+        total.time += commandStats.time;
+    }
+    printf("%-40s %10llu %12llu %12.3f\n", "Total",
+           static_cast<unsigned long long>(total.count / iterations),
+           static_cast<unsigned long long>(total.bytes / iterations),
+           ToMilliseconds(total.time) / iterations);
+    printf("\nReplayed %llu time(s) in %.3f ms per iteration, including setup. The recording also "
+           "contains %llu bytes of return commands.\n",
+           static_cast<unsigned long long>(iterations), ToMilliseconds(totalTime) / iterations,
+           static_cast<unsigned long long>(returnBytes));
+    return EXIT_SUCCESS;
+}
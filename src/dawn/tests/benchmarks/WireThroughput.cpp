@@ -0,0 +1,129 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/tests/benchmarks/NullDeviceSetup.h"
+#include "dawn/utils/SharedMemoryRingBuffer.h"
+#include "dawn/utils/SharedMemoryTransferService.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+// Sends Queue::WriteBuffer commands of state.range(0) bytes from a wire client to a wire server
+// running on another thread, flushing every state.range(1) commands. Both directions of the wire
+// go through shared memory ring buffers. The data is copied in the commands, or passed in shared
+// memory regions when state.range(2) is 1. Reports the commands and bytes sent per second.
+static void WireWriteBufferThroughput(benchmark::State& state) {
+    constexpr size_t kRingCapacity = 4 * 1024 * 1024;
+    const uint64_t writeSize = state.range(0);
+    const int64_t commandsPerFlush = state.range(1);
+    const bool useSharedMemoryTransfer = state.range(2) != 0;
+
+    std::unique_ptr<utils::SharedMemoryRingBuffer> clientToServer =
+        utils::SharedMemoryRingBuffer::Create(kRingCapacity);
+    std::unique_ptr<utils::SharedMemoryRingBuffer> serverToClient =
+        utils::SharedMemoryRingBuffer::Create(kRingCapacity);
+    if (clientToServer == nullptr || serverToClient == nullptr) {
+        state.SkipWithError("Shared memory isn't supported on this platform.");
+        return;
+    }
+
+    // The inline transfer services are used when none are given.
+    std::unique_ptr<utils::SharedMemoryClientTransferService> clientTransferService;
+    std::unique_ptr<utils::SharedMemoryServerTransferService> serverTransferService;
+    if (useSharedMemoryTransfer) {
+        // Send all the writes by reference to measure the cost of the transfer itself.
+        clientTransferService = std::make_unique<utils::SharedMemoryClientTransferService>(0);
+        serverTransferService = std::make_unique<utils::SharedMemoryServerTransferService>();
+    }
+
+    wgpu::Device device = CreateNullDevice({});
+
+    utils::SharedMemoryCommandSerializer serverSerializer(serverToClient.get());
+    dawn::wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &dawn::native::GetProcs();
+    serverDesc.serializer = &serverSerializer;
+    serverDesc.memoryTransferService = serverTransferService.get();
+    dawn::wire::WireServer server(serverDesc);
+
+    utils::SharedMemoryCommandSerializer clientSerializer(clientToServer.get());
+    dawn::wire::WireClientDescriptor clientDesc = {};
+    clientDesc.serializer = &clientSerializer;
+    clientDesc.memoryTransferService = clientTransferService.get();
+    dawn::wire::WireClient client(clientDesc);
+    utils::SharedMemoryCommandReader clientReader(serverToClient.get(), &client);
+
+    dawn::wire::ReservedDevice reservation = client.ReserveDevice();
+    server.InjectDevice(device.Get(), reservation.id, reservation.generation);
+
+    // From here on the device is only used by the server thread.
+    std::thread serverThread([&] {
+        utils::SharedMemoryCommandReader serverReader(clientToServer.get(), &server);
+        while (serverReader.WaitAndHandleCommands()) {
+            serverSerializer.Flush();
+        }
+    });
+
+    // The client's procs are used directly so that the procs of the other benchmarks stay native.
+    const DawnProcTable& procs = dawn::wire::client::GetProcs();
+    WGPUQueue queue = procs.deviceGetQueue(reservation.device);
+    WGPUBufferDescriptor bufferDesc = {};
+    bufferDesc.size = writeSize;
+    bufferDesc.usage = WGPUBufferUsage_CopyDst;
+    WGPUBuffer buffer = procs.deviceCreateBuffer(reservation.device, &bufferDesc);
+
+    std::vector<uint8_t> data(writeSize, 0x42);
+    int64_t pendingCommands = 0;
+    for (auto _ : state) {
+        procs.queueWriteBuffer(queue, buffer, 0, data.data(), writeSize);
+        if (++pendingCommands == commandsPerFlush) {
+            clientSerializer.Flush();
+            pendingCommands = 0;
+            // The server rarely answers but it would wait on us if its ring got full.
+            clientReader.HandleAvailableCommands();
+        }
+    }
+
+    procs.bufferRelease(buffer);
+    procs.queueRelease(queue);
+    procs.deviceRelease(reservation.device);
+    clientSerializer.Flush();
+
+    // The server handles everything that was flushed before seeing that its ring is closed.
+    clientToServer->Close();
+    serverToClient->Close();
+    serverThread.join();
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * writeSize);
+}
+
+BENCHMARK(WireWriteBufferThroughput)
+    ->Setup(SetupNullBackend)
+    ->ArgsProduct({{16, 256, 4096, 65536}, {1, 64}, {0}})
+    ->ArgNames({"size", "commandsPerFlush", "sharedMemoryTransfer"})
+    ->UseRealTime();
+
+// Compares copying large writes in the commands with passing them in shared memory regions.
+BENCHMARK(WireWriteBufferThroughput)
+    ->Name("WireLargeWriteBufferThroughput")
+    ->Setup(SetupNullBackend)
+    ->ArgsProduct({{4 << 10, 64 << 10, 1 << 20, 16 << 20, 64 << 20}, {1}, {0, 1}})
+    ->ArgNames({"size", "commandsPerFlush", "sharedMemoryTransfer"})
+    ->UseRealTime();
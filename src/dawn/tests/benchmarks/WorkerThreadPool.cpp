@@ -0,0 +1,86 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "dawn/platform/WorkerThread.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct TimedTask {
+    Clock::time_point postTime;
+    Clock::time_point endTime;
+    uint32_t spinIterations;
+};
+
+void RunTimedTask(void* userdata) {
+    TimedTask* task = static_cast<TimedTask*>(userdata);
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < task->spinIterations; ++i) {
+        benchmark::DoNotOptimize(value += i);
+    }
+    task->endTime = Clock::now();
+}
+
+// Posts range(0) tasks of range(1) spin iterations each then waits on all of them. Reports the
+// task throughput and the median and tail post-to-completion latency.
+void PostWorkerTasks(benchmark::State& state) {
+    dawn::platform::AsyncWorkerThreadPool pool;
+
+    std::vector<TimedTask> tasks(state.range(0));
+    std::vector<std::unique_ptr<dawn::platform::WaitableEvent>> events(tasks.size());
+    std::vector<double> latencies;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            tasks[i].spinIterations = static_cast<uint32_t>(state.range(1));
+            tasks[i].postTime = Clock::now();
+            events[i] = pool.PostWorkerTask(RunTimedTask, &tasks[i]);
+        }
+        for (auto& event : events) {
+            event->Wait();
+        }
+
+        for (const TimedTask& task : tasks) {
+            latencies.push_back(
+                std::chrono::duration<double, std::micro>(task.endTime - task.postTime).count());
+        }
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    auto Percentile = [&](double p) {
+        return latencies[std::min(latencies.size() - 1, size_t(p * latencies.size()))];
+    };
+    state.counters["p50_us"] = Percentile(0.50);
+    state.counters["p99_us"] = Percentile(0.99);
+    state.counters["max_us"] = latencies.back();
+    state.SetItemsProcessed(state.iterations() * tasks.size());
+}
+
+}  // anonymous namespace
+
+BENCHMARK(PostWorkerTasks)
+    ->ArgNames({"tasks", "spin"})
+    ->Args({1, 0})
+    ->Args({64, 0})
+    ->Args({1024, 0})
+    ->Args({64, 100000})
+    ->Args({1024, 100000})
+    ->UseRealTime();
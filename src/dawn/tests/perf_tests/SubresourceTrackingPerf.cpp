@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
 #include "dawn/tests/perf_tests/DawnPerfTest.h"
 
 #include "dawn/utils/ComboRenderPipelineDescriptor.h"
@@ -20,18 +22,22 @@
 struct SubresourceTrackingParams : AdapterTestParam {
     SubresourceTrackingParams(const AdapterTestParam& param,
                               uint32_t arrayLayerCountIn,
-                              uint32_t mipLevelCountIn)
+                              uint32_t mipLevelCountIn,
+                              uint32_t uploadedLayerCountIn)
         : AdapterTestParam(param),
           arrayLayerCount(arrayLayerCountIn),
-          mipLevelCount(mipLevelCountIn) {}
+          mipLevelCount(mipLevelCountIn),
+          uploadedLayerCount(uploadedLayerCountIn) {}
     uint32_t arrayLayerCount;
     uint32_t mipLevelCount;
+    uint32_t uploadedLayerCount;
 };
 
 std::ostream& operator<<(std::ostream& ostream, const SubresourceTrackingParams& param) {
     ostream << static_cast<const AdapterTestParam&>(param);
     ostream << "_arrayLayer_" << param.arrayLayerCount;
     ostream << "_mipLevel_" << param.mipLevelCount;
+    ostream << "_uploadedLayers_" << param.uploadedLayerCount;
     return ostream;
 }
 
@@ -39,6 +45,8 @@ std::ostream& operator<<(std::ostream& ostream, const SubresourceTrackingParams&
 // difficult. It uses a 2D array texture with mipmaps and updates one of the layers with data from
 // another texture, then generates mipmaps for that layer. It is difficult because it requires
 // tracking the state of individual subresources in the middle of the subresources of that texture.
+// Large arrays can have several layers uploaded, spread across the array like the updates of a
+// texture atlas, so that their subresources are fragmented in many ranges.
 class SubresourceTrackingPerf : public DawnPerfTestWithParams<SubresourceTrackingParams> {
   public:
     static constexpr unsigned int kNumIterations = 50;
@@ -86,9 +94,21 @@ class SubresourceTrackingPerf : public DawnPerfTestWithParams<SubresourceTrackin
     void Step() override {
         const SubresourceTrackingParams& params = GetParam();
 
-        uint32_t layerUploaded = params.arrayLayerCount / 2;
-
         wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        uint32_t uploadedLayerCount = std::min(params.uploadedLayerCount, params.arrayLayerCount);
+        for (uint32_t i = 0; i < uploadedLayerCount; i++) {
+            uint32_t layerUploaded =
+                (params.arrayLayerCount / 2 + i * params.arrayLayerCount / uploadedLayerCount) %
+                params.arrayLayerCount;
+            EncodeLayerUpload(encoder, layerUploaded);
+        }
+
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+
+    void EncodeLayerUpload(const wgpu::CommandEncoder& encoder, uint32_t layerUploaded) {
+        const SubresourceTrackingParams& params = GetParam();
 
         // Copy into the layer of the material array.
         {
@@ -129,9 +149,6 @@ class SubresourceTrackingPerf : public DawnPerfTestWithParams<SubresourceTrackin
             pass.Draw(3);
             pass.End();
         }
-
-        wgpu::CommandBuffer commands = encoder.Finish();
-        queue.Submit(1, &commands);
     }
 
     wgpu::Texture mUploadTexture;
@@ -146,4 +163,5 @@ TEST_P(SubresourceTrackingPerf, Run) {
 DAWN_INSTANTIATE_TEST_P(SubresourceTrackingPerf,
                         {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend()},
                         {1, 4, 16, 256},
-                        {2, 3, 8});
+                        {2, 3, 8},
+                        {1, 16});
@@ -0,0 +1,192 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "dawn/platform/tracing/TraceEvent.h"
+#include "dawn/utils/BinaryTracePlatform.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+class BinaryTracePlatformTests : public testing::Test {
+  protected:
+    void TearDown() override { std::remove(mPath.c_str()); }
+
+    size_t CountOccurrences(const std::string& json, const std::string& value) {
+        size_t count = 0;
+        for (size_t i = json.find(value); i != std::string::npos; i = json.find(value, i + 1)) {
+            count++;
+        }
+        return count;
+    }
+
+    std::string mPath = testing::TempDir() + "BinaryTracePlatformTests.bin";
+};
+
+// Test that the events of several threads are recorded and converted to JSON.
+TEST_F(BinaryTracePlatformTests, RecordAndConvert) {
+    constexpr size_t kThreadCount = 4;
+    constexpr size_t kEventsPerThread = 100;
+    {
+        std::unique_ptr<utils::BinaryTracePlatform> platform =
+            utils::BinaryTracePlatform::Create(mPath.c_str());
+        ASSERT_NE(platform, nullptr);
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < kThreadCount; ++i) {
+            threads.emplace_back([&]() {
+                for (size_t j = 0; j < kEventsPerThread; ++j) {
+                    TRACE_EVENT0(platform.get(), Validation, "Scoped\"Event");
+                }
+            });
+        }
+        // Flush while the threads are recording events.
+        platform->Flush();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        std::string copiedName = "Copied";
+        copiedName += "Event";
+        TRACE_EVENT_COPY_INSTANT0(platform.get(), General, copiedName.c_str());
+        EXPECT_EQ(platform->GetDroppedEventCount(), 0u);
+    }
+
+    std::ostringstream json;
+    ASSERT_TRUE(utils::ConvertBinaryTraceToJSON(mPath.c_str(), &json));
+    std::string result = json.str();
+    EXPECT_EQ(result.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_EQ(CountOccurrences(result, "\"name\":\"Scoped\\\"Event\",\"cat\":\"Validation\""),
+              2 * kThreadCount * kEventsPerThread);
+    EXPECT_EQ(CountOccurrences(result, "\"ph\":\"B\""), kThreadCount * kEventsPerThread);
+    EXPECT_EQ(CountOccurrences(result, "\"ph\":\"E\""), kThreadCount * kEventsPerThread);
+    EXPECT_EQ(CountOccurrences(result, "\"name\":\"CopiedEvent\",\"cat\":\"General\""), 1u);
+    for (size_t i = 0; i < kThreadCount; ++i) {
+        EXPECT_NE(result.find("\"tid\":" + std::to_string(i)), std::string::npos);
+    }
+}
+
+// Test that events are dropped instead of blocking when the buffer of the thread is full.
+TEST_F(BinaryTracePlatformTests, DropWhenFull) {
+    {
+        std::unique_ptr<utils::BinaryTracePlatform> platform =
+            utils::BinaryTracePlatform::Create(mPath.c_str(), 8);
+        ASSERT_NE(platform, nullptr);
+
+        for (size_t i = 0; i < 10; ++i) {
+            TRACE_EVENT_INSTANT0(platform.get(), General, "Event");
+        }
+        EXPECT_EQ(platform->GetDroppedEventCount(), 2u);
+
+        // Flushing makes space for new events.
+        platform->Flush();
+        for (size_t i = 0; i < 8; ++i) {
+            TRACE_EVENT_INSTANT0(platform.get(), General, "Event");
+        }
+        EXPECT_EQ(platform->GetDroppedEventCount(), 2u);
+    }
+
+    std::ostringstream json;
+    ASSERT_TRUE(utils::ConvertBinaryTraceToJSON(mPath.c_str(), &json));
+    EXPECT_EQ(CountOccurrences(json.str(), "\"name\":\"Event\""), 16u);
+}
+
+// Test that events whose category flag comes from another platform are recorded as unknown, since
+// the tracing macros cache the flag of the first platform they are used with.
+TEST_F(BinaryTracePlatformTests, CategoryFromOtherPlatform) {
+    {
+        std::unique_ptr<utils::BinaryTracePlatform> platform =
+            utils::BinaryTracePlatform::Create(mPath.c_str());
+        ASSERT_NE(platform, nullptr);
+
+        unsigned char otherEnabled = 1;
+        platform->AddTraceEvent(TRACE_EVENT_PHASE_INSTANT, &otherEnabled, "Other", 0,
+                                platform->MonotonicallyIncreasingTime(), 0, nullptr, nullptr,
+                                nullptr, TRACE_EVENT_FLAG_NONE);
+    }
+
+    std::ostringstream json;
+    ASSERT_TRUE(utils::ConvertBinaryTraceToJSON(mPath.c_str(), &json));
+    EXPECT_EQ(CountOccurrences(json.str(), "\"name\":\"Other\",\"cat\":\"Unknown\""), 1u);
+}
+
+// Test that the timestamps keep their sub-microsecond part.
+TEST_F(BinaryTracePlatformTests, FractionalTimestamps) {
+    {
+        std::unique_ptr<utils::BinaryTracePlatform> platform =
+            utils::BinaryTracePlatform::Create(mPath.c_str());
+        ASSERT_NE(platform, nullptr);
+        TRACE_EVENT_INSTANT0(platform.get(), General, "Event");
+    }
+
+    std::ostringstream json;
+    ASSERT_TRUE(utils::ConvertBinaryTraceToJSON(mPath.c_str(), &json));
+    std::string result = json.str();
+    size_t ts = result.find("\"ts\":");
+    ASSERT_NE(ts, std::string::npos);
+    size_t end = result.find(',', ts);
+    EXPECT_NE(result.substr(ts, end - ts).find('.'), std::string::npos);
+}
+
+// Test that MonotonicallyIncreasingTime is in seconds like for the other platforms, even though the
+// events are recorded with another clock.
+TEST_F(BinaryTracePlatformTests, MonotonicallyIncreasingTimeInSeconds) {
+    std::unique_ptr<utils::BinaryTracePlatform> platform =
+        utils::BinaryTracePlatform::Create(mPath.c_str());
+    ASSERT_NE(platform, nullptr);
+
+    double start = platform->MonotonicallyIncreasingTime();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    double elapsed = platform->MonotonicallyIncreasingTime() - start;
+    EXPECT_GE(elapsed, 0.02);
+    EXPECT_LT(elapsed, 10.0);
+}
+
+// Test that truncated or invalid traces are rejected.
+TEST_F(BinaryTracePlatformTests, InvalidTrace) {
+    std::ostringstream json;
+    EXPECT_FALSE(utils::ConvertBinaryTraceToJSON(mPath.c_str(), &json));
+
+    {
+        std::unique_ptr<utils::BinaryTracePlatform> platform =
+            utils::BinaryTracePlatform::Create(mPath.c_str());
+        TRACE_EVENT_INSTANT0(platform.get(), General, "Event");
+    }
+    ASSERT_TRUE(utils::ConvertBinaryTraceToJSON(mPath.c_str(), &json));
+
+    // Append a record header that claims more data than there is in the file.
+    {
+        std::ofstream file(mPath, std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+        utils::BinaryTraceRecordHeader header = {utils::BinaryTraceRecordType::Events, 0, 1 << 30};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    EXPECT_FALSE(utils::ConvertBinaryTraceToJSON(mPath.c_str(), &json));
+
+    // A file that isn't a trace.
+    {
+        std::ofstream file(mPath, std::ios_base::out | std::ios_base::trunc);
+        file << "not a trace";
+    }
+    EXPECT_FALSE(utils::ConvertBinaryTraceToJSON(mPath.c_str(), &json));
+}
+
+}  // anonymous namespace
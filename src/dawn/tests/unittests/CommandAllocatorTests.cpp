@@ -500,4 +500,113 @@ TEST(CommandAllocator, AcquireCommandBlocks) {
     iterator.MakeEmptyAsDataWasDestroyed();
 }
 
+// Test that the blocks of destroyed commands are reused by the next allocators of the pool.
+TEST(CommandAllocator, PooledBlocksAreReused) {
+    CommandBlockPool pool;
+
+    auto EncodeAndDestroy = [&](uint32_t commandCount) {
+        CommandAllocator allocator(&pool);
+        for (uint32_t i = 0; i < commandCount; ++i) {
+            CommandDraw* draw = allocator.Allocate<CommandDraw>(CommandType::Draw);
+            draw->first = i;
+            draw->count = 3;
+        }
+        CommandIterator iterator(std::move(allocator));
+        CommandType type;
+        for (uint32_t i = 0; i < commandCount; ++i) {
+            ASSERT_TRUE(iterator.NextCommandId(&type));
+            ASSERT_EQ(type, CommandType::Draw);
+            ASSERT_EQ(iterator.NextCommand<CommandDraw>()->first, i);
+        }
+        ASSERT_FALSE(iterator.NextCommandId(&type));
+        iterator.MakeEmptyAsDataWasDestroyed();
+    };
+
+    EncodeAndDestroy(10000);
+    uint64_t allocatedBlockCount = pool.GetAllocatedBlockCountForTesting();
+    EXPECT_GT(allocatedBlockCount, 1u);
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), allocatedBlockCount);
+
+    // The same amount of commands doesn't need any new block.
+    for (uint32_t i = 0; i < 5; ++i) {
+        EncodeAndDestroy(10000);
+    }
+    EXPECT_EQ(pool.GetAllocatedBlockCountForTesting(), allocatedBlockCount);
+
+    // Resetting an allocator also returns its blocks to the pool.
+    CommandAllocator allocator(&pool);
+    allocator.Allocate<CommandDraw>(CommandType::Draw);
+    allocator.Reset();
+    EXPECT_EQ(pool.GetAllocatedBlockCountForTesting(), allocatedBlockCount);
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), allocatedBlockCount);
+}
+
+// Test that commands larger than the largest size class still work with a pool.
+TEST(CommandAllocator, PooledLargeCommands) {
+    CommandBlockPool pool;
+    {
+        CommandAllocator allocator(&pool);
+        allocator.Allocate<CommandSmall>(CommandType::Small);
+        CommandBig* big = allocator.Allocate<CommandBig>(CommandType::Big);
+        big->buffer[kBigBufferSize - 1] = 42;
+
+        CommandIterator iterator(std::move(allocator));
+        CommandType type;
+        ASSERT_TRUE(iterator.NextCommandId(&type));
+        ASSERT_EQ(type, CommandType::Small);
+        iterator.NextCommand<CommandSmall>();
+        ASSERT_TRUE(iterator.NextCommandId(&type));
+        ASSERT_EQ(type, CommandType::Big);
+        ASSERT_EQ(iterator.NextCommand<CommandBig>()->buffer[kBigBufferSize - 1], 42u);
+        iterator.MakeEmptyAsDataWasDestroyed();
+    }
+    // Only the small blocks are cached.
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 1u);
+}
+
+// Test that Trim() frees the cached blocks beyond the high-water mark since the previous trim and
+// keeps the cached blocks of the size classes that weren't used.
+TEST(CommandAllocator, PoolTrim) {
+    CommandBlockPool pool;
+    size_t size;
+
+    // Use four blocks at the same time and release them.
+    std::vector<uint8_t*> blocks;
+    for (uint32_t i = 0; i < 4; ++i) {
+        blocks.push_back(pool.Acquire(4096, &size));
+        EXPECT_EQ(size, 4096u);
+    }
+    for (uint8_t* block : blocks) {
+        pool.Release(block, size);
+    }
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 4u);
+
+    // The four blocks were all needed since the last trim so they are kept.
+    pool.Trim();
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 4u);
+
+    // Nothing was acquired since the last trim so the blocks are kept.
+    pool.Trim();
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 4u);
+
+    // Only one block is used at a time, the others are freed on the next trim.
+    for (uint32_t i = 0; i < 3; ++i) {
+        uint8_t* block = pool.Acquire(3000, &size);
+        EXPECT_EQ(size, 4096u);
+        pool.Release(block, size);
+    }
+    EXPECT_EQ(pool.GetAllocatedBlockCountForTesting(), 4u);
+    pool.Trim();
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 1u);
+
+    // Blocks in use aren't counted as cached, and blocks acquired after the trim are kept.
+    uint8_t* inUse = pool.Acquire(4096, &size);
+    uint8_t* released = pool.Acquire(4096, &size);
+    pool.Release(released, size);
+    pool.Trim();
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 1u);
+    pool.Release(inUse, size);
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 2u);
+}
+
 }  // namespace dawn::native
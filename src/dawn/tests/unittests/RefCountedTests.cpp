@@ -97,6 +97,30 @@ TEST(RefCounted, RaceOnReferenceRelease) {
     EXPECT_TRUE(deleted);
 }
 
+// Test that TryReference adds a reference while the RC is alive, and fails once the last reference
+// is dropped.
+TEST(RefCounted, TryReference) {
+    struct RCTestNoDelete : public RCTest {
+        void DeleteThis() override { deleteThisCalled = true; }
+        void ActuallyDelete() { RCTest::DeleteThis(); }
+        bool deleteThisCalled = false;
+    };
+    auto* test = new RCTestNoDelete;
+
+    EXPECT_TRUE(test->TryReference());
+    EXPECT_EQ(test->GetRefCountForTesting(), 2u);
+
+    test->Release();
+    test->Release();
+    EXPECT_TRUE(test->deleteThisCalled);
+
+    // The refcount dropped to zero, the object must not be resurrected.
+    EXPECT_FALSE(test->TryReference());
+    EXPECT_EQ(test->GetRefCountForTesting(), 0u);
+
+    test->ActuallyDelete();
+}
+
 // Test Ref remove reference when going out of scope
 TEST(Ref, EndOfScopeRemovesRef) {
     bool deleted = false;
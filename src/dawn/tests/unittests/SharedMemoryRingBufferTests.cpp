@@ -0,0 +1,187 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dawn/common/Platform.h"
+#include "dawn/utils/SharedMemoryRingBuffer.h"
+#include "gtest/gtest.h"
+
+#if DAWN_PLATFORM_IS(POSIX)
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Records the commands it gets. Each command is a uint32_t with its size in bytes followed by
+// bytes equal to the low byte of the command's index.
+class RecordingHandler : public dawn::wire::CommandHandler {
+  public:
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        while (size > 0) {
+            uint32_t commandSize;
+            memcpy(&commandSize, const_cast<const char*>(commands), sizeof(commandSize));
+            if (commandSize < sizeof(uint32_t) || commandSize > size) {
+                return nullptr;
+            }
+            for (uint32_t i = sizeof(uint32_t); i < commandSize; ++i) {
+                if (commands[i] != static_cast<char>(mCommandSizes.size())) {
+                    return nullptr;
+                }
+            }
+            mCommandSizes.push_back(commandSize);
+            commands += commandSize;
+            size -= commandSize;
+        }
+        return commands;
+    }
+
+    const std::vector<uint32_t>& GetCommandSizes() const { return mCommandSizes; }
+
+  private:
+    std::vector<uint32_t> mCommandSizes;
+};
+
+// Commands are multiples of 8 bytes like the wire's.
+uint32_t CommandSize(uint32_t index) {
+    return 8 * (1 + (index * 7) % 61);
+}
+
+bool WriteCommand(utils::SharedMemoryCommandSerializer* serializer, uint32_t index) {
+    uint32_t size = CommandSize(index);
+    char* space = static_cast<char*>(serializer->GetCmdSpace(size));
+    if (space == nullptr) {
+        return false;
+    }
+    memcpy(space, &size, sizeof(size));
+    memset(space + sizeof(size), static_cast<char>(index), size - sizeof(size));
+    return true;
+}
+
+class SharedMemoryRingBufferTests : public testing::Test {
+  protected:
+    void SetUp() override {
+        mRing = utils::SharedMemoryRingBuffer::Create(4096);
+        if (mRing == nullptr) {
+            GTEST_SKIP() << "Shared memory isn't supported on this platform.";
+        }
+    }
+
+    std::unique_ptr<utils::SharedMemoryRingBuffer> mRing;
+};
+
+// Test that commands are only visible to the reader once they are flushed.
+TEST_F(SharedMemoryRingBufferTests, CommandsArePublishedOnFlush) {
+    utils::SharedMemoryCommandSerializer serializer(mRing.get());
+    RecordingHandler handler;
+    utils::SharedMemoryCommandReader reader(mRing.get(), &handler);
+
+    ASSERT_TRUE(WriteCommand(&serializer, 0));
+    ASSERT_TRUE(WriteCommand(&serializer, 1));
+    ASSERT_TRUE(reader.HandleAvailableCommands());
+    EXPECT_TRUE(handler.GetCommandSizes().empty());
+
+    ASSERT_TRUE(serializer.Flush());
+    ASSERT_TRUE(reader.HandleAvailableCommands());
+    EXPECT_EQ(handler.GetCommandSizes(), (std::vector<uint32_t>{CommandSize(0), CommandSize(1)}));
+}
+
+// Test that commands stay contiguous when the ring wraps around many times.
+TEST_F(SharedMemoryRingBufferTests, WrapAround) {
+    utils::SharedMemoryCommandSerializer serializer(mRing.get());
+    RecordingHandler handler;
+    utils::SharedMemoryCommandReader reader(mRing.get(), &handler);
+
+    constexpr uint32_t kCommandCount = 1000;
+    std::vector<uint32_t> expectedSizes;
+    for (uint32_t i = 0; i < kCommandCount; ++i) {
+        ASSERT_TRUE(WriteCommand(&serializer, i));
+        expectedSizes.push_back(CommandSize(i));
+        if (i % 3 == 2) {
+            ASSERT_TRUE(serializer.Flush());
+            ASSERT_TRUE(reader.HandleAvailableCommands());
+        }
+    }
+    ASSERT_TRUE(serializer.Flush());
+    ASSERT_TRUE(reader.HandleAvailableCommands());
+    EXPECT_EQ(handler.GetCommandSizes(), expectedSizes);
+}
+
+// Test that allocations larger than the maximum allocation size fail.
+TEST_F(SharedMemoryRingBufferTests, MaximumAllocationSize) {
+    utils::SharedMemoryCommandSerializer serializer(mRing.get());
+    size_t maxSize = serializer.GetMaximumAllocationSize();
+    EXPECT_NE(serializer.GetCmdSpace(maxSize), nullptr);
+    EXPECT_EQ(serializer.GetCmdSpace(maxSize + 1), nullptr);
+}
+
+// Test that a producer faster than the consumer waits for it instead of overwriting commands.
+TEST_F(SharedMemoryRingBufferTests, Backpressure) {
+    constexpr uint32_t kCommandCount = 20000;
+
+    RecordingHandler handler;
+    std::thread consumer([&] {
+        utils::SharedMemoryCommandReader reader(mRing.get(), &handler);
+        while (reader.WaitAndHandleCommands()) {
+        }
+    });
+
+    utils::SharedMemoryCommandSerializer serializer(mRing.get());
+    for (uint32_t i = 0; i < kCommandCount; ++i) {
+        ASSERT_TRUE(WriteCommand(&serializer, i));
+        if (i % 50 == 0) {
+            ASSERT_TRUE(serializer.Flush());
+        }
+    }
+    ASSERT_TRUE(serializer.Flush());
+    mRing->Close();
+    consumer.join();
+
+    ASSERT_EQ(handler.GetCommandSizes().size(), kCommandCount);
+    for (uint32_t i = 0; i < kCommandCount; ++i) {
+        EXPECT_EQ(handler.GetCommandSizes()[i], CommandSize(i));
+    }
+}
+
+// Test that a closed ring rejects new commands.
+TEST_F(SharedMemoryRingBufferTests, ClosedRingRejectsCommands) {
+    utils::SharedMemoryCommandSerializer serializer(mRing.get());
+    mRing->Close();
+    EXPECT_EQ(serializer.GetCmdSpace(8), nullptr);
+    EXPECT_FALSE(serializer.Flush());
+}
+
+#if DAWN_PLATFORM_IS(POSIX)
+// Test that a ring imported from the file descriptor of another one sees its commands.
+TEST_F(SharedMemoryRingBufferTests, Import) {
+    std::unique_ptr<utils::SharedMemoryRingBuffer> imported =
+        utils::SharedMemoryRingBuffer::Import(dup(mRing->GetFd()));
+    ASSERT_NE(imported, nullptr);
+    EXPECT_EQ(imported->GetCapacity(), mRing->GetCapacity());
+
+    utils::SharedMemoryCommandSerializer serializer(mRing.get());
+    RecordingHandler handler;
+    utils::SharedMemoryCommandReader reader(imported.get(), &handler);
+
+    ASSERT_TRUE(WriteCommand(&serializer, 0));
+    ASSERT_TRUE(serializer.Flush());
+    ASSERT_TRUE(reader.HandleAvailableCommands());
+    EXPECT_EQ(handler.GetCommandSizes(), std::vector<uint32_t>{CommandSize(0)});
+}
+#endif
+
+}  // anonymous namespace
@@ -0,0 +1,237 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "dawn/utils/SharedMemory.h"
+#include "dawn/utils/SharedMemoryTransferService.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using ClientReadHandle = dawn::wire::client::MemoryTransferService::ReadHandle;
+using ClientWriteHandle = dawn::wire::client::MemoryTransferService::WriteHandle;
+using ServerReadHandle = dawn::wire::server::MemoryTransferService::ReadHandle;
+using ServerWriteHandle = dawn::wire::server::MemoryTransferService::WriteHandle;
+
+class SharedMemoryTransferServiceTests : public testing::Test {
+  protected:
+    void SetUp() override {
+        if (utils::SharedMemory::Create(1) == nullptr) {
+            GTEST_SKIP() << "Shared memory isn't supported on this platform.";
+        }
+    }
+
+    // Simulates sending a client write handle to the server.
+    std::unique_ptr<ServerWriteHandle> Transfer(ClientWriteHandle* clientHandle) {
+        std::vector<char> createInfo(clientHandle->SerializeCreateSize());
+        clientHandle->SerializeCreate(createInfo.data());
+        ServerWriteHandle* serverHandle = nullptr;
+        if (!mServer.DeserializeWriteHandle(createInfo.data(), createInfo.size(), &serverHandle)) {
+            return nullptr;
+        }
+        return std::unique_ptr<ServerWriteHandle>(serverHandle);
+    }
+
+    std::unique_ptr<ServerReadHandle> Transfer(ClientReadHandle* clientHandle) {
+        std::vector<char> createInfo(clientHandle->SerializeCreateSize());
+        clientHandle->SerializeCreate(createInfo.data());
+        ServerReadHandle* serverHandle = nullptr;
+        if (!mServer.DeserializeReadHandle(createInfo.data(), createInfo.size(), &serverHandle)) {
+            return nullptr;
+        }
+        return std::unique_ptr<ServerReadHandle>(serverHandle);
+    }
+
+    utils::SharedMemoryClientTransferService mClient;
+    utils::SharedMemoryServerTransferService mServer;
+};
+
+// Test that data written in a client write handle reaches the server's target.
+TEST_F(SharedMemoryTransferServiceTests, WriteHandle) {
+    constexpr size_t kSize = 1024;
+    std::unique_ptr<ClientWriteHandle> clientHandle(mClient.CreateWriteHandle(kSize));
+    ASSERT_NE(clientHandle, nullptr);
+    std::unique_ptr<ServerWriteHandle> serverHandle = Transfer(clientHandle.get());
+    ASSERT_NE(serverHandle, nullptr);
+
+    std::vector<uint8_t> target(kSize, 0);
+    serverHandle->SetTarget(target.data());
+    serverHandle->SetDataLength(kSize);
+
+    uint8_t* data = static_cast<uint8_t*>(clientHandle->GetData());
+    EXPECT_EQ(data[42], 0u);
+    data[42] = 0xAB;
+
+    std::vector<char> updateInfo(clientHandle->SizeOfSerializeDataUpdate(0, kSize));
+    clientHandle->SerializeDataUpdate(updateInfo.data(), 0, kSize);
+    ASSERT_TRUE(
+        serverHandle->DeserializeDataUpdate(updateInfo.data(), updateInfo.size(), 0, kSize));
+    EXPECT_EQ(target[42], 0xAB);
+}
+
+// Test that data written by the server in a read handle is visible to the client.
+TEST_F(SharedMemoryTransferServiceTests, ReadHandle) {
+    constexpr size_t kSize = 1024;
+    std::unique_ptr<ClientReadHandle> clientHandle(mClient.CreateReadHandle(kSize));
+    ASSERT_NE(clientHandle, nullptr);
+    std::unique_ptr<ServerReadHandle> serverHandle = Transfer(clientHandle.get());
+    ASSERT_NE(serverHandle, nullptr);
+
+    std::vector<uint8_t> mapped(256, 0xCD);
+    std::vector<char> updateInfo(serverHandle->SizeOfSerializeDataUpdate(512, mapped.size()));
+    serverHandle->SerializeDataUpdate(mapped.data(), 512, mapped.size(), updateInfo.data());
+    ASSERT_TRUE(clientHandle->DeserializeDataUpdate(updateInfo.data(), updateInfo.size(), 512,
+                                                    mapped.size()));
+
+    const uint8_t* data = static_cast<const uint8_t*>(clientHandle->GetData());
+    EXPECT_EQ(data[511], 0u);
+    EXPECT_EQ(data[512], 0xCD);
+    EXPECT_EQ(data[767], 0xCD);
+}
+
+// Test that updates for another range than the expected one are rejected.
+TEST_F(SharedMemoryTransferServiceTests, MismatchedRangeIsRejected) {
+    constexpr size_t kSize = 1024;
+    std::unique_ptr<ClientWriteHandle> clientHandle(mClient.CreateWriteHandle(kSize));
+    std::unique_ptr<ServerWriteHandle> serverHandle = Transfer(clientHandle.get());
+    ASSERT_NE(serverHandle, nullptr);
+
+    std::vector<uint8_t> target(kSize);
+    serverHandle->SetTarget(target.data());
+    serverHandle->SetDataLength(kSize);
+
+    std::vector<char> updateInfo(clientHandle->SizeOfSerializeDataUpdate(0, kSize));
+    clientHandle->SerializeDataUpdate(updateInfo.data(), 0, kSize);
+    EXPECT_FALSE(
+        serverHandle->DeserializeDataUpdate(updateInfo.data(), updateInfo.size(), 0, kSize / 2));
+
+    // The range must also fit in the data.
+    clientHandle->SerializeDataUpdate(updateInfo.data(), 0, 2 * kSize);
+    EXPECT_FALSE(serverHandle->DeserializeDataUpdate(updateInfo.data(), updateInfo.size(), 0,
+                                                     2 * kSize));
+}
+
+// Test that small queue writes are sent inline and large ones are read in place by the server.
+TEST_F(SharedMemoryTransferServiceTests, QueueWriteHandle) {
+    constexpr size_t kLargeSize =
+        utils::SharedMemoryClientTransferService::kDefaultMinQueueWriteSize;
+    EXPECT_EQ(mClient.CreateQueueWriteHandle(kLargeSize - 1), nullptr);
+
+    std::unique_ptr<ClientWriteHandle> clientHandle(mClient.CreateQueueWriteHandle(kLargeSize));
+    ASSERT_NE(clientHandle, nullptr);
+    memset(clientHandle->GetData(), 0x12, kLargeSize);
+
+    std::unique_ptr<ServerWriteHandle> serverHandle = Transfer(clientHandle.get());
+    ASSERT_NE(serverHandle, nullptr);
+    serverHandle->SetDataLength(kLargeSize);
+    const uint8_t* source = static_cast<const uint8_t*>(serverHandle->GetSourceData());
+    ASSERT_NE(source, nullptr);
+    EXPECT_EQ(source[0], 0x12);
+    EXPECT_EQ(source[kLargeSize - 1], 0x12);
+
+    // The server can't read past the region.
+    serverHandle->SetDataLength(2 * kLargeSize);
+    EXPECT_EQ(serverHandle->GetSourceData(), nullptr);
+}
+
+// Test that regions are only reused once both the client and the server are done with them.
+TEST_F(SharedMemoryTransferServiceTests, RegionsAreRecycled) {
+    constexpr size_t kSize = 1 << 20;
+    std::unique_ptr<ClientWriteHandle> first(mClient.CreateQueueWriteHandle(kSize));
+    void* firstData = first->GetData();
+    std::unique_ptr<ServerWriteHandle> serverHandle = Transfer(first.get());
+    ASSERT_NE(serverHandle, nullptr);
+    first = nullptr;
+
+    // The server still uses the first region.
+    std::unique_ptr<ClientWriteHandle> second(mClient.CreateQueueWriteHandle(kSize));
+    EXPECT_NE(second->GetData(), firstData);
+    second = nullptr;
+
+    serverHandle = nullptr;
+    std::unique_ptr<ClientWriteHandle> third(mClient.CreateQueueWriteHandle(kSize));
+    std::unique_ptr<ClientWriteHandle> fourth(mClient.CreateQueueWriteHandle(kSize));
+    EXPECT_TRUE(third->GetData() == firstData || fourth->GetData() == firstData);
+}
+
+// Test that the region of a handle the server never deserialized, for example because it rejected
+// the command, is reused once the server deserialized a later handle.
+TEST_F(SharedMemoryTransferServiceTests, SkippedHandleRegionIsRecycled) {
+    constexpr size_t kSize = 1 << 20;
+    std::unique_ptr<ClientWriteHandle> skipped(mClient.CreateQueueWriteHandle(kSize));
+    void* skippedData = skipped->GetData();
+    std::vector<char> createInfo(skipped->SerializeCreateSize());
+    skipped->SerializeCreate(createInfo.data());
+    skipped = nullptr;
+
+    // The server may still deserialize the handle.
+    std::unique_ptr<ClientWriteHandle> next(mClient.CreateQueueWriteHandle(kSize));
+    EXPECT_NE(next->GetData(), skippedData);
+    EXPECT_NE(Transfer(next.get()), nullptr);
+    next = nullptr;
+
+    // The server deserialized a later handle, so it skipped the first one.
+    std::unique_ptr<ClientWriteHandle> reused(mClient.CreateQueueWriteHandle(kSize));
+    EXPECT_EQ(reused->GetData(), skippedData);
+}
+
+// Test that regions are reused once the client is disconnected, as the server won't deserialize
+// their handles.
+TEST_F(SharedMemoryTransferServiceTests, RegionsAreRecycledAfterDisconnect) {
+    constexpr size_t kSize = 1 << 20;
+    std::unique_ptr<ClientWriteHandle> first(mClient.CreateQueueWriteHandle(kSize));
+    void* firstData = first->GetData();
+    std::vector<char> createInfo(first->SerializeCreateSize());
+    first->SerializeCreate(createInfo.data());
+    first = nullptr;
+
+    mClient.OnDisconnect();
+    std::unique_ptr<ClientWriteHandle> second(mClient.CreateQueueWriteHandle(kSize));
+    EXPECT_EQ(second->GetData(), firstData);
+}
+
+// Test that a reused region is cleared for buffer mappings.
+TEST_F(SharedMemoryTransferServiceTests, ReusedRegionIsCleared) {
+    constexpr size_t kSize = 4096;
+    std::unique_ptr<ClientWriteHandle> clientHandle(mClient.CreateWriteHandle(kSize));
+    memset(clientHandle->GetData(), 0xFF, kSize);
+    clientHandle = nullptr;
+
+    clientHandle.reset(mClient.CreateWriteHandle(kSize));
+    const uint8_t* data = static_cast<const uint8_t*>(clientHandle->GetData());
+    for (size_t i = 0; i < kSize; ++i) {
+        ASSERT_EQ(data[i], 0u);
+    }
+}
+
+// Test that malformed handles are rejected.
+TEST_F(SharedMemoryTransferServiceTests, MalformedHandle) {
+    ServerWriteHandle* serverHandle = nullptr;
+    std::vector<char> createInfo(7);
+    EXPECT_FALSE(mServer.DeserializeWriteHandle(createInfo.data(), createInfo.size(),
+                                                &serverHandle));
+
+    // A handle with a file descriptor that can't be resolved.
+    utils::SharedMemoryServerTransferService server([](int) { return -1; });
+    std::unique_ptr<ClientWriteHandle> clientHandle(mClient.CreateWriteHandle(16));
+    createInfo.resize(clientHandle->SerializeCreateSize());
+    clientHandle->SerializeCreate(createInfo.data());
+    EXPECT_FALSE(
+        server.DeserializeWriteHandle(createInfo.data(), createInfo.size(), &serverHandle));
+}
+
+}  // anonymous namespace
@@ -196,10 +196,12 @@ void CheckLayerCompressed(const SubresourceStorage<T>& s,
 
     uint32_t levelCount = s.GetMipLevelCountForTesting();
 
+    // Compressed layers can be iterated as part of a run of compressed layers.
     bool seen = false;
     s.Iterate([&](const SubresourceRange& range, const T&) {
-        if (range.aspects == aspect && range.layerCount == 1 && range.levelCount == levelCount &&
-            range.baseArrayLayer == layer && range.baseMipLevel == 0) {
+        if (range.aspects == aspect && range.levelCount == levelCount &&
+            range.baseArrayLayer <= layer && layer < range.baseArrayLayer + range.layerCount &&
+            range.baseMipLevel == 0) {
             seen = true;
         }
     });
@@ -696,6 +698,60 @@ TEST(SubresourceStorageTest, AspectDecompressionUpdatesLayer0) {
     EXPECT_EQ(3, s.Get(Aspect::Color, 0, 1));
 }
 
+// Returns the number of times Iterate() calls its iterateFunc.
+template <typename T>
+uint32_t CountIterateCalls(const SubresourceStorage<T>& s) {
+    uint32_t count = 0;
+    s.Iterate([&](const SubresourceRange&, const T&) { count++; });
+    return count;
+}
+
+// Test that the runs of consecutive compressed layers with the same data are iterated, updated
+// and merged at once, like for large 2D array textures where only a few layers are modified.
+TEST(SubresourceStorageTest, CompressedLayerRuns) {
+    const uint32_t kLayers = 256;
+    const uint32_t kLevels = 4;
+    SubresourceStorage<int> s(Aspect::Color, kLayers, kLevels);
+    FakeStorage<int> f(Aspect::Color, kLayers, kLevels);
+
+    // Update a single subresource in the middle of the layers which decompresses the aspect.
+    {
+        SubresourceRange range = SubresourceRange::MakeSingle(Aspect::Color, 100, 1);
+        CallUpdateOnBoth(&s, &f, range, [](const SubresourceRange&, int* data) { *data += 1; });
+    }
+    CheckAspectCompressed(s, Aspect::Color, false);
+    CheckLayerCompressed(s, Aspect::Color, 100, false);
+
+    // The layers before and after the decompressed layer are each iterated as a single run.
+    EXPECT_EQ(CountIterateCalls(s), 2 + kLevels);
+
+    // Updating full layers around the decompressed layer calls updateFunc once for each run of
+    // compressed layers and once for each level of the decompressed layer.
+    {
+        SubresourceRange range(Aspect::Color, {50, 100}, {0, kLevels});
+        uint32_t updateCount = 0;
+        s.Update(range, [&](const SubresourceRange&, int* data) {
+            updateCount++;
+            *data += 2;
+        });
+        f.Update(range, [](const SubresourceRange&, int* data) { *data += 2; });
+        f.CheckSameAs(s);
+        EXPECT_EQ(updateCount, 2 + kLevels);
+    }
+    CheckLayerCompressed(s, Aspect::Color, 99, true);
+    CheckLayerCompressed(s, Aspect::Color, 100, false);
+    CheckLayerCompressed(s, Aspect::Color, 101, true);
+    EXPECT_EQ(CountIterateCalls(s), 4 + kLevels);
+
+    // Merging other's runs of layers splits the runs of s where they don't line up.
+    SubresourceStorage<int> other(Aspect::Color, kLayers, kLevels);
+    other.Update({Aspect::Color, {0, 128}, {0, kLevels}},
+                 [](const SubresourceRange&, int* data) { *data += 5; });
+    CallMergeOnBoth(&s, &f, other,
+                    [](const SubresourceRange&, int* data, int other) { *data += other; });
+    EXPECT_EQ(CountIterateCalls(s), 5 + kLevels);
+}
+
 // Bugs found while testing:
 //  - mLayersCompressed not initialized to true.
 //  - DecompressLayer setting Compressed to true instead of false.
@@ -0,0 +1,128 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/utils/WireRecorder.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+class RecordingHandler : public dawn::wire::CommandHandler {
+  public:
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        const char* data = const_cast<const char*>(commands);
+        received.insert(received.end(), data, data + size);
+        return commands + size;
+    }
+
+    std::vector<char> received;
+};
+
+class WireRecorderTests : public testing::Test {
+  protected:
+    void TearDown() override { std::remove(mPath.c_str()); }
+
+    void WriteCommand(dawn::wire::CommandSerializer* serializer, size_t size, char value) {
+        char* space = static_cast<char*>(serializer->GetCmdSpace(size));
+        ASSERT_NE(space, nullptr);
+        memset(space, value, size);
+    }
+
+    std::string mPath = testing::TempDir() + "WireRecorderTests.bin";
+};
+
+// Test that the commands and injections are recorded in order and that the commands still reach
+// the wrapped serializer.
+TEST_F(WireRecorderTests, RecordAndRead) {
+    RecordingHandler clientHandler;
+    RecordingHandler serverHandler;
+    utils::TerribleCommandBuffer c2s(&serverHandler);
+    utils::TerribleCommandBuffer s2c(&clientHandler);
+    {
+        std::unique_ptr<utils::WireRecorder> recorder = utils::WireRecorder::Create(mPath.c_str());
+        ASSERT_NE(recorder, nullptr);
+        std::unique_ptr<dawn::wire::CommandSerializer> clientSerializer =
+            recorder->WrapClientSerializer(&c2s);
+        std::unique_ptr<dawn::wire::CommandSerializer> serverSerializer =
+            recorder->WrapServerSerializer(&s2c);
+
+        recorder->RecordInjectInstance(1, 2);
+        WriteCommand(clientSerializer.get(), 16, 'a');
+        WriteCommand(clientSerializer.get(), 13, 'b');
+        ASSERT_TRUE(clientSerializer->Flush());
+        WriteCommand(serverSerializer.get(), 8, 'c');
+        ASSERT_TRUE(serverSerializer->Flush());
+        // Flushes without commands aren't recorded.
+        ASSERT_TRUE(clientSerializer->Flush());
+        recorder->RecordInjectDevice(3, 4);
+    }
+
+    EXPECT_EQ(serverHandler.received.size(), 29u);
+    EXPECT_EQ(clientHandler.received.size(), 8u);
+
+    std::vector<utils::WireRecord> records;
+    ASSERT_TRUE(utils::ReadWireRecording(mPath.c_str(), &records));
+    ASSERT_EQ(records.size(), 4u);
+
+    EXPECT_EQ(records[0].type, utils::WireRecordType::InjectInstance);
+    utils::WireRecordInjection injection;
+    ASSERT_EQ(records[0].data.size(), sizeof(injection));
+    memcpy(&injection, records[0].data.data(), sizeof(injection));
+    EXPECT_EQ(injection.id, 1u);
+    EXPECT_EQ(injection.generation, 2u);
+
+    EXPECT_EQ(records[1].type, utils::WireRecordType::Commands);
+    EXPECT_EQ(records[1].data, serverHandler.received);
+
+    EXPECT_EQ(records[2].type, utils::WireRecordType::ReturnCommands);
+    EXPECT_EQ(records[2].data, clientHandler.received);
+
+    EXPECT_EQ(records[3].type, utils::WireRecordType::InjectDevice);
+}
+
+// Test that truncated or invalid recordings are rejected.
+TEST_F(WireRecorderTests, InvalidRecording) {
+    std::vector<utils::WireRecord> records;
+    EXPECT_FALSE(utils::ReadWireRecording(mPath.c_str(), &records));
+
+    {
+        std::unique_ptr<utils::WireRecorder> recorder = utils::WireRecorder::Create(mPath.c_str());
+        recorder->RecordInjectDevice(1, 1);
+    }
+    ASSERT_TRUE(utils::ReadWireRecording(mPath.c_str(), &records));
+
+    // Append a record header that claims more data than there is in the file.
+    {
+        std::ofstream file(mPath, std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+        utils::WireRecordHeader header = {utils::WireRecordType::Commands, 0, 1 << 30};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    EXPECT_FALSE(utils::ReadWireRecording(mPath.c_str(), &records));
+
+    // A file that isn't a recording.
+    {
+        std::ofstream file(mPath, std::ios_base::out | std::ios_base::trunc);
+        file << "not a recording";
+    }
+    EXPECT_FALSE(utils::ReadWireRecording(mPath.c_str(), &records));
+}
+
+}  // anonymous namespace
@@ -0,0 +1,126 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dawn/platform/WorkerThread.h"
+#include "gtest/gtest.h"
+
+namespace dawn::platform {
+namespace {
+
+// A task that occupies a worker thread until it is released.
+struct BlockingTask {
+    std::promise<void> started;
+    std::promise<void> release;
+
+    static void Run(void* userdata) {
+        BlockingTask* task = static_cast<BlockingTask*>(userdata);
+        task->started.set_value();
+        task->release.get_future().wait();
+    }
+};
+
+// A task that records the order in which it ran.
+struct RecordingTask {
+    uint32_t id;
+    std::mutex* mutex;
+    std::vector<uint32_t>* order;
+
+    static void Run(void* userdata) {
+        RecordingTask* task = static_cast<RecordingTask*>(userdata);
+        std::lock_guard<std::mutex> lock(*task->mutex);
+        task->order->push_back(task->id);
+    }
+};
+
+void IncrementCounter(void* userdata) {
+    static_cast<std::atomic<uint32_t>*>(userdata)->fetch_add(1);
+}
+
+// Test that the queued tasks run by decreasing priority, and in FIFO order within a priority.
+TEST(WorkerThreadPoolTests, PriorityOrder) {
+    AsyncWorkerThreadPool pool(1);
+
+    // Occupy the only thread so that all the other tasks are queued before any of them runs.
+    BlockingTask blocker;
+    std::unique_ptr<WaitableEvent> blockerEvent =
+        pool.PostWorkerTask(BlockingTask::Run, &blocker);
+    blocker.started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<uint32_t> order;
+    constexpr WorkerTaskPriority kPriorities[] = {
+        WorkerTaskPriority::Low,  WorkerTaskPriority::Normal, WorkerTaskPriority::High,
+        WorkerTaskPriority::Low,  WorkerTaskPriority::Normal, WorkerTaskPriority::High,
+    };
+    std::vector<RecordingTask> tasks;
+    for (uint32_t i = 0; i < std::size(kPriorities); ++i) {
+        tasks.push_back({i, &mutex, &order});
+    }
+    std::vector<std::unique_ptr<WaitableEvent>> events;
+    for (uint32_t i = 0; i < std::size(kPriorities); ++i) {
+        events.push_back(
+            pool.PostWorkerTaskWithPriority(RecordingTask::Run, &tasks[i], kPriorities[i]));
+    }
+
+    blocker.release.set_value();
+    for (std::unique_ptr<WaitableEvent>& event : events) {
+        event->Wait();
+    }
+    blockerEvent->Wait();
+
+    EXPECT_EQ(order, (std::vector<uint32_t>{2, 5, 1, 4, 0, 3}));
+}
+
+// Test that destroying the pool runs the tasks that are still queued.
+TEST(WorkerThreadPoolTests, DrainQueuedTasksOnDestruction) {
+    constexpr uint32_t kTaskCount = 16;
+    std::atomic<uint32_t> counter{0};
+    std::vector<std::unique_ptr<WaitableEvent>> events;
+    BlockingTask blocker;
+    std::thread releaser;
+    {
+        AsyncWorkerThreadPool pool(1);
+        std::unique_ptr<WaitableEvent> blockerEvent =
+            pool.PostWorkerTask(BlockingTask::Run, &blocker);
+        blocker.started.get_future().wait();
+
+        for (uint32_t i = 0; i < kTaskCount; ++i) {
+            events.push_back(pool.PostWorkerTask(IncrementCounter, &counter));
+        }
+        EXPECT_EQ(counter.load(), 0u);
+
+        // Release the thread while the pool is being destroyed.
+        releaser = std::thread([&blocker] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            blocker.release.set_value();
+        });
+    }
+    releaser.join();
+
+    EXPECT_EQ(counter.load(), kTaskCount);
+    for (std::unique_ptr<WaitableEvent>& event : events) {
+        EXPECT_TRUE(event->IsComplete());
+    }
+}
+
+}  // anonymous namespace
+}  // namespace dawn::platform
@@ -0,0 +1,99 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utility>
+#include <vector>
+
+#include "dawn/native/TintProgramCache.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+Ref<SharedTintProgram> Parsed(Ref<SharedTintProgram> program) {
+    // The cache never looks at the program itself so an empty one is enough.
+    program->SetProgram(tint::Program());
+    return program;
+}
+
+// Test that looking up a source that was never inserted misses.
+TEST(TintProgramCacheTests, FindMiss) {
+    TintProgramCache cache;
+    Ref<SharedTintProgram> blueprint = SharedTintProgram::CreateFromWGSL("fn f() {}");
+    EXPECT_EQ(cache.Find(blueprint.Get()).Get(), nullptr);
+}
+
+// Test that an inserted program is returned for an identical source.
+TEST(TintProgramCacheTests, InsertThenFind) {
+    TintProgramCache cache;
+    Ref<SharedTintProgram> program =
+        cache.Insert(Parsed(SharedTintProgram::CreateFromWGSL("fn f() {}")));
+    EXPECT_EQ(cache.GetProgramCountForTesting(), 1u);
+
+    Ref<SharedTintProgram> blueprint = SharedTintProgram::CreateFromWGSL("fn f() {}");
+    EXPECT_EQ(cache.Find(blueprint.Get()).Get(), program.Get());
+}
+
+// Test that the source and the parsing options are both part of the key.
+TEST(TintProgramCacheTests, KeyIncludesSourceAndOptions) {
+    TintProgramCache cache;
+    std::vector<uint32_t> spirv = {0x07230203, 0x00010000};
+    Ref<SharedTintProgram> wgsl =
+        cache.Insert(Parsed(SharedTintProgram::CreateFromWGSL("fn f() {}")));
+    Ref<SharedTintProgram> spirvProgram =
+        cache.Insert(Parsed(SharedTintProgram::CreateFromSPIRV(spirv, false)));
+    EXPECT_EQ(cache.GetProgramCountForTesting(), 2u);
+
+    Ref<SharedTintProgram> otherWgsl = SharedTintProgram::CreateFromWGSL("fn g() {}");
+    EXPECT_EQ(cache.Find(otherWgsl.Get()).Get(), nullptr);
+
+    Ref<SharedTintProgram> otherOptions = SharedTintProgram::CreateFromSPIRV(spirv, true);
+    EXPECT_EQ(cache.Find(otherOptions.Get()).Get(), nullptr);
+
+    Ref<SharedTintProgram> sameSpirv = SharedTintProgram::CreateFromSPIRV(spirv, false);
+    EXPECT_EQ(cache.Find(sameSpirv.Get()).Get(), spirvProgram.Get());
+}
+
+// Test that inserting a program equivalent to a cached one returns the cached one.
+TEST(TintProgramCacheTests, InsertDuplicateReturnsExisting) {
+    TintProgramCache cache;
+    Ref<SharedTintProgram> first =
+        cache.Insert(Parsed(SharedTintProgram::CreateFromWGSL("fn f() {}")));
+    Ref<SharedTintProgram> second =
+        cache.Insert(Parsed(SharedTintProgram::CreateFromWGSL("fn f() {}")));
+    EXPECT_EQ(first.Get(), second.Get());
+    EXPECT_EQ(cache.GetProgramCountForTesting(), 1u);
+}
+
+// Test that programs are removed from the cache when they are no longer used.
+TEST(TintProgramCacheTests, DroppingLastRefRemovesProgram) {
+    TintProgramCache cache;
+    Ref<SharedTintProgram> program =
+        cache.Insert(Parsed(SharedTintProgram::CreateFromWGSL("fn f() {}")));
+    Ref<SharedTintProgram> other = program;
+    EXPECT_EQ(cache.GetProgramCountForTesting(), 1u);
+
+    program = nullptr;
+    EXPECT_EQ(cache.GetProgramCountForTesting(), 1u);
+
+    other = nullptr;
+    EXPECT_EQ(cache.GetProgramCountForTesting(), 0u);
+
+    Ref<SharedTintProgram> blueprint = SharedTintProgram::CreateFromWGSL("fn f() {}");
+    EXPECT_EQ(cache.Find(blueprint.Get()).Get(), nullptr);
+}
+
+}  // namespace
+
+}  // namespace dawn::native
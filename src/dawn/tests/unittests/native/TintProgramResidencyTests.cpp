@@ -0,0 +1,110 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string_view>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/native/TintProgramResidency.h"
+#include "mocks/DawnMockTest.h"
+#include "mocks/ShaderModuleMock.h"
+
+namespace dawn::native {
+namespace {
+
+static constexpr std::string_view kShaderA = R"(
+        @compute @workgroup_size(1) fn a() {}
+    )";
+
+static constexpr std::string_view kShaderB = R"(
+        @compute @workgroup_size(1) fn b() {}
+    )";
+
+static constexpr std::string_view kShaderC = R"(
+        @compute @workgroup_size(1) fn c() {}
+    )";
+
+class TintProgramResidencyTests : public DawnMockTest {
+  protected:
+    size_t ResidentCount() { return GetResidentTintProgramCount(device.Get()); }
+    size_t EvictedCount() { return GetEvictedTintProgramCount(device.Get()); }
+};
+
+// Test that programs stay resident when there is no budget.
+TEST_F(TintProgramResidencyTests, NoBudget) {
+    Ref<ShaderModuleMock> a = ShaderModuleMock::Create(mDeviceMock, kShaderA.data());
+    Ref<ShaderModuleMock> b = ShaderModuleMock::Create(mDeviceMock, kShaderB.data());
+    EXPECT_EQ(ResidentCount(), 2u);
+    EXPECT_EQ(EvictedCount(), 0u);
+}
+
+// Test that the least recently used programs are evicted when over budget.
+TEST_F(TintProgramResidencyTests, EvictsLeastRecentlyUsed) {
+    SetTintProgramResidencyBudget(device.Get(), 2);
+
+    Ref<ShaderModuleMock> a = ShaderModuleMock::Create(mDeviceMock, kShaderA.data());
+    Ref<ShaderModuleMock> b = ShaderModuleMock::Create(mDeviceMock, kShaderB.data());
+
+    // Using `a` makes `b` the least recently used.
+    a->GetTintProgram().AcquireSuccess();
+
+    Ref<ShaderModuleMock> c = ShaderModuleMock::Create(mDeviceMock, kShaderC.data());
+    EXPECT_EQ(ResidentCount(), 2u);
+    EXPECT_EQ(EvictedCount(), 1u);
+
+    TintProgramResidencyManager* residency = mDeviceMock->GetTintProgramResidencyManager();
+    EXPECT_NE(residency->Acquire(a.Get()).Get(), nullptr);
+    EXPECT_EQ(residency->Acquire(b.Get()).Get(), nullptr);
+    EXPECT_NE(residency->Acquire(c.Get()).Get(), nullptr);
+}
+
+// Test that an evicted program is parsed again when it is needed.
+TEST_F(TintProgramResidencyTests, ReparsesEvictedProgram) {
+    SetTintProgramResidencyBudget(device.Get(), 0);
+
+    Ref<ShaderModuleMock> a = ShaderModuleMock::Create(mDeviceMock, kShaderA.data());
+    EXPECT_EQ(ResidentCount(), 0u);
+    EXPECT_EQ(EvictedCount(), 1u);
+
+    Ref<SharedTintProgram> program = a->GetTintProgram().AcquireSuccess();
+    ASSERT_NE(program.Get(), nullptr);
+    EXPECT_TRUE(program->GetProgram()->IsValid());
+    EXPECT_EQ(program->GetProgram()->AST().Functions().Length(), 1u);
+
+    // Raising the budget lets the module keep its program the next time it is used.
+    SetTintProgramResidencyBudget(device.Get(), 1);
+    program = a->GetTintProgram().AcquireSuccess();
+    EXPECT_EQ(ResidentCount(), 1u);
+    EXPECT_EQ(EvictedCount(), 0u);
+}
+
+// Test that destroyed modules are no longer counted.
+TEST_F(TintProgramResidencyTests, DestroyedModulesAreUntracked) {
+    SetTintProgramResidencyBudget(device.Get(), 1);
+
+    Ref<ShaderModuleMock> a = ShaderModuleMock::Create(mDeviceMock, kShaderA.data());
+    Ref<ShaderModuleMock> b = ShaderModuleMock::Create(mDeviceMock, kShaderB.data());
+    EXPECT_EQ(ResidentCount(), 1u);
+    EXPECT_EQ(EvictedCount(), 1u);
+
+    a = nullptr;
+    EXPECT_EQ(ResidentCount(), 1u);
+    EXPECT_EQ(EvictedCount(), 0u);
+
+    b = nullptr;
+    EXPECT_EQ(ResidentCount(), 0u);
+    EXPECT_EQ(EvictedCount(), 0u);
+}
+
+}  // namespace
+}  // namespace dawn::native
@@ -121,6 +121,10 @@ dawn::platform::Platform* DeviceMock::GetPlatform() const {
     return mInstance->GetPlatform();
 }
 
+TintProgramCache* DeviceMock::GetTintProgramCache() const {
+    return mInstance->GetTintProgramCache();
+}
+
 QueueMock* DeviceMock::GetQueueMock() {
     return reinterpret_cast<QueueMock*>(GetQueue());
 }
@@ -36,11 +36,12 @@ class DeviceMock : public DeviceBase {
 
     // TODO(lokokung): Use real DeviceBase constructor instead of mock specific one.
     //       - Requires AdapterMock.
-    //       - Can probably remove GetPlatform overload.
+    //       - Can probably remove GetPlatform and GetTintProgramCache overloads.
     //       - Allows removing ForceSetToggleForTesting calls.
     DeviceMock();
     ~DeviceMock() override;
     dawn::platform::Platform* GetPlatform() const override;
+    TintProgramCache* GetTintProgramCache() const override;
 
     // Mock specific functionality.
     QueueMock* GetQueueMock();
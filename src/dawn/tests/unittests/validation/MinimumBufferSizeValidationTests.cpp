@@ -498,6 +498,31 @@ TEST_F(MinBufferSizeDrawTimeValidationTests, MultipleGroups) {
     });
 }
 
+// Draw time validation results that are cached for a pipeline and bind group don't apply to
+// other bind groups.
+TEST_F(MinBufferSizeDrawTimeValidationTests, CachedValidationResults) {
+    std::vector<BindingDescriptor> bindings = {{0, 0, "a : f32, b : f32, c : f32", "f32", "a", 12},
+                                               {0, 1, "d : f32, e : f32", "f32", "d", 8}};
+
+    std::string computeShader = CreateComputeShaderWithBindings(bindings);
+    std::string vertexShader = CreateVertexShaderWithBindings({});
+    std::string fragShader = CreateFragmentShaderWithBindings(bindings);
+
+    wgpu::BindGroupLayout layout = CreateBindGroupLayout(bindings, {0, 0});
+
+    wgpu::ComputePipeline computePipeline = CreateComputePipeline({layout}, computeShader);
+    wgpu::RenderPipeline renderPipeline = CreateRenderPipeline({layout}, vertexShader, fragShader);
+
+    wgpu::BindGroup validBindGroup = CreateBindGroup(layout, bindings, {12, 8});
+    wgpu::BindGroup invalidBindGroup = CreateBindGroup(layout, bindings, {12, 4});
+    for (uint32_t i = 0; i < 2; ++i) {
+        TestDispatch(computePipeline, {validBindGroup}, true);
+        TestDraw(renderPipeline, {validBindGroup}, true);
+        TestDispatch(computePipeline, {invalidBindGroup}, false);
+        TestDraw(renderPipeline, {invalidBindGroup}, false);
+    }
+}
+
 // The correctness of minimum buffer size for the defaulted layout for a pipeline
 class MinBufferSizeDefaultLayoutTests : public MinBufferSizeTestsBase {
   public:
@@ -176,6 +176,83 @@ TEST_F(ResourceUsageTrackingTest, BufferWithReadAndWriteUsage) {
     }
 }
 
+// Test that the usages of a buffer are tracked per pass when the passes of two encoders are
+// interleaved, including after the other pass has ended.
+TEST_F(ResourceUsageTrackingTest, BufferWithReadAndWriteUsageInInterleavedPasses) {
+    wgpu::Buffer buffer = CreateBuffer(4, wgpu::BufferUsage::Storage | wgpu::BufferUsage::Index);
+
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Fragment, wgpu::BufferBindingType::Storage}});
+    wgpu::BindGroup bg = utils::MakeBindGroup(device, bgl, {{0, buffer}});
+
+    PlaceholderRenderPass placeholderRenderPass0(device);
+    PlaceholderRenderPass placeholderRenderPass1(device);
+    wgpu::CommandEncoder encoder0 = device.CreateCommandEncoder();
+    wgpu::CommandEncoder encoder1 = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass0 = encoder0.BeginRenderPass(&placeholderRenderPass0);
+    wgpu::RenderPassEncoder pass1 = encoder1.BeginRenderPass(&placeholderRenderPass1);
+
+    // Both passes use the buffer as an index buffer, which is valid.
+    pass0.SetIndexBuffer(buffer, wgpu::IndexFormat::Uint32);
+    pass1.SetIndexBuffer(buffer, wgpu::IndexFormat::Uint32);
+    pass0.End();
+    encoder0.Finish();
+
+    // It is invalid to also use the buffer as storage in the second pass.
+    pass1.SetBindGroup(0, bg);
+    pass1.End();
+    ASSERT_DEVICE_ERROR(encoder1.Finish());
+}
+
+// Test that the usages of a render bundle are tracked in each pass that executes it, even when
+// it is executed several times.
+TEST_F(ResourceUsageTrackingTest, BufferUsedInRenderBundleExecutedInSeveralPasses) {
+    wgpu::Buffer buffer = CreateBuffer(4, wgpu::BufferUsage::Storage | wgpu::BufferUsage::Index);
+
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Fragment, wgpu::BufferBindingType::Storage}});
+    wgpu::BindGroup bg = utils::MakeBindGroup(device, bgl, {{0, buffer}});
+
+    PlaceholderRenderPass placeholderRenderPass(device);
+    wgpu::RenderBundleEncoderDescriptor bundleDesc;
+    bundleDesc.colorFormatsCount = 1;
+    bundleDesc.colorFormats = &placeholderRenderPass.attachmentFormat;
+    wgpu::RenderBundleEncoder bundleEncoder = device.CreateRenderBundleEncoder(&bundleDesc);
+    bundleEncoder.SetBindGroup(0, bg);
+    wgpu::RenderBundle bundle = bundleEncoder.Finish();
+
+    // Executing the bundle several times in a pass is valid.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&placeholderRenderPass);
+        pass.ExecuteBundles(1, &bundle);
+        pass.ExecuteBundles(1, &bundle);
+        pass.End();
+        encoder.Finish();
+    }
+
+    // Using the buffer as an index buffer after executing the bundle in another pass is invalid.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&placeholderRenderPass);
+        pass.ExecuteBundles(1, &bundle);
+        pass.SetIndexBuffer(buffer, wgpu::IndexFormat::Uint32);
+        pass.ExecuteBundles(1, &bundle);
+        pass.End();
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+
+    // Using the buffer as an index buffer before executing the bundle is invalid too.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&placeholderRenderPass);
+        pass.SetIndexBuffer(buffer, wgpu::IndexFormat::Uint32);
+        pass.ExecuteBundles(1, &bundle);
+        pass.End();
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+}
+
 // Test the use of a buffer as a storage buffer multiple times in the same synchronization
 // scope.
 TEST_F(ResourceUsageTrackingTest, BufferUsedAsStorageMultipleTimes) {
@@ -0,0 +1,88 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <vector>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+
+namespace dawn::wire {
+namespace {
+
+using testing::Return;
+
+class WireCommandProfilingTests : public WireTest {
+  protected:
+    const WireCommandProfile* FindProfile(const std::vector<WireCommandProfile>& profiles,
+                                          const char* name) {
+        for (const WireCommandProfile& profile : profiles) {
+            if (strcmp(profile.name, name) == 0) {
+                return &profile;
+            }
+        }
+        return nullptr;
+    }
+};
+
+// Test that no commands are profiled by default.
+TEST_F(WireCommandProfilingTests, DisabledByDefault) {
+    wgpuDeviceCreateCommandEncoder(device, nullptr);
+    EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+        .WillOnce(Return(api.GetNewCommandEncoder()));
+    FlushClient();
+
+    EXPECT_TRUE(GetWireServer()->GetCommandProfiles().empty());
+}
+
+// Test that the commands handled while profiling is enabled are counted by type.
+TEST_F(WireCommandProfilingTests, CommandsAreCounted) {
+    GetWireServer()->SetCommandProfilingEnabled(true);
+
+    WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+    wgpuDeviceCreateCommandEncoder(device, nullptr);
+    wgpuCommandEncoderFinish(encoder, nullptr);
+
+    WGPUCommandEncoder apiEncoder = api.GetNewCommandEncoder();
+    EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+        .WillOnce(Return(apiEncoder))
+        .WillOnce(Return(api.GetNewCommandEncoder()));
+    EXPECT_CALL(api, CommandEncoderFinish(apiEncoder, nullptr))
+        .WillOnce(Return(api.GetNewCommandBuffer()));
+    FlushClient();
+
+    std::vector<WireCommandProfile> profiles = GetWireServer()->GetCommandProfiles();
+    const WireCommandProfile* createEncoder = FindProfile(profiles, "DeviceCreateCommandEncoder");
+    ASSERT_NE(createEncoder, nullptr);
+    EXPECT_EQ(createEncoder->count, 2u);
+    EXPECT_GT(createEncoder->bytes, 0u);
+
+    const WireCommandProfile* finish = FindProfile(profiles, "CommandEncoderFinish");
+    ASSERT_NE(finish, nullptr);
+    EXPECT_EQ(finish->count, 1u);
+
+    // Commands handled after profiling is disabled aren't counted.
+    GetWireServer()->SetCommandProfilingEnabled(false);
+    wgpuDeviceCreateCommandEncoder(device, nullptr);
+    EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+        .WillOnce(Return(api.GetNewCommandEncoder()));
+    FlushClient();
+
+    profiles = GetWireServer()->GetCommandProfiles();
+    createEncoder = FindProfile(profiles, "DeviceCreateCommandEncoder");
+    ASSERT_NE(createEncoder, nullptr);
+    EXPECT_EQ(createEncoder->count, 2u);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
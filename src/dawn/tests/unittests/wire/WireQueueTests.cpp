@@ -12,16 +12,27 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstring>
 #include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "dawn/tests/unittests/wire/WireTest.h"
 #include "dawn/wire/WireClient.h"
+#include "dawn/wire/client/ClientMemoryTransferService_mock.h"
+#include "dawn/wire/server/ServerMemoryTransferService_mock.h"
 
 namespace dawn::wire {
 
 using testing::_;
+using testing::Eq;
 using testing::InvokeWithoutArgs;
 using testing::Mock;
+using testing::Pointee;
+using testing::Return;
+using testing::StrictMock;
+using testing::WithArg;
 
 class MockQueueWorkDoneCallback {
   public:
@@ -193,6 +204,192 @@ TEST_F(WireQueueTests, DeviceThenDefaultQueueReleased) {
     DefaultApiDeviceWasReleased();
 }
 
+// WireQueueWriteFromHandleTests test Queue::WriteBuffer and Queue::WriteTexture with a
+// MemoryTransferService that sends the payloads by reference in a WriteHandle.
+class WireQueueWriteFromHandleTests : public WireQueueTests {
+  public:
+    client::MemoryTransferService* GetClientMemoryTransferService() override {
+        return &clientMemoryTransferService;
+    }
+
+    server::MemoryTransferService* GetServerMemoryTransferService() override {
+        return &serverMemoryTransferService;
+    }
+
+  protected:
+    using ClientWriteHandle = client::MockMemoryTransferService::MockWriteHandle;
+    using ServerWriteHandle = server::MockMemoryTransferService::MockWriteHandle;
+
+    static constexpr size_t kDataSize = 16;
+
+    void FlushClient(bool success = true) {
+        WireQueueTests::FlushClient(success);
+        Mock::VerifyAndClearExpectations(&clientMemoryTransferService);
+        Mock::VerifyAndClearExpectations(&serverMemoryTransferService);
+    }
+
+    std::pair<WGPUBuffer, WGPUBuffer> CreateBuffer() {
+        WGPUBufferDescriptor descriptor = {};
+        descriptor.size = kDataSize;
+        descriptor.usage = WGPUBufferUsage_CopyDst;
+
+        WGPUBuffer apiBuffer = api.GetNewBuffer();
+        WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+        EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+        FlushClient();
+
+        return std::make_pair(apiBuffer, buffer);
+    }
+
+    // Expects the client to create, serialize and destroy a handle with the payload.
+    ClientWriteHandle* ExpectClientWriteHandle() {
+        ClientWriteHandle* handle = clientMemoryTransferService.NewWriteHandle();
+
+        EXPECT_CALL(clientMemoryTransferService, OnCreateQueueWriteHandle(kDataSize))
+            .WillOnce(Return(handle));
+        EXPECT_CALL(clientMemoryTransferService, OnWriteHandleGetData(handle))
+            .WillRepeatedly(Return(mHandleData.data()));
+        EXPECT_CALL(clientMemoryTransferService, OnWriteHandleSerializeCreateSize(handle))
+            .WillOnce(Return(sizeof(kSerializeCreateInfo)));
+        EXPECT_CALL(clientMemoryTransferService, OnWriteHandleSerializeCreate(handle, _))
+            .WillOnce(WithArg<1>([&](void* serializePointer) {
+                memcpy(serializePointer, &kSerializeCreateInfo, sizeof(kSerializeCreateInfo));
+            }));
+        EXPECT_CALL(clientMemoryTransferService,
+                    OnWriteHandleSizeOfSerializeDataUpdate(handle, 0, kDataSize))
+            .WillOnce(Return(sizeof(kSerializeDataInfo)));
+        EXPECT_CALL(clientMemoryTransferService,
+                    OnWriteHandleSerializeDataUpdate(handle, _, 0, kDataSize))
+            .WillOnce(WithArg<1>([&](void* serializePointer) {
+                memcpy(serializePointer, &kSerializeDataInfo, sizeof(kSerializeDataInfo));
+                return sizeof(kSerializeDataInfo);
+            }));
+        EXPECT_CALL(clientMemoryTransferService, OnWriteHandleDestroy(handle)).Times(1);
+
+        return handle;
+    }
+
+    // Expects the server to deserialize the handle and copy the payload to its staging memory.
+    ServerWriteHandle* ExpectServerWriteHandle() {
+        ServerWriteHandle* handle = serverMemoryTransferService.NewWriteHandle();
+
+        EXPECT_CALL(serverMemoryTransferService,
+                    OnDeserializeWriteHandle(Pointee(Eq(kSerializeCreateInfo)),
+                                             sizeof(kSerializeCreateInfo), _))
+            .WillOnce(WithArg<2>([=](server::MemoryTransferService::WriteHandle** writeHandle) {
+                *writeHandle = handle;
+                return true;
+            }));
+        EXPECT_CALL(serverMemoryTransferService,
+                    OnWriteHandleDeserializeDataUpdate(handle, Pointee(Eq(kSerializeDataInfo)),
+                                                       sizeof(kSerializeDataInfo), 0, kDataSize))
+            .WillOnce(InvokeWithoutArgs([=]() {
+                memcpy(const_cast<uint32_t*>(handle->GetData()), mHandleData.data(), kDataSize);
+                return true;
+            }));
+        EXPECT_CALL(serverMemoryTransferService, OnWriteHandleDestroy(handle)).Times(1);
+
+        return handle;
+    }
+
+    // Returns a matcher for the payload of the write.
+    testing::Matcher<const void*> IsPayload() {
+        return MatchesLambda([&](const void* data) -> bool {
+            return memcmp(data, mPayload.data(), kDataSize) == 0;
+        });
+    }
+
+    static constexpr uint32_t kSerializeCreateInfo = 4242;
+    static constexpr uint32_t kSerializeDataInfo = 1394;
+
+    std::vector<uint8_t> mPayload = std::vector<uint8_t>(kDataSize, 0x5A);
+    // The memory of the client and server handles.
+    std::vector<uint8_t> mHandleData = std::vector<uint8_t>(kDataSize, 0);
+
+    StrictMock<server::MockMemoryTransferService> serverMemoryTransferService;
+    StrictMock<client::MockMemoryTransferService> clientMemoryTransferService;
+};
+
+// Test that the payload of a WriteBuffer is sent in a WriteHandle.
+TEST_F(WireQueueWriteFromHandleTests, WriteBufferSuccess) {
+    WGPUBuffer buffer;
+    WGPUBuffer apiBuffer;
+    std::tie(apiBuffer, buffer) = CreateBuffer();
+
+    ExpectClientWriteHandle();
+    wgpuQueueWriteBuffer(queue, buffer, 0, mPayload.data(), kDataSize);
+
+    ExpectServerWriteHandle();
+    EXPECT_CALL(api, QueueWriteBuffer(apiQueue, apiBuffer, 0, IsPayload(), kDataSize)).Times(1);
+    FlushClient();
+}
+
+// Test that the payload of a WriteTexture is sent in a WriteHandle.
+TEST_F(WireQueueWriteFromHandleTests, WriteTextureSuccess) {
+    WGPUTextureDescriptor descriptor = {};
+    WGPUTexture texture = wgpuDeviceCreateTexture(device, &descriptor);
+    WGPUTexture apiTexture = api.GetNewTexture();
+    EXPECT_CALL(api, DeviceCreateTexture(apiDevice, _)).WillOnce(Return(apiTexture));
+    FlushClient();
+
+    WGPUImageCopyTexture destination = {};
+    destination.texture = texture;
+    WGPUTextureDataLayout dataLayout = {};
+    WGPUExtent3D writeSize = {1, 1, 1};
+
+    ExpectClientWriteHandle();
+    wgpuQueueWriteTexture(queue, &destination, mPayload.data(), kDataSize, &dataLayout,
+                          &writeSize);
+
+    ExpectServerWriteHandle();
+    EXPECT_CALL(api, QueueWriteTexture(apiQueue, _, IsPayload(), kDataSize, _, _)).Times(1);
+    FlushClient();
+}
+
+// Test that a failure to deserialize the WriteHandle is a fatal error.
+TEST_F(WireQueueWriteFromHandleTests, DeserializeWriteHandleFailure) {
+    WGPUBuffer buffer;
+    WGPUBuffer apiBuffer;
+    std::tie(apiBuffer, buffer) = CreateBuffer();
+
+    ExpectClientWriteHandle();
+    wgpuQueueWriteBuffer(queue, buffer, 0, mPayload.data(), kDataSize);
+
+    EXPECT_CALL(serverMemoryTransferService,
+                OnDeserializeWriteHandle(Pointee(Eq(kSerializeCreateInfo)),
+                                         sizeof(kSerializeCreateInfo), _))
+        .WillOnce(Return(false));
+    FlushClient(false);
+}
+
+// Test that a write to an object unknown to the server is a fatal error, and that the server
+// doesn't deserialize the WriteHandle.
+TEST_F(WireQueueWriteFromHandleTests, UnknownDestination) {
+    WGPUTextureDescriptor descriptor = {};
+    ReservedTexture reservation = GetWireClient()->ReserveTexture(device, &descriptor);
+
+    WGPUImageCopyTexture destination = {};
+    destination.texture = reservation.texture;
+    WGPUTextureDataLayout dataLayout = {};
+    WGPUExtent3D writeSize = {1, 1, 1};
+
+    ExpectClientWriteHandle();
+    wgpuQueueWriteTexture(queue, &destination, mPayload.data(), kDataSize, &dataLayout,
+                          &writeSize);
+    FlushClient(false);
+}
+
+// Test that no WriteHandle is created once the wire is disconnected.
+TEST_F(WireQueueWriteFromHandleTests, WriteAfterDisconnect) {
+    WGPUBuffer buffer;
+    WGPUBuffer apiBuffer;
+    std::tie(apiBuffer, buffer) = CreateBuffer();
+
+    GetWireClient()->Disconnect();
+    wgpuQueueWriteBuffer(queue, buffer, 0, mPayload.data(), kDataSize);
+    FlushClient();
+}
+
 // Only one default queue is supported now so we cannot test ~Queue triggering ClearAllCallbacks
 // since it is always destructed after the test TearDown, and we cannot create a new queue obj
 // with wgpuDeviceGetQueue
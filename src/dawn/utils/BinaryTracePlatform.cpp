@@ -0,0 +1,434 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/utils/BinaryTracePlatform.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Compiler.h"
+#include "dawn/common/Math.h"
+#include "dawn/common/Platform.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+
+#if DAWN_PLATFORM_IS(X86)
+#if DAWN_COMPILER_IS(MSVC)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace utils {
+
+namespace {
+
+constexpr size_t kRecordAlignment = 8;
+
+// The last category is used for the events whose category flag isn't one of kCategoryEnabled.
+constexpr const char* kCategoryNames[] = {"General", "Validation", "Recording", "GPUWork",
+                                          "Unknown"};
+constexpr uint8_t kUnknownCategory = std::size(kCategoryNames) - 1;
+
+// The trace event macros cache the flags of the first platform they are used with, so the flags
+// are shared by all the platforms instead of being members. The flags the macros pass back may
+// still come from another kind of platform.
+constexpr unsigned char kCategoryEnabled[kUnknownCategory] = {1, 1, 1, 1};
+
+static_assert(static_cast<uint32_t>(dawn::platform::TraceCategory::General) == 0);
+static_assert(static_cast<uint32_t>(dawn::platform::TraceCategory::Validation) == 1);
+static_assert(static_cast<uint32_t>(dawn::platform::TraceCategory::Recording) == 2);
+static_assert(static_cast<uint32_t>(dawn::platform::TraceCategory::GPUWork) == 3);
+
+static_assert(sizeof(BinaryTraceEvent) == 24);
+static_assert(sizeof(BinaryTraceEventsHeader) % kRecordAlignment == 0);
+
+std::atomic<uint64_t> sNextPlatformId{1};
+
+// Returns the index of the category of a flag returned by GetTraceCategoryEnabledFlag, or
+// kUnknownCategory if the flag belongs to another platform.
+uint8_t GetCategory(const unsigned char* categoryGroupEnabled) {
+    for (uint8_t category = 0; category < std::size(kCategoryEnabled); ++category) {
+        if (categoryGroupEnabled == &kCategoryEnabled[category]) {
+            return category;
+        }
+    }
+    return kUnknownCategory;
+}
+
+// The clock of the timestamps. Reading the time stamp counter is several times cheaper than
+// steady_clock::now(), which is a large part of the cost of an event. It assumes an invariant
+// time stamp counter, synchronized between the cores, like x86 CPUs of the last decade have.
+uint64_t ReadClock() {
+#if DAWN_PLATFORM_IS(X86)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+// The buffer used last by the current thread, and the platform it belongs to.
+thread_local uint64_t tCachedPlatformId = 0;
+thread_local void* tCachedBuffer = nullptr;
+
+void WriteJSONString(std::ostream* json, const std::string& value) {
+    *json << '"';
+    for (char c : value) {
+        switch (c) {
+            case '"':
+                *json << "\\\"";
+                break;
+            case '\\':
+                *json << "\\\\";
+                break;
+            case '\n':
+                *json << "\\n";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    *json << escaped;
+                } else {
+                    *json << c;
+                }
+                break;
+        }
+    }
+    *json << '"';
+}
+
+}  // anonymous namespace
+
+BinaryTracePlatform::ThreadBuffer::ThreadBuffer(std::thread::id thread,
+                                                uint32_t threadIndex,
+                                                size_t capacity)
+    : thread(thread),
+      threadIndex(threadIndex),
+      mask(capacity - 1),
+      events(new BinaryTraceEvent[capacity]) {
+    ASSERT(IsPowerOfTwo(capacity));
+}
+
+// static
+std::unique_ptr<BinaryTracePlatform> BinaryTracePlatform::Create(const char* path,
+                                                                 size_t eventsPerThread) {
+    std::unique_ptr<BinaryTracePlatform> platform(
+        new BinaryTracePlatform(NextPowerOfTwo(std::max(eventsPerThread, size_t(1)))));
+    platform->mFile.open(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!platform->mFile.is_open()) {
+        return nullptr;
+    }
+
+    BinaryTraceHeader header = {BinaryTraceHeader::kMagic, BinaryTraceHeader::kVersion};
+    platform->mFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return platform;
+}
+
+BinaryTracePlatform::BinaryTracePlatform(size_t eventsPerThread)
+    : mId(sNextPlatformId.fetch_add(1, std::memory_order_relaxed)),
+      mEventsPerThread(eventsPerThread),
+      mOrigin(std::chrono::steady_clock::now()),
+      mOriginTicks(ReadClock()) {}
+
+BinaryTracePlatform::~BinaryTracePlatform() {
+    Flush();
+}
+
+void BinaryTracePlatform::Flush() {
+    std::lock_guard<std::mutex> flushLock(mFlushMutex);
+
+    std::vector<ThreadBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+        for (const std::unique_ptr<ThreadBuffer>& buffer : mThreadBuffers) {
+            buffers.push_back(buffer.get());
+        }
+    }
+
+    // The timestamps are in ticks of the clock since the origin. Measure the duration of a tick
+    // over the whole lifetime of the platform so far.
+    double elapsedSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - mOrigin).count();
+    uint64_t elapsedTicks = ReadClock() - mOriginTicks;
+    double secondsPerTick = elapsedTicks > 0 ? elapsedSeconds / elapsedTicks : 0.0;
+
+    // The names of the events are interned before the events are published, so loading the
+    // heads first guarantees that all the names the events use are written before them.
+    std::vector<uint64_t> heads;
+    for (ThreadBuffer* buffer : buffers) {
+        heads.push_back(buffer->head.load(std::memory_order_acquire));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mNamesMutex);
+        for (; mFlushedNameCount < mNames.size(); ++mFlushedNameCount) {
+            const std::string* name = mNames[mFlushedNameCount];
+            WriteRecord(BinaryTraceRecordType::Name, nullptr, 0, name->data(), name->size());
+        }
+    }
+
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        ThreadBuffer* buffer = buffers[i];
+        uint64_t head = heads[i];
+        uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+        uint64_t droppedEventCount = buffer->droppedEventCount.load(std::memory_order_relaxed);
+        if (head == tail && droppedEventCount == buffer->flushedDroppedEventCount) {
+            continue;
+        }
+
+        mFlushedEvents.clear();
+        for (uint64_t event = tail; event < head; ++event) {
+            mFlushedEvents.push_back(buffer->events[event & buffer->mask]);
+            mFlushedEvents.back().timestamp *= secondsPerTick;
+        }
+        // Let the thread reuse the space of the events once they are copied.
+        buffer->tail.store(head, std::memory_order_release);
+
+        BinaryTraceEventsHeader header = {
+            buffer->threadIndex,
+            static_cast<uint32_t>(droppedEventCount - buffer->flushedDroppedEventCount)};
+        buffer->flushedDroppedEventCount = droppedEventCount;
+        WriteRecord(BinaryTraceRecordType::Events, &header, sizeof(header), mFlushedEvents.data(),
+                    mFlushedEvents.size() * sizeof(BinaryTraceEvent));
+    }
+
+    mFile.flush();
+}
+
+uint64_t BinaryTracePlatform::GetDroppedEventCount() const {
+    uint64_t droppedEventCount = 0;
+    std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+    for (const std::unique_ptr<ThreadBuffer>& buffer : mThreadBuffers) {
+        droppedEventCount += buffer->droppedEventCount.load(std::memory_order_relaxed);
+    }
+    return droppedEventCount;
+}
+
+const unsigned char* BinaryTracePlatform::GetTraceCategoryEnabledFlag(
+    dawn::platform::TraceCategory category) {
+    size_t index = static_cast<size_t>(category);
+    ASSERT(index < std::size(kCategoryEnabled));
+    return &kCategoryEnabled[index];
+}
+
+double BinaryTracePlatform::MonotonicallyIncreasingTime() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+uint64_t BinaryTracePlatform::AddTraceEvent(char phase,
+                                            const unsigned char* categoryGroupEnabled,
+                                            const char* name,
+                                            uint64_t id,
+                                            double timestamp,
+                                            int numArgs,
+                                            const char** argNames,
+                                            const unsigned char* argTypes,
+                                            const uint64_t* argValues,
+                                            unsigned char flags) {
+    ThreadBuffer* buffer = GetThreadBuffer();
+    // Only this thread writes the head so it can be read without synchronization.
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    if (head - buffer->tail.load(std::memory_order_acquire) > buffer->mask) {
+        buffer->droppedEventCount.store(
+            buffer->droppedEventCount.load(std::memory_order_relaxed) + 1,
+            std::memory_order_relaxed);
+        return 0;
+    }
+
+    // The timestamp given by the tracing macros is ignored in favor of the cheaper clock, which
+    // Flush() converts to seconds.
+    BinaryTraceEvent& event = buffer->events[head & buffer->mask];
+    event.timestamp = static_cast<double>(GetTimestampTicks());
+    event.id = id;
+    event.name = InternName(buffer, name, (flags & TRACE_EVENT_FLAG_COPY) != 0);
+    event.phase = phase;
+    event.category = GetCategory(categoryGroupEnabled);
+    event.flags = flags;
+    event.padding = 0;
+    buffer->head.store(head + 1, std::memory_order_release);
+    return 0;
+}
+
+uint64_t BinaryTracePlatform::GetTimestampTicks() const {
+    return ReadClock() - mOriginTicks;
+}
+
+BinaryTracePlatform::ThreadBuffer* BinaryTracePlatform::GetThreadBuffer() {
+    if (tCachedPlatformId == mId) {
+        return static_cast<ThreadBuffer*>(tCachedBuffer);
+    }
+
+    std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+    std::thread::id thread = std::this_thread::get_id();
+    ThreadBuffer* buffer = nullptr;
+    for (const std::unique_ptr<ThreadBuffer>& threadBuffer : mThreadBuffers) {
+        if (threadBuffer->thread == thread) {
+            buffer = threadBuffer.get();
+            break;
+        }
+    }
+    if (buffer == nullptr) {
+        mThreadBuffers.push_back(std::make_unique<ThreadBuffer>(
+            thread, static_cast<uint32_t>(mThreadBuffers.size()), mEventsPerThread));
+        buffer = mThreadBuffers.back().get();
+    }
+
+    tCachedPlatformId = mId;
+    tCachedBuffer = buffer;
+    return buffer;
+}
+
+uint32_t BinaryTracePlatform::InternName(ThreadBuffer* buffer, const char* name, bool copy) {
+    // Names that aren't copied are string literals, so their address identifies them and can be
+    // cached. Copied names are looked up by content every time.
+    size_t slot = 0;
+    if (!copy) {
+        uintptr_t address = reinterpret_cast<uintptr_t>(name);
+        slot = (address ^ (address >> 8)) % ThreadBuffer::kNameCacheSize;
+        if (buffer->cachedNames[slot] == name) {
+            return buffer->cachedNameIndices[slot];
+        }
+    }
+
+    uint32_t index;
+    {
+        std::lock_guard<std::mutex> lock(mNamesMutex);
+        auto [it, inserted] =
+            mNameIndices.emplace(name, static_cast<uint32_t>(mNameIndices.size()));
+        if (inserted) {
+            mNames.push_back(&it->first);
+        }
+        index = it->second;
+    }
+
+    if (!copy) {
+        buffer->cachedNames[slot] = name;
+        buffer->cachedNameIndices[slot] = index;
+    }
+    return index;
+}
+
+void BinaryTracePlatform::WriteRecord(BinaryTraceRecordType type,
+                                      const void* header,
+                                      size_t headerSize,
+                                      const void* data,
+                                      size_t dataSize) {
+    size_t size = headerSize + dataSize;
+    BinaryTraceRecordHeader recordHeader = {type, 0, size};
+    constexpr char kPadding[kRecordAlignment] = {};
+    size_t paddingSize = Align(size, kRecordAlignment) - size;
+
+    mFile.write(reinterpret_cast<const char*>(&recordHeader), sizeof(recordHeader));
+    mFile.write(static_cast<const char*>(header), headerSize);
+    mFile.write(static_cast<const char*>(data), dataSize);
+    mFile.write(kPadding, paddingSize);
+}
+
+bool ConvertBinaryTraceToJSON(const char* path, std::ostream* json) {
+    std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    BinaryTraceHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != BinaryTraceHeader::kMagic ||
+        header.version != BinaryTraceHeader::kVersion) {
+        return false;
+    }
+
+    file.seekg(0, std::ios_base::end);
+    uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(sizeof(header));
+
+    std::vector<std::string> names;
+    std::vector<char> data;
+    bool firstEvent = true;
+    *json << "{\"traceEvents\":[";
+
+    BinaryTraceRecordHeader recordHeader;
+    while (file.read(reinterpret_cast<char*>(&recordHeader), sizeof(recordHeader))) {
+        // Check the size against what is left in the file before allocating anything.
+        uint64_t remainingSize = fileSize - static_cast<uint64_t>(file.tellg());
+        uint64_t paddingSize = Align(recordHeader.size, kRecordAlignment) - recordHeader.size;
+        if (recordHeader.size > remainingSize) {
+            return false;
+        }
+        data.resize(recordHeader.size);
+        char padding[kRecordAlignment];
+        if (!file.read(data.data(), data.size()) || !file.read(padding, paddingSize)) {
+            return false;
+        }
+
+        switch (recordHeader.type) {
+            case BinaryTraceRecordType::Name:
+                names.emplace_back(data.data(), data.size());
+                break;
+
+            case BinaryTraceRecordType::Events: {
+                BinaryTraceEventsHeader eventsHeader;
+                if (data.size() < sizeof(eventsHeader) ||
+                    (data.size() - sizeof(eventsHeader)) % sizeof(BinaryTraceEvent) != 0) {
+                    return false;
+                }
+                memcpy(&eventsHeader, data.data(), sizeof(eventsHeader));
+
+                size_t eventCount = (data.size() - sizeof(eventsHeader)) / sizeof(BinaryTraceEvent);
+                for (size_t i = 0; i < eventCount; ++i) {
+                    BinaryTraceEvent event;
+                    memcpy(&event,
+                           data.data() + sizeof(eventsHeader) + i * sizeof(BinaryTraceEvent),
+                           sizeof(event));
+                    if (event.name >= names.size() || event.category >= std::size(kCategoryNames)) {
+                        return false;
+                    }
+
+                    *json << (firstEvent ? "\n" : ",\n") << "{\"name\":";
+                    WriteJSONString(json, names[event.name]);
+                    *json << ",\"cat\":\"" << kCategoryNames[event.category] << "\",\"ph\":";
+                    WriteJSONString(json, std::string(1, event.phase));
+                    // The JSON timestamps are in microseconds, with a fractional part so that
+                    // events less than a microsecond apart stay ordered.
+                    char timestamp[32];
+                    snprintf(timestamp, sizeof(timestamp), "%.3f", event.timestamp * 1'000'000.0);
+                    *json << ",\"ts\":" << timestamp << ",\"pid\":0,\"tid\":"
+                          << eventsHeader.threadIndex;
+                    if (event.flags & TRACE_EVENT_FLAG_HAS_ID) {
+                        *json << ",\"id\":" << event.id;
+                    }
+                    *json << "}";
+                    firstEvent = false;
+                }
+                break;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    *json << "\n]}\n";
+    // Only a clean end of file is valid.
+    return file.eof() && file.gcount() == 0;
+}
+
+}  // namespace utils
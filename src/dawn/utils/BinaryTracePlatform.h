@@ -0,0 +1,183 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_UTILS_BINARYTRACEPLATFORM_H_
+#define SRC_DAWN_UTILS_BINARYTRACEPLATFORM_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "dawn/platform/DawnPlatform.h"
+
+namespace utils {
+
+// A binary trace contains the trace events recorded by a BinaryTracePlatform. It can be converted
+// to the JSON trace format of chrome://tracing and Perfetto with ConvertBinaryTraceToJSON or the
+// dawn_trace_to_json tool. The file is made of a BinaryTraceHeader followed by records, each made
+// of a BinaryTraceRecordHeader and its data padded to 8 bytes.
+
+enum class BinaryTraceRecordType : uint32_t {
+    // The characters of a name used by the events. Names are numbered in the order of their
+    // records, starting at 0.
+    Name = 1,
+    // A BinaryTraceEventsHeader followed by the BinaryTraceEvents recorded by a thread.
+    Events = 2,
+};
+
+struct BinaryTraceHeader {
+    static constexpr uint32_t kMagic = 0x43525444;  // "DTRC"
+    static constexpr uint32_t kVersion = 1;
+
+    uint32_t magic;
+    uint32_t version;
+};
+
+struct BinaryTraceRecordHeader {
+    BinaryTraceRecordType type;
+    uint32_t padding;
+    uint64_t size;
+};
+
+struct BinaryTraceEventsHeader {
+    // The index of the thread in the order in which the threads recorded their first event.
+    uint32_t threadIndex;
+    // The number of events the thread dropped because its buffer was full since the previous
+    // record.
+    uint32_t droppedEventCount;
+};
+
+// The arguments of the events aren't recorded.
+struct BinaryTraceEvent {
+    // In seconds since the creation of the platform.
+    double timestamp;
+    uint64_t id;
+    uint32_t name;
+    char phase;
+    uint8_t category;
+    uint8_t flags;
+    uint8_t padding;
+};
+
+// A dawn::platform::Platform that records the trace events of all the categories in a binary
+// trace file. Each thread records its events in its own fixed-size ring buffer without locks,
+// and the names of the events are interned, so recording an event is cheap enough to be left on.
+// The events are only written to the file by Flush(), which should be called regularly, for
+// example once per frame. Events recorded while the buffer of their thread is full are dropped.
+class BinaryTracePlatform : public dawn::platform::Platform {
+  public:
+    static constexpr size_t kDefaultEventsPerThread = 64 * 1024;
+
+    // Returns nullptr if the file can't be opened. eventsPerThread is rounded up to a power of
+    // two.
+    static std::unique_ptr<BinaryTracePlatform> Create(
+        const char* path,
+        size_t eventsPerThread = kDefaultEventsPerThread);
+    // Flushes the events that are still in the buffers.
+    ~BinaryTracePlatform() override;
+
+    // Writes the events recorded by all the threads to the file. Can be called while other
+    // threads record events.
+    void Flush();
+
+    uint64_t GetDroppedEventCount() const;
+
+    const unsigned char* GetTraceCategoryEnabledFlag(
+        dawn::platform::TraceCategory category) override;
+    double MonotonicallyIncreasingTime() override;
+    // Records the event with a timestamp from a clock that is cheaper to read than steady_clock,
+    // instead of the given one.
+    uint64_t AddTraceEvent(char phase,
+                           const unsigned char* categoryGroupEnabled,
+                           const char* name,
+                           uint64_t id,
+                           double timestamp,
+                           int numArgs,
+                           const char** argNames,
+                           const unsigned char* argTypes,
+                           const uint64_t* argValues,
+                           unsigned char flags) override;
+
+  private:
+    // A single producer, single consumer ring buffer of events. Only the thread that owns it
+    // adds events and only Flush() removes them.
+    struct ThreadBuffer {
+        ThreadBuffer(std::thread::id thread, uint32_t threadIndex, size_t capacity);
+
+        const std::thread::id thread;
+        const uint32_t threadIndex;
+        const size_t mask;
+        std::unique_ptr<BinaryTraceEvent[]> events;
+        std::atomic<uint64_t> head{0};
+        std::atomic<uint64_t> tail{0};
+        std::atomic<uint64_t> droppedEventCount{0};
+        uint64_t flushedDroppedEventCount = 0;
+
+        // A direct-mapped cache of the indices of the names this thread used, only accessed by
+        // the owning thread.
+        static constexpr size_t kNameCacheSize = 256;
+        std::array<const char*, kNameCacheSize> cachedNames = {};
+        std::array<uint32_t, kNameCacheSize> cachedNameIndices = {};
+    };
+
+    explicit BinaryTracePlatform(size_t eventsPerThread);
+
+    // In ticks of the clock since the creation of the platform. Flush() converts them to seconds.
+    uint64_t GetTimestampTicks() const;
+    ThreadBuffer* GetThreadBuffer();
+    uint32_t InternName(ThreadBuffer* buffer, const char* name, bool copy);
+    void WriteRecord(BinaryTraceRecordType type,
+                     const void* header,
+                     size_t headerSize,
+                     const void* data,
+                     size_t dataSize);
+
+    // Identifies the platform in the cache of the buffer of the current thread. Unlike the
+    // address of the platform, it is never reused.
+    const uint64_t mId;
+    const size_t mEventsPerThread;
+    const std::chrono::steady_clock::time_point mOrigin;
+    const uint64_t mOriginTicks;
+
+    mutable std::mutex mThreadBuffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> mThreadBuffers;
+
+    std::mutex mNamesMutex;
+    std::unordered_map<std::string, uint32_t> mNameIndices;
+    // Points to the keys of mNameIndices, in the order of the indices.
+    std::vector<const std::string*> mNames;
+    size_t mFlushedNameCount = 0;
+
+    // Guards the file and the consumer side of the buffers.
+    std::mutex mFlushMutex;
+    std::ofstream mFile;
+    std::vector<BinaryTraceEvent> mFlushedEvents;
+};
+
+// Converts a binary trace to the JSON trace format. Returns false if the file can't be read or
+// isn't a valid binary trace.
+bool ConvertBinaryTraceToJSON(const char* path, std::ostream* json);
+
+}  // namespace utils
+
+#endif  // SRC_DAWN_UTILS_BINARYTRACEPLATFORM_H_
@@ -0,0 +1,118 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/utils/SharedMemory.h"
+
+#include "dawn/common/Platform.h"
+
+#if DAWN_PLATFORM_IS(POSIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if DAWN_PLATFORM_IS(LINUX)
+#include <sys/syscall.h>
+#endif
+
+#if DAWN_PLATFORM_IS(APPLE)
+#include <atomic>
+#include <string>
+#endif
+
+namespace utils {
+
+namespace {
+
+int CreateSharedMemoryFd() {
+#if DAWN_PLATFORM_IS(LINUX)
+    return static_cast<int>(syscall(SYS_memfd_create, "dawn_shared_memory", MFD_CLOEXEC));
+#elif DAWN_PLATFORM_IS(APPLE)
+    // There is no anonymous shared memory so create a uniquely named object and unlink it
+    // right away.
+    static std::atomic<uint32_t> sCounter = 0;
+    std::string name = "/dawn_shared_memory_" + std::to_string(getpid()) + "_" +
+                       std::to_string(sCounter.fetch_add(1));
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+        shm_unlink(name.c_str());
+    }
+    return fd;
+#else
+    return -1;
+#endif
+}
+
+}  // anonymous namespace
+
+// static
+std::unique_ptr<SharedMemory> SharedMemory::Create(size_t size) {
+    int fd = CreateSharedMemoryFd();
+    if (fd < 0) {
+        return nullptr;
+    }
+
+#if DAWN_PLATFORM_IS(POSIX)
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        close(fd);
+        return nullptr;
+    }
+#endif
+    return Import(fd);
+}
+
+// static
+std::unique_ptr<SharedMemory> SharedMemory::Import(int fd) {
+#if DAWN_PLATFORM_IS(POSIX)
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemory>(new SharedMemory(fd, data, size));
+#else
+    return nullptr;
+#endif
+}
+
+SharedMemory::SharedMemory(int fd, void* data, size_t size) : mFd(fd), mData(data), mSize(size) {}
+
+SharedMemory::~SharedMemory() {
+#if DAWN_PLATFORM_IS(POSIX)
+    munmap(mData, mSize);
+    close(mFd);
+#endif
+}
+
+int SharedMemory::GetFd() const {
+    return mFd;
+}
+
+void* SharedMemory::GetData() const {
+    return mData;
+}
+
+size_t SharedMemory::GetSize() const {
+    return mSize;
+}
+
+}  // namespace utils
@@ -0,0 +1,49 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_UTILS_SHAREDMEMORY_H_
+#define SRC_DAWN_UTILS_SHAREDMEMORY_H_
+
+#include <memory>
+
+namespace utils {
+
+// A mapped region of memory that can be shared with other processes through its file descriptor.
+// It is a memfd on Linux and an unlinked shm_open object on Apple platforms. Other platforms
+// aren't supported.
+class SharedMemory {
+  public:
+    // Creates and maps a zero-initialized region of `size` bytes. Returns nullptr on failure.
+    static std::unique_ptr<SharedMemory> Create(size_t size);
+    // Maps the whole region referred to by `fd`, taking ownership of it. Returns nullptr on
+    // failure, in which case `fd` is closed.
+    static std::unique_ptr<SharedMemory> Import(int fd);
+
+    ~SharedMemory();
+
+    int GetFd() const;
+    void* GetData() const;
+    size_t GetSize() const;
+
+  private:
+    SharedMemory(int fd, void* data, size_t size);
+
+    int mFd;
+    void* mData;
+    size_t mSize;
+};
+
+}  // namespace utils
+
+#endif  // SRC_DAWN_UTILS_SHAREDMEMORY_H_
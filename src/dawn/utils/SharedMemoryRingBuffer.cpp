@@ -0,0 +1,380 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/utils/SharedMemoryRingBuffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/common/Platform.h"
+#include "dawn/utils/SharedMemory.h"
+
+#if DAWN_PLATFORM_IS(LINUX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <climits>
+#endif
+
+namespace utils {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x44574952;  // "DWIR"
+constexpr size_t kCacheLineSize = 64;
+constexpr uint64_t kMinCapacity = 4096;
+constexpr uint64_t kMaxCapacity = uint64_t(1) << 30;
+// Commands and batch headers are aligned like the wire aligns its commands.
+constexpr uint64_t kAlignment = 8;
+// How many times a waiter polls before going to sleep on the doorbell.
+constexpr uint32_t kSpinCount = 128;
+
+enum BatchKind : uint32_t {
+    // Zero is not a valid kind so that reading uninitialized memory is caught.
+    Commands = 1,
+    // The rest of the ring until its end is unused, the next batch is at the start of the ring.
+    Wrap = 2,
+};
+
+struct BatchHeader {
+    uint32_t size;
+    uint32_t kind;
+};
+static_assert(sizeof(BatchHeader) == kAlignment);
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+void WaitOnDoorbell(std::atomic<uint32_t>* doorbell, uint32_t value) {
+#if DAWN_PLATFORM_IS(LINUX)
+    // The futex isn't private since the other side can be in another process.
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(doorbell), FUTEX_WAIT, value, nullptr, nullptr,
+            0);
+#else
+    if (doorbell->load() == value) {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+#endif
+}
+
+void RingDoorbell(std::atomic<uint32_t>* doorbell) {
+    doorbell->fetch_add(1);
+#if DAWN_PLATFORM_IS(LINUX)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(doorbell), FUTEX_WAKE, INT_MAX, nullptr,
+            nullptr, 0);
+#endif
+}
+
+// Waits until `ready` returns true, first spinning and then sleeping on `doorbell`. The other side
+// must ring the doorbell after making `ready` true if it sees that `sleeping` is set.
+template <typename F>
+void WaitUntil(std::atomic<uint32_t>* doorbell, std::atomic<uint32_t>* sleeping, F ready) {
+    for (uint32_t i = 0; i < kSpinCount; ++i) {
+        if (ready()) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    while (true) {
+        // Setting `sleeping` before sampling the doorbell and checking `ready` again guarantees
+        // that the other side either rings the doorbell after we sampled it or we see its update.
+        sleeping->store(1);
+        uint32_t value = doorbell->load();
+        if (ready()) {
+            sleeping->store(0);
+            return;
+        }
+        WaitOnDoorbell(doorbell, value);
+        sleeping->store(0);
+    }
+}
+
+}  // anonymous namespace
+
+struct SharedMemoryRingBuffer::Header {
+    uint32_t magic;
+    uint64_t capacity;
+
+    // Written by the producer.
+    alignas(kCacheLineSize) std::atomic<uint64_t> writePosition;
+    std::atomic<uint32_t> writeDoorbell;
+    std::atomic<uint32_t> consumerSleeping;
+
+    // Written by the consumer.
+    alignas(kCacheLineSize) std::atomic<uint64_t> readPosition;
+    std::atomic<uint32_t> readDoorbell;
+    std::atomic<uint32_t> producerSleeping;
+
+    alignas(kCacheLineSize) std::atomic<uint32_t> closed;
+};
+
+// static
+std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Create(size_t capacity) {
+    capacity = NextPowerOfTwo(std::max(uint64_t(capacity), kMinCapacity));
+    if (capacity > kMaxCapacity) {
+        return nullptr;
+    }
+
+    std::unique_ptr<SharedMemory> memory = SharedMemory::Create(sizeof(Header) + capacity);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+
+    // The region is zero-initialized so only the non-zero fields need to be set.
+    Header* header = new (memory->GetData()) Header();
+    header->capacity = capacity;
+    header->magic = kMagic;
+
+    return std::unique_ptr<SharedMemoryRingBuffer>(
+        new SharedMemoryRingBuffer(std::move(memory), capacity));
+}
+
+// static
+std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Import(int fd) {
+    std::unique_ptr<SharedMemory> memory = SharedMemory::Import(fd);
+    if (memory == nullptr || memory->GetSize() < sizeof(Header)) {
+        return nullptr;
+    }
+
+    // Don't trust the other process to have set up the region correctly.
+    const Header* header = static_cast<const Header*>(memory->GetData());
+    uint64_t capacity = header->capacity;
+    if (header->magic != kMagic || !IsPowerOfTwo(capacity) || capacity < kMinCapacity ||
+        capacity > kMaxCapacity || memory->GetSize() < sizeof(Header) + capacity) {
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryRingBuffer>(
+        new SharedMemoryRingBuffer(std::move(memory), capacity));
+}
+
+SharedMemoryRingBuffer::SharedMemoryRingBuffer(std::unique_ptr<SharedMemory> memory,
+                                               size_t capacity)
+    : mMemory(std::move(memory)), mCapacity(capacity) {}
+
+SharedMemoryRingBuffer::~SharedMemoryRingBuffer() = default;
+
+int SharedMemoryRingBuffer::GetFd() const {
+    return mMemory->GetFd();
+}
+
+size_t SharedMemoryRingBuffer::GetCapacity() const {
+    return mCapacity;
+}
+
+void SharedMemoryRingBuffer::Close() {
+    Header* header = GetHeader();
+    header->closed.store(1);
+    RingDoorbell(&header->writeDoorbell);
+    RingDoorbell(&header->readDoorbell);
+}
+
+bool SharedMemoryRingBuffer::IsClosed() const {
+    return GetHeader()->closed.load() != 0;
+}
+
+SharedMemoryRingBuffer::Header* SharedMemoryRingBuffer::GetHeader() const {
+    return static_cast<Header*>(mMemory->GetData());
+}
+
+volatile char* SharedMemoryRingBuffer::GetData() const {
+    return static_cast<volatile char*>(mMemory->GetData()) + sizeof(Header);
+}
+
+SharedMemoryCommandSerializer::SharedMemoryCommandSerializer(SharedMemoryRingBuffer* ring)
+    : mRing(ring), mCursor(ring->GetHeader()->writePosition.load()) {}
+
+SharedMemoryCommandSerializer::~SharedMemoryCommandSerializer() = default;
+
+size_t SharedMemoryCommandSerializer::GetMaximumAllocationSize() const {
+    // Leave room for the consumer to handle a batch while the next one is being written.
+    return mRing->GetCapacity() / 4;
+}
+
+void* SharedMemoryCommandSerializer::GetCmdSpace(size_t size) {
+    if (size > GetMaximumAllocationSize() || mRing->IsClosed()) {
+        return nullptr;
+    }
+
+    const uint64_t capacity = mRing->GetCapacity();
+    const uint64_t alignedSize = Align(uint64_t(size), kAlignment);
+    volatile char* data = mRing->GetData();
+
+    while (true) {
+        uint64_t index = mCursor & (capacity - 1);
+        uint64_t needed = alignedSize + (mBatchOpen ? 0 : sizeof(BatchHeader));
+
+        if (needed > capacity - index) {
+            // Batches must be contiguous so that they can be handled in place. End the current
+            // batch and continue at the start of the ring.
+            if (mBatchOpen) {
+                Publish();
+                continue;
+            }
+            uint64_t skipped = capacity - index;
+            if (!WaitForSpace(skipped)) {
+                return nullptr;
+            }
+            volatile BatchHeader* wrap = reinterpret_cast<volatile BatchHeader*>(data + index);
+            wrap->size = 0;
+            wrap->kind = BatchKind::Wrap;
+            mCursor += skipped;
+            Publish();
+            continue;
+        }
+
+        uint64_t readPosition = mRing->GetHeader()->readPosition.load(std::memory_order_acquire);
+        if (capacity - (mCursor - readPosition) < needed) {
+            // The consumer can't make progress on commands that aren't published.
+            if (mBatchOpen) {
+                Publish();
+                continue;
+            }
+            if (!WaitForSpace(needed)) {
+                return nullptr;
+            }
+        }
+        break;
+    }
+
+    if (!mBatchOpen) {
+        mBatchStart = mCursor;
+        mCursor += sizeof(BatchHeader);
+        mBatchOpen = true;
+    }
+
+    // The wire only writes to the space it gets so drop the volatile qualifier.
+    void* result = const_cast<char*>(data + (mCursor & (capacity - 1)));
+    mCursor += alignedSize;
+    return result;
+}
+
+bool SharedMemoryCommandSerializer::Flush() {
+    if (mBatchOpen) {
+        Publish();
+    }
+    return !mRing->IsClosed();
+}
+
+bool SharedMemoryCommandSerializer::WaitForSpace(uint64_t size) {
+    SharedMemoryRingBuffer::Header* header = mRing->GetHeader();
+    const uint64_t capacity = mRing->GetCapacity();
+    WaitUntil(&header->readDoorbell, &header->producerSleeping, [&] {
+        return capacity - (mCursor - header->readPosition.load()) >= size ||
+               header->closed.load() != 0;
+    });
+    return header->closed.load() == 0;
+}
+
+void SharedMemoryCommandSerializer::Publish() {
+    SharedMemoryRingBuffer::Header* header = mRing->GetHeader();
+
+    if (mBatchOpen) {
+        volatile BatchHeader* batch = reinterpret_cast<volatile BatchHeader*>(
+            mRing->GetData() + (mBatchStart & (mRing->GetCapacity() - 1)));
+        batch->size = static_cast<uint32_t>(mCursor - mBatchStart - sizeof(BatchHeader));
+        batch->kind = BatchKind::Commands;
+        mBatchOpen = false;
+    }
+
+    // Only ring the doorbell when the consumer sleeps, so that a busy consumer doesn't cost a
+    // syscall per flush.
+    header->writePosition.store(mCursor);
+    if (header->consumerSleeping.load() != 0) {
+        RingDoorbell(&header->writeDoorbell);
+    }
+}
+
+SharedMemoryCommandReader::SharedMemoryCommandReader(SharedMemoryRingBuffer* ring,
+                                                     dawn::wire::CommandHandler* handler)
+    : mRing(ring), mHandler(handler), mReadPosition(ring->GetHeader()->readPosition.load()) {}
+
+bool SharedMemoryCommandReader::HandleAvailableCommands() {
+    SharedMemoryRingBuffer::Header* header = mRing->GetHeader();
+    const uint64_t capacity = mRing->GetCapacity();
+    const volatile char* data = mRing->GetData();
+
+    // The producer can be in another process so none of what it writes is trusted.
+    uint64_t writePosition = header->writePosition.load(std::memory_order_acquire);
+    if (writePosition - mReadPosition > capacity) {
+        return false;
+    }
+
+    while (mReadPosition != writePosition) {
+        uint64_t index = mReadPosition & (capacity - 1);
+        uint64_t available = writePosition - mReadPosition;
+        if (available < sizeof(BatchHeader) || capacity - index < sizeof(BatchHeader)) {
+            return false;
+        }
+
+        const volatile BatchHeader* batch =
+            reinterpret_cast<const volatile BatchHeader*>(data + index);
+        uint32_t size = batch->size;
+        uint32_t kind = batch->kind;
+
+        uint64_t consumed;
+        switch (kind) {
+            case BatchKind::Wrap:
+                consumed = capacity - index;
+                if (consumed > available) {
+                    return false;
+                }
+                break;
+
+            case BatchKind::Commands:
+                consumed = sizeof(BatchHeader) + Align(uint64_t(size), kAlignment);
+                if (consumed > available || consumed > capacity - index) {
+                    return false;
+                }
+                if (mHandler->HandleCommands(data + index + sizeof(BatchHeader), size) ==
+                    nullptr) {
+                    return false;
+                }
+                break;
+
+            default:
+                return false;
+        }
+
+        // Give the memory back to the producer after each batch so that it doesn't wait on us
+        // for longer than needed.
+        mReadPosition += consumed;
+        header->readPosition.store(mReadPosition);
+        if (header->producerSleeping.load() != 0) {
+            RingDoorbell(&header->readDoorbell);
+        }
+    }
+    return true;
+}
+
+bool SharedMemoryCommandReader::WaitAndHandleCommands() {
+    SharedMemoryRingBuffer::Header* header = mRing->GetHeader();
+    WaitUntil(&header->writeDoorbell, &header->consumerSleeping, [&] {
+        return header->writePosition.load() != mReadPosition || header->closed.load() != 0;
+    });
+
+    if (header->writePosition.load() == mReadPosition) {
+        // The ring was closed and everything in it was handled.
+        return false;
+    }
+    return HandleAvailableCommands();
+}
+
+}  // namespace utils
@@ -0,0 +1,121 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_UTILS_SHAREDMEMORYRINGBUFFER_H_
+#define SRC_DAWN_UTILS_SHAREDMEMORYRINGBUFFER_H_
+
+#include <cstdint>
+#include <memory>
+
+#include "dawn/wire/Wire.h"
+
+namespace utils {
+
+class SharedMemory;
+
+// A single-producer single-consumer ring buffer of wire commands living in a shared memory region,
+// so that the wire client and server can run on different threads or processes. Each direction of
+// the wire uses its own ring buffer: the producer writes to it with a SharedMemoryCommandSerializer
+// and the consumer passes its content to a CommandHandler with a SharedMemoryCommandReader.
+//
+// Commands are written in place in the ring and grouped in batches that are published to the
+// consumer on Flush(). Batches are always contiguous in memory so that the handler can decode them
+// directly from the shared memory. The producer and consumer only synchronize with atomics, except
+// when one of them has to wait for the other, in which case they sleep on a futex (on Linux).
+class SharedMemoryRingBuffer {
+  public:
+    // Creates a ring buffer with at least `capacity` bytes of command storage. Returns nullptr if
+    // shared memory isn't supported on this platform or the region couldn't be created.
+    static std::unique_ptr<SharedMemoryRingBuffer> Create(size_t capacity);
+    // Maps the ring buffer created by another process, given the file descriptor returned by its
+    // GetFd(). Takes ownership of `fd`. Returns nullptr if the region isn't a valid ring buffer.
+    static std::unique_ptr<SharedMemoryRingBuffer> Import(int fd);
+
+    ~SharedMemoryRingBuffer();
+
+    // The file descriptor of the shared memory region, to send to the other process.
+    int GetFd() const;
+    size_t GetCapacity() const;
+
+    // Marks the ring buffer as closed and wakes up the producer and consumer if they are waiting.
+    // Commands that were already published can still be read after closing.
+    void Close();
+    bool IsClosed() const;
+
+  private:
+    friend class SharedMemoryCommandSerializer;
+    friend class SharedMemoryCommandReader;
+
+    struct Header;
+
+    SharedMemoryRingBuffer(std::unique_ptr<SharedMemory> memory, size_t capacity);
+
+    Header* GetHeader() const;
+    volatile char* GetData() const;
+
+    std::unique_ptr<SharedMemory> mMemory;
+    size_t mCapacity;
+};
+
+// Serializes commands directly into a SharedMemoryRingBuffer. Flush() publishes the commands
+// written since the last flush and only rings the consumer's doorbell if it is sleeping. When the
+// ring is full, GetCmdSpace() publishes the pending commands and waits for the consumer to make
+// room, so the consumer must run on another thread or process.
+class SharedMemoryCommandSerializer : public dawn::wire::CommandSerializer {
+  public:
+    explicit SharedMemoryCommandSerializer(SharedMemoryRingBuffer* ring);
+    ~SharedMemoryCommandSerializer() override;
+
+    size_t GetMaximumAllocationSize() const override;
+
+    void* GetCmdSpace(size_t size) override;
+    bool Flush() override;
+
+  private:
+    // Waits until `size` bytes past mCursor can be written. Returns false if the ring was closed.
+    bool WaitForSpace(uint64_t size);
+    void Publish();
+
+    SharedMemoryRingBuffer* mRing;
+    // The position of the header of the batch being written, if there is one.
+    uint64_t mBatchStart = 0;
+    bool mBatchOpen = false;
+    // The position where the next command is written. Positions grow monotonically and are
+    // wrapped with the capacity when indexing the ring.
+    uint64_t mCursor = 0;
+};
+
+// Reads the batches of commands published in a SharedMemoryRingBuffer and gives them to a
+// CommandHandler. The ring's memory is released to the producer after each batch is handled.
+class SharedMemoryCommandReader {
+  public:
+    SharedMemoryCommandReader(SharedMemoryRingBuffer* ring, dawn::wire::CommandHandler* handler);
+
+    // Handles all the batches that are currently published, without waiting. Returns false if
+    // the handler or the decoding of the ring failed.
+    bool HandleAvailableCommands();
+
+    // Waits until some commands are published or the ring is closed, then handles them. Returns
+    // false if the ring is closed and empty, or if handling the commands failed.
+    bool WaitAndHandleCommands();
+
+  private:
+    SharedMemoryRingBuffer* mRing;
+    dawn::wire::CommandHandler* mHandler;
+    uint64_t mReadPosition = 0;
+};
+
+}  // namespace utils
+
+#endif  // SRC_DAWN_UTILS_SHAREDMEMORYRINGBUFFER_H_
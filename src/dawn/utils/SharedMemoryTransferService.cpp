@@ -0,0 +1,491 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/utils/SharedMemoryTransferService.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/common/Platform.h"
+#include "dawn/utils/SharedMemory.h"
+
+#if DAWN_PLATFORM_IS(POSIX)
+#include <unistd.h>
+#endif
+
+namespace utils {
+
+namespace {
+
+// Each region starts with a control block followed by the data of the handle. The server records
+// in it the serials of the handles of the region that it deserialized and destroyed. The client
+// assigns the serials in the order it serializes the handles, which is the order in which the
+// server processes them.
+struct RegionControl {
+    std::atomic<uint64_t> deserializedSerial;
+    std::atomic<uint64_t> destroyedSerial;
+};
+constexpr size_t kControlSize = 64;
+static_assert(sizeof(RegionControl) <= kControlSize);
+
+constexpr size_t kMinRegionDataSize = 4096;
+// How many unused regions of each size are kept for reuse.
+constexpr size_t kMaxFreeRegionsPerSize = 4;
+// How many regions the server keeps mapped.
+constexpr size_t kMaxImportedRegions = 64;
+
+struct SerializedHandle {
+    uint64_t regionId;
+    uint64_t serial;
+    int32_t fd;
+    uint32_t padding;
+    uint64_t regionSize;
+};
+
+// Data updates only contain the range that was updated, which must match the one of the update.
+struct SerializedRange {
+    uint64_t offset;
+    uint64_t size;
+};
+
+bool IsValidRange(const void* deserializePointer,
+                  size_t deserializeSize,
+                  size_t offset,
+                  size_t size,
+                  size_t dataLength) {
+    if (deserializeSize != sizeof(SerializedRange) || deserializePointer == nullptr) {
+        return false;
+    }
+    SerializedRange range;
+    memcpy(&range, deserializePointer, sizeof(range));
+    return range.offset == offset && range.size == size && offset <= dataLength &&
+           size <= dataLength - offset;
+}
+
+void SerializeRange(void* serializePointer, size_t offset, size_t size) {
+    SerializedRange range = {offset, size};
+    memcpy(serializePointer, &range, sizeof(range));
+}
+
+RegionControl* GetControl(const SharedMemory* memory) {
+    return static_cast<RegionControl*>(memory->GetData());
+}
+
+uint8_t* GetRegionData(const SharedMemory* memory) {
+    return static_cast<uint8_t*>(memory->GetData()) + kControlSize;
+}
+
+int DuplicateFd(int fd) {
+#if DAWN_PLATFORM_IS(POSIX)
+    return dup(fd);
+#else
+    return -1;
+#endif
+}
+
+}  // anonymous namespace
+
+// Client
+
+class SharedMemoryClientTransferService::Region : public RefCounted {
+  public:
+    static Ref<Region> Create(uint64_t id, size_t dataSize) {
+        std::unique_ptr<SharedMemory> memory = SharedMemory::Create(kControlSize + dataSize);
+        if (memory == nullptr) {
+            return nullptr;
+        }
+        new (memory->GetData()) RegionControl();
+        return AcquireRef(new Region(id, dataSize, std::move(memory)));
+    }
+
+    uint64_t GetId() const { return mId; }
+    size_t GetDataSize() const { return mDataSize; }
+    uint8_t* GetData() const { return GetRegionData(mMemory.get()); }
+    RegionControl* GetControl() const { return utils::GetControl(mMemory.get()); }
+
+    void SerializeHandle(void* serializePointer) const {
+        SerializedHandle handle = {};
+        handle.regionId = mId;
+        handle.serial = mSerial;
+        handle.fd = mMemory->GetFd();
+        handle.regionSize = mMemory->GetSize();
+        memcpy(serializePointer, &handle, sizeof(handle));
+    }
+
+    // Whether the data is still zero-initialized, which is the case until the region is reused.
+    bool IsZeroed() const { return !mWasUsed; }
+    void SetUsed() { mWasUsed = true; }
+
+    // The serial of the handle of the region that was sent to the server, or 0 if none was.
+    uint64_t GetSerial() const { return mSerial; }
+    void SetSerial(uint64_t serial) { mSerial = serial; }
+
+  private:
+    Region(uint64_t id, size_t dataSize, std::unique_ptr<SharedMemory> memory)
+        : mId(id), mDataSize(dataSize), mMemory(std::move(memory)) {}
+
+    uint64_t mId;
+    size_t mDataSize;
+    std::unique_ptr<SharedMemory> mMemory;
+    bool mWasUsed = false;
+    uint64_t mSerial = 0;
+};
+
+class SharedMemoryClientTransferService::RegionPool : public RefCounted {
+  public:
+    // Returns a region with at least `size` bytes of data.
+    Ref<Region> AcquireRegion(size_t size) {
+        size_t dataSize = NextPowerOfTwo(std::max(size, kMinRegionDataSize));
+        Ref<Region> region;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            std::vector<Ref<Region>>& freeRegions = mFreeRegions[dataSize];
+            UpdateServerSerial(freeRegions);
+            for (auto it = freeRegions.begin(); it != freeRegions.end(); ++it) {
+                if (IsReusable(it->Get())) {
+                    region = std::move(*it);
+                    freeRegions.erase(it);
+                    break;
+                }
+            }
+            if (region == nullptr) {
+                region = Region::Create(mNextRegionId++, dataSize);
+                if (region == nullptr) {
+                    return nullptr;
+                }
+            }
+        }
+
+        region->SetSerial(0);
+        return region;
+    }
+
+    // Serializes the handle of a region, which the server may use until it destroys its handle.
+    void SerializeHandle(Region* region, void* serializePointer) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            region->SetSerial(++mLastSerial);
+        }
+        region->SerializeHandle(serializePointer);
+    }
+
+    // Returns a region the client is done with to the pool.
+    void RecycleRegion(Ref<Region> region) {
+        region->SetUsed();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        std::vector<Ref<Region>>& freeRegions = mFreeRegions[region->GetDataSize()];
+        freeRegions.push_back(std::move(region));
+        UpdateServerSerial(freeRegions);
+
+        // Drop the oldest regions over the limit. Those the server may still use must be kept:
+        // their file descriptor may not have been imported yet.
+        for (auto it = freeRegions.begin();
+             freeRegions.size() > kMaxFreeRegionsPerSize && it != freeRegions.end();) {
+            if (IsReusable(it->Get())) {
+                it = freeRegions.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Called when the server stops processing handles, so none of the regions are used anymore.
+    void Disconnect() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mDisconnected = true;
+    }
+
+  private:
+    // Updates the serial of the last handle the server is known to have deserialized.
+    void UpdateServerSerial(const std::vector<Ref<Region>>& regions) {
+        for (const Ref<Region>& region : regions) {
+            mServerSerial = std::max(
+                mServerSerial,
+                region->GetControl()->deserializedSerial.load(std::memory_order_acquire));
+        }
+    }
+
+    // Returns whether the server is done with the region. Handles whose command the server
+    // rejected are never deserialized, so the server is done with them once it deserialized a
+    // later handle.
+    bool IsReusable(const Region* region) const {
+        uint64_t serial = region->GetSerial();
+        if (serial == 0 || mDisconnected) {
+            return true;
+        }
+        const RegionControl* control = region->GetControl();
+        if (control->deserializedSerial.load(std::memory_order_acquire) == serial) {
+            return control->destroyedSerial.load(std::memory_order_acquire) == serial;
+        }
+        return serial < mServerSerial;
+    }
+
+    std::mutex mMutex;
+    std::map<size_t, std::vector<Ref<Region>>> mFreeRegions;
+    uint64_t mNextRegionId = 1;
+    uint64_t mLastSerial = 0;
+    uint64_t mServerSerial = 0;
+    bool mDisconnected = false;
+};
+
+class SharedMemoryClientTransferService::ReadHandleImpl : public ReadHandle {
+  public:
+    ReadHandleImpl(Ref<RegionPool> pool, Ref<Region> region, size_t size)
+        : mPool(std::move(pool)), mRegion(std::move(region)), mSize(size) {}
+    ~ReadHandleImpl() override { mPool->RecycleRegion(std::move(mRegion)); }
+
+    size_t SerializeCreateSize() override { return sizeof(SerializedHandle); }
+
+    void SerializeCreate(void* serializePointer) override {
+        mPool->SerializeHandle(mRegion.Get(), serializePointer);
+    }
+
+    const void* GetData() override { return mRegion->GetData(); }
+
+    bool DeserializeDataUpdate(const void* deserializePointer,
+                               size_t deserializeSize,
+                               size_t offset,
+                               size_t size) override {
+        // The server already wrote the data in the region.
+        return IsValidRange(deserializePointer, deserializeSize, offset, size, mSize);
+    }
+
+  private:
+    Ref<RegionPool> mPool;
+    Ref<Region> mRegion;
+    size_t mSize;
+};
+
+class SharedMemoryClientTransferService::WriteHandleImpl : public WriteHandle {
+  public:
+    WriteHandleImpl(Ref<RegionPool> pool, Ref<Region> region)
+        : mPool(std::move(pool)), mRegion(std::move(region)) {}
+    ~WriteHandleImpl() override { mPool->RecycleRegion(std::move(mRegion)); }
+
+    size_t SerializeCreateSize() override { return sizeof(SerializedHandle); }
+
+    void SerializeCreate(void* serializePointer) override {
+        mPool->SerializeHandle(mRegion.Get(), serializePointer);
+    }
+
+    void* GetData() override { return mRegion->GetData(); }
+
+    size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override {
+        return sizeof(SerializedRange);
+    }
+
+    void SerializeDataUpdate(void* serializePointer, size_t offset, size_t size) override {
+        // The data is already in the region.
+        SerializeRange(serializePointer, offset, size);
+    }
+
+  private:
+    Ref<RegionPool> mPool;
+    Ref<Region> mRegion;
+};
+
+SharedMemoryClientTransferService::SharedMemoryClientTransferService(size_t minQueueWriteSize)
+    : mPool(AcquireRef(new RegionPool())), mMinQueueWriteSize(minQueueWriteSize) {}
+
+SharedMemoryClientTransferService::~SharedMemoryClientTransferService() = default;
+
+SharedMemoryClientTransferService::ReadHandle* SharedMemoryClientTransferService::CreateReadHandle(
+    size_t size) {
+    Ref<Region> region = mPool->AcquireRegion(size);
+    if (region == nullptr) {
+        return nullptr;
+    }
+    return new ReadHandleImpl(mPool, std::move(region), size);
+}
+
+SharedMemoryClientTransferService::WriteHandle*
+SharedMemoryClientTransferService::CreateWriteHandle(size_t size) {
+    Ref<Region> region = mPool->AcquireRegion(size);
+    if (region == nullptr) {
+        return nullptr;
+    }
+    if (!region->IsZeroed()) {
+        memset(region->GetData(), 0, size);
+    }
+    return new WriteHandleImpl(mPool, std::move(region));
+}
+
+SharedMemoryClientTransferService::WriteHandle*
+SharedMemoryClientTransferService::CreateQueueWriteHandle(size_t size) {
+    if (size < mMinQueueWriteSize) {
+        return nullptr;
+    }
+    // The payload overwrites the data so it doesn't need to be cleared.
+    Ref<Region> region = mPool->AcquireRegion(size);
+    if (region == nullptr) {
+        return nullptr;
+    }
+    return new WriteHandleImpl(mPool, std::move(region));
+}
+
+void SharedMemoryClientTransferService::OnDisconnect() {
+    mPool->Disconnect();
+}
+
+// Server
+
+class SharedMemoryServerTransferService::ReadHandleImpl : public ReadHandle {
+  public:
+    ReadHandleImpl(std::shared_ptr<SharedMemory> region, uint64_t serial)
+        : mRegion(std::move(region)), mSerial(serial) {}
+    ~ReadHandleImpl() override {
+        GetControl(mRegion.get())->destroyedSerial.store(mSerial, std::memory_order_release);
+    }
+
+    size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override {
+        return sizeof(SerializedRange);
+    }
+
+    void SerializeDataUpdate(const void* data,
+                             size_t offset,
+                             size_t size,
+                             void* serializePointer) override {
+        // The region comes from the client so it can be smaller than the buffer. The client
+        // detects it when it checks the range against its own handle.
+        size_t dataSize = mRegion->GetSize() - kControlSize;
+        if (size > 0 && offset <= dataSize && size <= dataSize - offset) {
+            ASSERT(data != nullptr);
+            memcpy(GetRegionData(mRegion.get()) + offset, data, size);
+        }
+        SerializeRange(serializePointer, offset, size);
+    }
+
+  private:
+    std::shared_ptr<SharedMemory> mRegion;
+    uint64_t mSerial;
+};
+
+class SharedMemoryServerTransferService::WriteHandleImpl : public WriteHandle {
+  public:
+    WriteHandleImpl(std::shared_ptr<SharedMemory> region, uint64_t serial)
+        : mRegion(std::move(region)), mSerial(serial) {}
+    ~WriteHandleImpl() override {
+        GetControl(mRegion.get())->destroyedSerial.store(mSerial, std::memory_order_release);
+    }
+
+    bool DeserializeDataUpdate(const void* deserializePointer,
+                               size_t deserializeSize,
+                               size_t offset,
+                               size_t size) override {
+        if (mTargetData == nullptr || mDataLength > GetDataSize() ||
+            !IsValidRange(deserializePointer, deserializeSize, offset, size, mDataLength)) {
+            return false;
+        }
+        memcpy(static_cast<uint8_t*>(mTargetData) + offset, GetRegionData(mRegion.get()) + offset,
+               size);
+        return true;
+    }
+
+    const void* GetSourceData() override {
+        if (mDataLength > GetDataSize()) {
+            return nullptr;
+        }
+        return GetRegionData(mRegion.get());
+    }
+
+  private:
+    size_t GetDataSize() const { return mRegion->GetSize() - kControlSize; }
+
+    std::shared_ptr<SharedMemory> mRegion;
+    uint64_t mSerial;
+};
+
+SharedMemoryServerTransferService::SharedMemoryServerTransferService(FdResolver resolver)
+    : mResolver(resolver != nullptr ? std::move(resolver) : DuplicateFd) {}
+
+SharedMemoryServerTransferService::~SharedMemoryServerTransferService() = default;
+
+bool SharedMemoryServerTransferService::DeserializeReadHandle(const void* deserializePointer,
+                                                              size_t deserializeSize,
+                                                              ReadHandle** readHandle) {
+    ASSERT(readHandle != nullptr);
+    uint64_t serial;
+    std::shared_ptr<SharedMemory> region = GetRegion(deserializePointer, deserializeSize, &serial);
+    if (region == nullptr) {
+        return false;
+    }
+    *readHandle = new ReadHandleImpl(std::move(region), serial);
+    return true;
+}
+
+bool SharedMemoryServerTransferService::DeserializeWriteHandle(const void* deserializePointer,
+                                                               size_t deserializeSize,
+                                                               WriteHandle** writeHandle) {
+    ASSERT(writeHandle != nullptr);
+    uint64_t serial;
+    std::shared_ptr<SharedMemory> region = GetRegion(deserializePointer, deserializeSize, &serial);
+    if (region == nullptr) {
+        return false;
+    }
+    *writeHandle = new WriteHandleImpl(std::move(region), serial);
+    return true;
+}
+
+std::shared_ptr<SharedMemory> SharedMemoryServerTransferService::GetRegion(
+    const void* deserializePointer,
+    size_t deserializeSize,
+    uint64_t* serial) {
+    if (deserializeSize != sizeof(SerializedHandle) || deserializePointer == nullptr) {
+        return nullptr;
+    }
+    SerializedHandle handle;
+    memcpy(&handle, deserializePointer, sizeof(handle));
+    if (handle.regionSize <= kControlSize) {
+        return nullptr;
+    }
+
+    std::shared_ptr<SharedMemory> region;
+    auto it = mRegions.find(handle.regionId);
+    if (it != mRegions.end()) {
+        if (it->second->GetSize() != handle.regionSize) {
+            return nullptr;
+        }
+        region = it->second;
+    } else {
+        int fd = mResolver(handle.fd);
+        if (fd < 0) {
+            return nullptr;
+        }
+        region = SharedMemory::Import(fd);
+        if (region == nullptr || region->GetSize() != handle.regionSize) {
+            return nullptr;
+        }
+
+        // Region IDs only grow so unmap the oldest ones first. Handles keep their region alive.
+        if (mRegions.size() >= kMaxImportedRegions) {
+            mRegions.erase(mRegions.begin());
+        }
+        mRegions.emplace(handle.regionId, region);
+    }
+
+    // Tell the client that the handle is in use until it is destroyed.
+    GetControl(region.get())->deserializedSerial.store(handle.serial, std::memory_order_release);
+    *serial = handle.serial;
+    return region;
+}
+
+}  // namespace utils
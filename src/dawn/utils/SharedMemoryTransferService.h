@@ -0,0 +1,102 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_UTILS_SHAREDMEMORYTRANSFERSERVICE_H_
+#define SRC_DAWN_UTILS_SHAREDMEMORYTRANSFERSERVICE_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+
+#include "dawn/common/RefCounted.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace utils {
+
+class SharedMemory;
+
+// Memory transfer services that give the server access to the client's data through shared
+// memory, instead of copying it in the command stream like the inline services do. They are used
+// for buffer mappings and for the payloads of large Queue::WriteBuffer and Queue::WriteTexture
+// calls. Only the handles and the ranges of the updates are serialized.
+//
+// The handles contain file descriptors of the client's process. The server turns them into file
+// descriptors of its own process with a FdResolver, which by default duplicates them so that the
+// client and server can run in the same process. Otherwise the embedder must transfer the file
+// descriptors out of band.
+
+class SharedMemoryClientTransferService : public dawn::wire::client::MemoryTransferService {
+  public:
+    static constexpr size_t kDefaultMinQueueWriteSize = 64 * 1024;
+
+    // Queue writes of at least `minQueueWriteSize` bytes are sent by reference.
+    explicit SharedMemoryClientTransferService(
+        size_t minQueueWriteSize = kDefaultMinQueueWriteSize);
+    ~SharedMemoryClientTransferService() override;
+
+    ReadHandle* CreateReadHandle(size_t size) override;
+    WriteHandle* CreateWriteHandle(size_t size) override;
+    WriteHandle* CreateQueueWriteHandle(size_t size) override;
+    void OnDisconnect() override;
+
+  private:
+    class Region;
+    class RegionPool;
+    class ReadHandleImpl;
+    class WriteHandleImpl;
+
+    // Regions are recycled once both the client and the server are done with them. The server is
+    // done with a region when it destroyed its handle, when it rejected the command with the
+    // handle, or when the client is disconnected.
+    Ref<RegionPool> mPool;
+    size_t mMinQueueWriteSize;
+};
+
+class SharedMemoryServerTransferService : public dawn::wire::server::MemoryTransferService {
+  public:
+    // Returns a file descriptor of the server's process, owned by the caller, for the client's
+    // `fd`, or -1 if there is none.
+    using FdResolver = std::function<int(int fd)>;
+
+    explicit SharedMemoryServerTransferService(FdResolver resolver = nullptr);
+    ~SharedMemoryServerTransferService() override;
+
+    bool DeserializeReadHandle(const void* deserializePointer,
+                               size_t deserializeSize,
+                               ReadHandle** readHandle) override;
+    bool DeserializeWriteHandle(const void* deserializePointer,
+                                size_t deserializeSize,
+                                WriteHandle** writeHandle) override;
+
+  private:
+    class ReadHandleImpl;
+    class WriteHandleImpl;
+
+    // Returns the mapping of the region described by a serialized handle, importing it if needed,
+    // and the serial of the handle in `serial`.
+    std::shared_ptr<SharedMemory> GetRegion(const void* deserializePointer,
+                                            size_t deserializeSize,
+                                            uint64_t* serial);
+
+    FdResolver mResolver;
+    // The regions that were already imported, by ID. The client recycles its regions so mapping
+    // them once avoids paying for the mapping and its page faults on each transfer.
+    std::map<uint64_t, std::shared_ptr<SharedMemory>> mRegions;
+};
+
+}  // namespace utils
+
+#endif  // SRC_DAWN_UTILS_SHAREDMEMORYTRANSFERSERVICE_H_
@@ -0,0 +1,184 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/utils/WireRecorder.h"
+
+#include <utility>
+
+#include "dawn/common/Math.h"
+
+namespace utils {
+
+namespace {
+
+constexpr size_t kRecordAlignment = 8;
+
+}  // anonymous namespace
+
+class RecordingCommandSerializer : public dawn::wire::CommandSerializer {
+  public:
+    RecordingCommandSerializer(WireRecorder* recorder,
+                               WireRecordType type,
+                               dawn::wire::CommandSerializer* serializer)
+        : mRecorder(recorder), mType(type), mSerializer(serializer) {}
+
+    size_t GetMaximumAllocationSize() const override {
+        return mSerializer->GetMaximumAllocationSize();
+    }
+
+    void* GetCmdSpace(size_t size) override {
+        // Commands are only complete when the space for the next one is requested, and the
+        // serializer may reuse their space after that, so they are copied at this point.
+        AppendPendingCommand();
+        void* space = mSerializer->GetCmdSpace(size);
+        if (space != nullptr) {
+            mPendingCommand = static_cast<const char*>(space);
+            mPendingCommandSize = size;
+        }
+        return space;
+    }
+
+    bool Flush() override {
+        AppendPendingCommand();
+        if (!mBatch.empty()) {
+            mRecorder->WriteRecord(mType, mBatch.data(), mBatch.size());
+            mBatch.clear();
+        }
+        return mSerializer->Flush();
+    }
+
+    void OnSerializeError() override { mSerializer->OnSerializeError(); }
+
+  private:
+    void AppendPendingCommand() {
+        if (mPendingCommand != nullptr) {
+            mBatch.insert(mBatch.end(), mPendingCommand, mPendingCommand + mPendingCommandSize);
+            mPendingCommand = nullptr;
+        }
+    }
+
+    WireRecorder* mRecorder;
+    WireRecordType mType;
+    dawn::wire::CommandSerializer* mSerializer;
+
+    const char* mPendingCommand = nullptr;
+    size_t mPendingCommandSize = 0;
+    // The commands serialized since the last flush.
+    std::vector<char> mBatch;
+};
+
+// static
+std::unique_ptr<WireRecorder> WireRecorder::Create(const char* path) {
+    std::unique_ptr<WireRecorder> recorder(new WireRecorder());
+    recorder->mFile.open(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!recorder->mFile.is_open()) {
+        return nullptr;
+    }
+
+    WireRecordingHeader header = {WireRecordingHeader::kMagic, WireRecordingHeader::kVersion};
+    recorder->mFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return recorder;
+}
+
+WireRecorder::~WireRecorder() = default;
+
+std::unique_ptr<dawn::wire::CommandSerializer> WireRecorder::WrapClientSerializer(
+    dawn::wire::CommandSerializer* serializer) {
+    return std::make_unique<RecordingCommandSerializer>(this, WireRecordType::Commands,
+                                                        serializer);
+}
+
+std::unique_ptr<dawn::wire::CommandSerializer> WireRecorder::WrapServerSerializer(
+    dawn::wire::CommandSerializer* serializer) {
+    return std::make_unique<RecordingCommandSerializer>(this, WireRecordType::ReturnCommands,
+                                                        serializer);
+}
+
+void WireRecorder::RecordInjectInstance(uint32_t id, uint32_t generation) {
+    WireRecordInjection injection = {id, generation};
+    WriteRecord(WireRecordType::InjectInstance, &injection, sizeof(injection));
+}
+
+void WireRecorder::RecordInjectDevice(uint32_t id, uint32_t generation) {
+    WireRecordInjection injection = {id, generation};
+    WriteRecord(WireRecordType::InjectDevice, &injection, sizeof(injection));
+}
+
+void WireRecorder::WriteRecord(WireRecordType type, const void* data, size_t size) {
+    WireRecordHeader header = {type, 0, size};
+    constexpr char kPadding[kRecordAlignment] = {};
+    size_t paddingSize = Align(size, kRecordAlignment) - size;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    mFile.write(static_cast<const char*>(data), size);
+    mFile.write(kPadding, paddingSize);
+    mFile.flush();
+}
+
+bool ReadWireRecording(const char* path, std::vector<WireRecord>* records) {
+    std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    WireRecordingHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != WireRecordingHeader::kMagic ||
+        header.version != WireRecordingHeader::kVersion) {
+        return false;
+    }
+
+    records->clear();
+    WireRecordHeader recordHeader;
+    while (file.read(reinterpret_cast<char*>(&recordHeader), sizeof(recordHeader))) {
+        switch (recordHeader.type) {
+            case WireRecordType::Commands:
+            case WireRecordType::ReturnCommands:
+                break;
+            case WireRecordType::InjectInstance:
+            case WireRecordType::InjectDevice:
+                if (recordHeader.size != sizeof(WireRecordInjection)) {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+        }
+
+        // Check the size against what is left in the file before allocating anything.
+        std::streampos position = file.tellg();
+        file.seekg(0, std::ios_base::end);
+        uint64_t remainingSize = static_cast<uint64_t>(file.tellg() - position);
+        file.seekg(position);
+        if (recordHeader.size > remainingSize) {
+            return false;
+        }
+
+        WireRecord record;
+        record.type = recordHeader.type;
+        record.data.resize(recordHeader.size);
+        char padding[kRecordAlignment];
+        if (!file.read(record.data.data(), record.data.size()) ||
+            !file.read(padding, Align(recordHeader.size, kRecordAlignment) - recordHeader.size)) {
+            return false;
+        }
+        records->push_back(std::move(record));
+    }
+
+    // Only a clean end of file is valid.
+    return file.eof() && file.gcount() == 0;
+}
+
+}  // namespace utils
@@ -0,0 +1,104 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_UTILS_WIRERECORDER_H_
+#define SRC_DAWN_UTILS_WIRERECORDER_H_
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "dawn/wire/Wire.h"
+
+namespace utils {
+
+// A wire recording contains the commands that went through both directions of a wire, and the
+// objects that were injected in the server, so that the server side of the wire can be replayed
+// offline with dawn_wire_replay. The file is made of a WireRecordingHeader followed by records,
+// each made of a WireRecordHeader and its data padded to 8 bytes.
+
+enum class WireRecordType : uint32_t {
+    // The client to server commands serialized between two flushes.
+    Commands = 1,
+    // The server to client commands serialized between two flushes.
+    ReturnCommands = 2,
+    // A WireRecordInjection for each call to WireServer::InjectInstance or InjectDevice.
+    InjectInstance = 3,
+    InjectDevice = 4,
+};
+
+struct WireRecordingHeader {
+    static constexpr uint32_t kMagic = 0x43525744;  // "DWRC"
+    static constexpr uint32_t kVersion = 1;
+
+    uint32_t magic;
+    uint32_t version;
+};
+
+struct WireRecordHeader {
+    WireRecordType type;
+    uint32_t padding;
+    uint64_t size;
+};
+
+struct WireRecordInjection {
+    uint32_t id;
+    uint32_t generation;
+};
+
+struct WireRecord {
+    WireRecordType type;
+    std::vector<char> data;
+};
+
+// Writes a wire recording. The commands are recorded by the serializers returned by
+// WrapClientSerializer and WrapServerSerializer, which can be used from different threads.
+class WireRecorder {
+  public:
+    // Returns nullptr if the file can't be opened.
+    static std::unique_ptr<WireRecorder> Create(const char* path);
+    ~WireRecorder();
+
+    // Returns a serializer that records the commands before forwarding them to `serializer`.
+    // The recorder must outlive it.
+    std::unique_ptr<dawn::wire::CommandSerializer> WrapClientSerializer(
+        dawn::wire::CommandSerializer* serializer);
+    std::unique_ptr<dawn::wire::CommandSerializer> WrapServerSerializer(
+        dawn::wire::CommandSerializer* serializer);
+
+    // Must be called along with the calls to WireServer::InjectInstance and InjectDevice, before
+    // the client uses the objects.
+    void RecordInjectInstance(uint32_t id, uint32_t generation);
+    void RecordInjectDevice(uint32_t id, uint32_t generation);
+
+  private:
+    friend class RecordingCommandSerializer;
+
+    WireRecorder() = default;
+
+    void WriteRecord(WireRecordType type, const void* data, size_t size);
+
+    std::mutex mMutex;
+    std::ofstream mFile;
+};
+
+// Reads all the records of a wire recording. Returns false if the file can't be read or isn't a
+// valid recording.
+bool ReadWireRecording(const char* path, std::vector<WireRecord>* records);
+
+}  // namespace utils
+
+#endif  // SRC_DAWN_UTILS_WIRERECORDER_H_
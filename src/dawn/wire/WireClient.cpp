@@ -70,6 +70,12 @@ MemoryTransferService::MemoryTransferService() = default;
 
 MemoryTransferService::~MemoryTransferService() = default;
 
+MemoryTransferService::WriteHandle* MemoryTransferService::CreateQueueWriteHandle(size_t size) {
+    return nullptr;
+}
+
+void MemoryTransferService::OnDisconnect() {}
+
 MemoryTransferService::ReadHandle::ReadHandle() = default;
 
 MemoryTransferService::ReadHandle::~ReadHandle() = default;
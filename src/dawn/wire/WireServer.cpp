@@ -20,7 +20,8 @@ namespace dawn::wire {
 WireServer::WireServer(const WireServerDescriptor& descriptor)
     : mImpl(new server::Server(*descriptor.procs,
                                descriptor.serializer,
-                               descriptor.memoryTransferService)) {}
+                               descriptor.memoryTransferService,
+                               descriptor.platform)) {}
 
 WireServer::~WireServer() {
     mImpl.reset();
@@ -62,6 +63,14 @@ bool WireServer::IsDeviceKnown(WGPUDevice device) const {
     return mImpl->IsDeviceKnown(device);
 }
 
+void WireServer::SetCommandProfilingEnabled(bool enabled) {
+    mImpl->SetCommandProfilingEnabled(enabled);
+}
+
+std::vector<WireCommandProfile> WireServer::GetCommandProfiles() const {
+    return mImpl->GetCommandProfiles();
+}
+
 namespace server {
 MemoryTransferService::MemoryTransferService() = default;
 
@@ -81,6 +90,10 @@ void MemoryTransferService::WriteHandle::SetTarget(void* data) {
 void MemoryTransferService::WriteHandle::SetDataLength(size_t dataLength) {
     mDataLength = dataLength;
 }
+
+const void* MemoryTransferService::WriteHandle::GetSourceData() {
+    return nullptr;
+}
 }  // namespace server
 
 }  // namespace dawn::wire
@@ -144,6 +144,7 @@ void Client::ReclaimInstanceReservation(const ReservedInstance& reservation) {
 void Client::Disconnect() {
     mDisconnected = true;
     mSerializer = ChunkedCommandSerializer(NoopCommandSerializer::GetInstance());
+    mMemoryTransferService->OnDisconnect();
 
     auto& deviceList = mObjects[ObjectType::Device];
     {
@@ -89,6 +89,11 @@ MockMemoryTransferService::WriteHandle* MockMemoryTransferService::CreateWriteHa
     return OnCreateWriteHandle(size);
 }
 
+MockMemoryTransferService::WriteHandle* MockMemoryTransferService::CreateQueueWriteHandle(
+    size_t size) {
+    return OnCreateQueueWriteHandle(size);
+}
+
 MockMemoryTransferService::MockReadHandle* MockMemoryTransferService::NewReadHandle() {
     return new MockReadHandle(this);
 }
@@ -61,12 +61,14 @@ class MockMemoryTransferService : public MemoryTransferService {
 
     ReadHandle* CreateReadHandle(size_t) override;
     WriteHandle* CreateWriteHandle(size_t) override;
+    WriteHandle* CreateQueueWriteHandle(size_t) override;
 
     MockReadHandle* NewReadHandle();
     MockWriteHandle* NewWriteHandle();
 
     MOCK_METHOD(ReadHandle*, OnCreateReadHandle, (size_t));
     MOCK_METHOD(WriteHandle*, OnCreateWriteHandle, (size_t));
+    MOCK_METHOD(WriteHandle*, OnCreateQueueWriteHandle, (size_t));
 
     MOCK_METHOD(size_t, OnReadHandleSerializeCreateSize, (const ReadHandle*));
     MOCK_METHOD(void, OnReadHandleSerializeCreate, (const ReadHandle*, void* serializePointer));
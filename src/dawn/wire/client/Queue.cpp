@@ -14,6 +14,9 @@
 
 #include "dawn/wire/client/Queue.h"
 
+#include <cstring>
+#include <memory>
+
 #include "dawn/wire/client/Client.h"
 #include "dawn/wire/client/Device.h"
 
@@ -55,6 +58,17 @@ void Queue::OnSubmittedWorkDone(uint64_t signalValue,
 void Queue::WriteBuffer(WGPUBuffer cBuffer, uint64_t bufferOffset, const void* data, size_t size) {
     Buffer* buffer = FromAPI(cBuffer);
 
+    std::unique_ptr<MemoryTransferService::WriteHandle> writeHandle = CreateWriteHandle(data, size);
+    if (writeHandle != nullptr) {
+        QueueWriteBufferFromHandleCmd cmd;
+        cmd.queueId = GetWireId();
+        cmd.bufferId = buffer->GetWireId();
+        cmd.bufferOffset = bufferOffset;
+        cmd.size = size;
+        SerializeWithWriteHandle(&cmd, writeHandle.get(), size);
+        return;
+    }
+
     QueueWriteBufferCmd cmd;
     cmd.queueId = GetWireId();
     cmd.bufferId = buffer->GetWireId();
@@ -70,6 +84,19 @@ void Queue::WriteTexture(const WGPUImageCopyTexture* destination,
                          size_t dataSize,
                          const WGPUTextureDataLayout* dataLayout,
                          const WGPUExtent3D* writeSize) {
+    std::unique_ptr<MemoryTransferService::WriteHandle> writeHandle =
+        CreateWriteHandle(data, dataSize);
+    if (writeHandle != nullptr) {
+        QueueWriteTextureFromHandleCmd cmd;
+        cmd.queueId = GetWireId();
+        cmd.destination = destination;
+        cmd.dataSize = dataSize;
+        cmd.dataLayout = dataLayout;
+        cmd.writeSize = writeSize;
+        SerializeWithWriteHandle(&cmd, writeHandle.get(), dataSize);
+        return;
+    }
+
     QueueWriteTextureCmd cmd;
     cmd.queueId = GetWireId();
     cmd.destination = destination;
@@ -81,6 +108,45 @@ void Queue::WriteTexture(const WGPUImageCopyTexture* destination,
     GetClient()->SerializeCommand(cmd);
 }
 
+std::unique_ptr<MemoryTransferService::WriteHandle> Queue::CreateWriteHandle(const void* data,
+                                                                             size_t size) {
+    Client* client = GetClient();
+    if (client->IsDisconnected()) {
+        // The command is dropped, so don't copy the payload.
+        return nullptr;
+    }
+    std::unique_ptr<MemoryTransferService::WriteHandle> writeHandle(
+        client->GetMemoryTransferService()->CreateQueueWriteHandle(size));
+    if (writeHandle == nullptr || writeHandle->GetData() == nullptr) {
+        // Fall back to sending the payload in the command.
+        return nullptr;
+    }
+    if (size > 0) {
+        memcpy(writeHandle->GetData(), data, size);
+    }
+    return writeHandle;
+}
+
+template <typename Cmd>
+void Queue::SerializeWithWriteHandle(Cmd* cmd,
+                                     MemoryTransferService::WriteHandle* writeHandle,
+                                     size_t size) {
+    cmd->writeHandleCreateInfoLength = writeHandle->SerializeCreateSize();
+    cmd->writeHandleCreateInfo = nullptr;
+    cmd->writeDataUpdateInfoLength = writeHandle->SizeOfSerializeDataUpdate(0, size);
+    cmd->writeDataUpdateInfo = nullptr;
+
+    GetClient()->SerializeCommand(
+        *cmd,
+        CommandExtension{cmd->writeHandleCreateInfoLength,
+                         [&](char* writeHandleBuffer) {
+                             writeHandle->SerializeCreate(writeHandleBuffer);
+                         }},
+        CommandExtension{cmd->writeDataUpdateInfoLength, [&](char* writeHandleBuffer) {
+                             writeHandle->SerializeDataUpdate(writeHandleBuffer, 0, size);
+                         }});
+}
+
 void Queue::CancelCallbacksForDisconnect() {
     ClearAllCallbacks(WGPUQueueWorkDoneStatus_DeviceLost);
 }
@@ -15,6 +15,8 @@
 #ifndef SRC_DAWN_WIRE_CLIENT_QUEUE_H_
 #define SRC_DAWN_WIRE_CLIENT_QUEUE_H_
 
+#include <memory>
+
 #include "dawn/webgpu.h"
 
 #include "dawn/wire/WireClient.h"
@@ -42,6 +44,15 @@ class Queue final : public ObjectBase {
                       const WGPUExtent3D* writeSize);
 
   private:
+    // Returns a handle holding a copy of `data` if the memory transfer service sends queue writes
+    // of this size by reference, nullptr otherwise.
+    std::unique_ptr<MemoryTransferService::WriteHandle> CreateWriteHandle(const void* data,
+                                                                          size_t size);
+    template <typename Cmd>
+    void SerializeWithWriteHandle(Cmd* cmd,
+                                  MemoryTransferService::WriteHandle* writeHandle,
+                                  size_t size);
+
     void CancelCallbacksForDisconnect() override;
     void ClearAllCallbacks(WGPUQueueWorkDoneStatus status);
 
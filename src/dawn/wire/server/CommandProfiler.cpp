@@ -0,0 +1,99 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/wire/server/CommandProfiler.h"
+
+#include "dawn/common/Assert.h"
+
+namespace dawn::wire::server {
+
+namespace {
+
+std::atomic<uint64_t> sNextProfilerId{1};
+
+// The counters used last by the current thread, and the profiler they belong to.
+thread_local uint64_t tCachedProfilerId = 0;
+thread_local void* tCachedCounters = nullptr;
+
+void Increment(std::atomic<uint64_t>* counter, uint64_t value) {
+    // Only the owning thread writes to the counter so there are no concurrent increments.
+    counter->store(counter->load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+}  // anonymous namespace
+
+CommandProfiler::CommandProfiler()
+    : mId(sNextProfilerId.fetch_add(1, std::memory_order_relaxed)) {}
+
+CommandProfiler::~CommandProfiler() = default;
+
+void CommandProfiler::Record(WireCmd command, uint64_t bytes, uint64_t nanoseconds) {
+    size_t index = static_cast<size_t>(command);
+    ASSERT(index < kWireCmdCount);
+
+    Counters& counters = (*GetThreadCounters())[index];
+    Increment(&counters.count, 1);
+    Increment(&counters.bytes, bytes);
+    Increment(&counters.nanoseconds, nanoseconds);
+}
+
+std::vector<WireCommandProfile> CommandProfiler::GetProfiles() const {
+    std::array<WireCommandProfile, kWireCmdCount> totals = {};
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (const auto& [thread, threadCounters] : mThreadCounters) {
+            for (size_t i = 0; i < kWireCmdCount; ++i) {
+                const Counters& counters = (*threadCounters)[i];
+                totals[i].count += counters.count.load(std::memory_order_relaxed);
+                totals[i].bytes += counters.bytes.load(std::memory_order_relaxed);
+                totals[i].nanoseconds += counters.nanoseconds.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::vector<WireCommandProfile> profiles;
+    for (size_t i = 0; i < kWireCmdCount; ++i) {
+        if (totals[i].count != 0) {
+            totals[i].name = GetWireCmdName(static_cast<WireCmd>(i));
+            profiles.push_back(totals[i]);
+        }
+    }
+    return profiles;
+}
+
+CommandProfiler::ThreadCounters* CommandProfiler::GetThreadCounters() {
+    if (tCachedProfilerId == mId) {
+        return static_cast<ThreadCounters*>(tCachedCounters);
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::thread::id thread = std::this_thread::get_id();
+    ThreadCounters* counters = nullptr;
+    for (const auto& [counterThread, threadCounters] : mThreadCounters) {
+        if (counterThread == thread) {
+            counters = threadCounters.get();
+            break;
+        }
+    }
+    if (counters == nullptr) {
+        mThreadCounters.emplace_back(thread, std::make_unique<ThreadCounters>());
+        counters = mThreadCounters.back().second.get();
+    }
+
+    tCachedProfilerId = mId;
+    tCachedCounters = counters;
+    return counters;
+}
+
+}  // namespace dawn::wire::server
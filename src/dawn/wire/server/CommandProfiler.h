@@ -0,0 +1,62 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_WIRE_SERVER_COMMANDPROFILER_H_
+#define SRC_DAWN_WIRE_SERVER_COMMANDPROFILER_H_
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "dawn/wire/WireCmd_autogen.h"
+#include "dawn/wire/WireServer.h"
+
+namespace dawn::wire::server {
+
+// The per-command-type counters of a server's command profiling. Each thread that handles
+// commands gets its own counters so that recording a command doesn't need locks or atomic
+// read-modify-writes. The counters of all the threads are only summed when they are queried.
+class CommandProfiler {
+  public:
+    CommandProfiler();
+    ~CommandProfiler();
+
+    void Record(WireCmd command, uint64_t bytes, uint64_t nanoseconds);
+    std::vector<WireCommandProfile> GetProfiles() const;
+
+  private:
+    struct Counters {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> nanoseconds{0};
+    };
+    using ThreadCounters = std::array<Counters, kWireCmdCount>;
+
+    ThreadCounters* GetThreadCounters();
+
+    // Identifies the profiler in the cache of the counters of the current thread. Unlike the
+    // address of the profiler, it is never reused.
+    const uint64_t mId;
+
+    mutable std::mutex mMutex;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<ThreadCounters>>> mThreadCounters;
+};
+
+}  // namespace dawn::wire::server
+
+#endif  // SRC_DAWN_WIRE_SERVER_COMMANDPROFILER_H_
@@ -13,6 +13,10 @@
 // limitations under the License.
 
 #include "dawn/wire/server/Server.h"
+
+#include <chrono>
+
+#include "dawn/platform/tracing/TraceEvent.h"
 #include "dawn/wire/WireServer.h"
 
 namespace dawn::wire::server {
@@ -22,10 +26,12 @@ CallbackUserdata::CallbackUserdata(Server* server, const std::shared_ptr<bool>&
 
 Server::Server(const DawnProcTable& procs,
                CommandSerializer* serializer,
-               MemoryTransferService* memoryTransferService)
+               MemoryTransferService* memoryTransferService,
+               platform::Platform* platform)
     : mSerializer(serializer),
       mProcs(procs),
       mMemoryTransferService(memoryTransferService),
+      mPlatform(platform),
       mIsAlive(std::make_shared<bool>(true)) {
     if (mMemoryTransferService == nullptr) {
         // If a MemoryTransferService is not provided, fallback to inline memory.
@@ -149,6 +155,37 @@ bool Server::IsDeviceKnown(WGPUDevice device) const {
     return DeviceObjects().IsKnown(device);
 }
 
+void Server::SetCommandProfilingEnabled(bool enabled) {
+    mCommandProfilingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+std::vector<WireCommandProfile> Server::GetCommandProfiles() const {
+    return mCommandProfiler.GetProfiles();
+}
+
+bool Server::HandleCommandWithProfiling(WireCmd cmdId, DeserializeBuffer* deserializeBuffer) {
+    const char* name = GetWireCmdName(cmdId);
+    if (name == nullptr) {
+        return false;
+    }
+
+    size_t availableSize = deserializeBuffer->AvailableSize();
+    auto start = std::chrono::steady_clock::now();
+    bool success;
+    if (mPlatform != nullptr) {
+        TRACE_EVENT0(mPlatform, General, name);
+        success = HandleCommand(cmdId, deserializeBuffer);
+    } else {
+        success = HandleCommand(cmdId, deserializeBuffer);
+    }
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    mCommandProfiler.Record(cmdId, availableSize - deserializeBuffer->AvailableSize(),
+                            nanoseconds.count());
+    return success;
+}
+
 void Server::SetForwardingDeviceCallbacks(ObjectData<WGPUDevice>* deviceObject) {
     // Note: these callbacks are manually inlined here since they do not acquire and
     // free their userdata. Also unlike other callbacks, these are cleared and unset when
@@ -15,10 +15,13 @@
 #ifndef SRC_DAWN_WIRE_SERVER_SERVER_H_
 #define SRC_DAWN_WIRE_SERVER_SERVER_H_
 
+#include <atomic>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "dawn/wire/ChunkedCommandSerializer.h"
+#include "dawn/wire/server/CommandProfiler.h"
 #include "dawn/wire/server/ServerBase_autogen.h"
 
 namespace dawn::wire::server {
@@ -147,7 +150,8 @@ class Server : public ServerBase {
   public:
     Server(const DawnProcTable& procs,
            CommandSerializer* serializer,
-           MemoryTransferService* memoryTransferService);
+           MemoryTransferService* memoryTransferService,
+           platform::Platform* platform);
     ~Server() override;
 
     // ChunkedCommandHandler implementation
@@ -172,6 +176,9 @@ class Server : public ServerBase {
     WGPUDevice GetDevice(uint32_t id, uint32_t generation);
     bool IsDeviceKnown(WGPUDevice device) const;
 
+    void SetCommandProfilingEnabled(bool enabled);
+    std::vector<WireCommandProfile> GetCommandProfiles() const;
+
     template <typename T,
               typename Enable = std::enable_if<std::is_base_of<CallbackUserdata, T>::value>>
     std::unique_ptr<T> MakeUserdata() {
@@ -179,6 +186,13 @@ class Server : public ServerBase {
     }
 
   private:
+    // Dispatches a command to its handler.
+    bool HandleCommand(WireCmd cmdId, DeserializeBuffer* deserializeBuffer);
+    bool HandleCommandWithProfiling(WireCmd cmdId, DeserializeBuffer* deserializeBuffer);
+    bool IsCommandProfilingEnabled() const {
+        return mCommandProfilingEnabled.load(std::memory_order_relaxed);
+    }
+
     template <typename Cmd>
     void SerializeCommand(const Cmd& cmd) {
         mSerializer.SerializeCommand(cmd);
@@ -229,6 +243,10 @@ class Server : public ServerBase {
     std::unique_ptr<MemoryTransferService> mOwnedMemoryTransferService = nullptr;
     MemoryTransferService* mMemoryTransferService = nullptr;
 
+    platform::Platform* mPlatform = nullptr;
+    std::atomic<bool> mCommandProfilingEnabled = false;
+    CommandProfiler mCommandProfiler;
+
     std::shared_ptr<bool> mIsAlive;
 };
 
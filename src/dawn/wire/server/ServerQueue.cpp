@@ -13,12 +13,64 @@
 // limitations under the License.
 
 #include <limits>
+#include <memory>
 
+#include "dawn/common/Alloc.h"
 #include "dawn/common/Assert.h"
 #include "dawn/wire/server/Server.h"
 
 namespace dawn::wire::server {
 
+namespace {
+
+// Deserializes the WriteHandle carrying the payload of a queue write and calls `write` with the
+// payload. It is read in place when the handle allows it, otherwise it is copied to staging memory.
+template <typename F>
+bool WithWriteHandleData(MemoryTransferService* memoryTransferService,
+                         uint64_t writeHandleCreateInfoLength,
+                         const uint8_t* writeHandleCreateInfo,
+                         uint64_t writeDataUpdateInfoLength,
+                         const uint8_t* writeDataUpdateInfo,
+                         uint64_t size,
+                         F&& write) {
+    if (writeHandleCreateInfoLength > std::numeric_limits<size_t>::max() ||
+        writeDataUpdateInfoLength > std::numeric_limits<size_t>::max() ||
+        size > std::numeric_limits<size_t>::max()) {
+        return false;
+    }
+
+    MemoryTransferService::WriteHandle* writeHandle = nullptr;
+    if (!memoryTransferService->DeserializeWriteHandle(
+            writeHandleCreateInfo, static_cast<size_t>(writeHandleCreateInfoLength),
+            &writeHandle)) {
+        return false;
+    }
+    ASSERT(writeHandle != nullptr);
+    std::unique_ptr<MemoryTransferService::WriteHandle> handle(writeHandle);
+    handle->SetDataLength(static_cast<size_t>(size));
+
+    const void* data = handle->GetSourceData();
+    std::unique_ptr<uint8_t[]> staging;
+    if (data == nullptr && size > 0) {
+        staging.reset(AllocNoThrow<uint8_t>(static_cast<size_t>(size)));
+        if (staging == nullptr) {
+            return false;
+        }
+        handle->SetTarget(staging.get());
+        if (!handle->DeserializeDataUpdate(writeDataUpdateInfo,
+                                           static_cast<size_t>(writeDataUpdateInfoLength), 0,
+                                           static_cast<size_t>(size))) {
+            return false;
+        }
+        data = staging.get();
+    }
+
+    write(data, static_cast<size_t>(size));
+    return true;
+}
+
+}  // anonymous namespace
+
 void Server::OnQueueWorkDone(QueueWorkDoneUserdata* data, WGPUQueueWorkDoneStatus status) {
     ReturnQueueWorkDoneCallbackCmd cmd;
     cmd.queue = data->queue;
@@ -89,4 +141,53 @@ bool Server::DoQueueWriteTexture(ObjectId queueId,
     return true;
 }
 
+bool Server::DoQueueWriteBufferFromHandle(ObjectId queueId,
+                                          ObjectId bufferId,
+                                          uint64_t bufferOffset,
+                                          uint64_t size,
+                                          uint64_t writeHandleCreateInfoLength,
+                                          const uint8_t* writeHandleCreateInfo,
+                                          uint64_t writeDataUpdateInfoLength,
+                                          const uint8_t* writeDataUpdateInfo) {
+    // The null object isn't valid as `self` or `buffer` so we can combine the check with the
+    // check that the ID is valid.
+    auto* queue = QueueObjects().Get(queueId);
+    auto* buffer = BufferObjects().Get(bufferId);
+    if (queue == nullptr || buffer == nullptr) {
+        return false;
+    }
+
+    return WithWriteHandleData(
+        mMemoryTransferService, writeHandleCreateInfoLength, writeHandleCreateInfo,
+        writeDataUpdateInfoLength, writeDataUpdateInfo, size,
+        [&](const void* data, size_t dataSize) {
+            mProcs.queueWriteBuffer(queue->handle, buffer->handle, bufferOffset, data, dataSize);
+        });
+}
+
+bool Server::DoQueueWriteTextureFromHandle(ObjectId queueId,
+                                           const WGPUImageCopyTexture* destination,
+                                           uint64_t dataSize,
+                                           const WGPUTextureDataLayout* dataLayout,
+                                           const WGPUExtent3D* writeSize,
+                                           uint64_t writeHandleCreateInfoLength,
+                                           const uint8_t* writeHandleCreateInfo,
+                                           uint64_t writeDataUpdateInfoLength,
+                                           const uint8_t* writeDataUpdateInfo) {
+    // The null object isn't valid as `self` so we can combine the check with the
+    // check that the ID is valid.
+    auto* queue = QueueObjects().Get(queueId);
+    if (queue == nullptr) {
+        return false;
+    }
+
+    return WithWriteHandleData(
+        mMemoryTransferService, writeHandleCreateInfoLength, writeHandleCreateInfo,
+        writeDataUpdateInfoLength, writeDataUpdateInfo, dataSize,
+        [&](const void* data, size_t size) {
+            mProcs.queueWriteTexture(queue->handle, destination, data, size, dataLayout,
+                                     writeSize);
+        });
+}
+
 }  // namespace dawn::wire::server
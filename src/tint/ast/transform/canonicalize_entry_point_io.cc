@@ -88,6 +88,26 @@ bool IsShaderIOAttribute(const Attribute* attr) {
         ->IsAnyOf<BuiltinAttribute, InterpolateAttribute, InvariantAttribute, LocationAttribute>();
 }
 
+bool ShouldRun(const Program* program) {
+    for (auto* func : program->AST().Functions()) {
+        if (func->IsEntryPoint()) {
+            return true;
+        }
+    }
+    for (auto* ty : program->AST().TypeDecls()) {
+        if (auto* struct_ty = ty->As<Struct>()) {
+            for (auto* member : struct_ty->members) {
+                for (auto* attr : member->attributes) {
+                    if (IsShaderIOAttribute(attr)) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
 }  // namespace
 
 /// PIMPL state for the transform
@@ -821,10 +841,14 @@ struct CanonicalizeEntryPointIO::State {
 Transform::ApplyResult CanonicalizeEntryPointIO::Apply(const Program* src,
                                                        const DataMap& inputs,
                                                        DataMap&) const {
+    auto* cfg = inputs.Get<Config>();
+    if (cfg != nullptr && !ShouldRun(src)) {
+        return SkipTransform;
+    }
+
     ProgramBuilder b;
     CloneContext ctx{&b, src, /* auto_clone_symbols */ true};
 
-    auto* cfg = inputs.Get<Config>();
     if (cfg == nullptr) {
         b.Diagnostics().add_error(diag::System::Transform,
                                   "missing transform data for " + std::string(TypeInfo().name));
@@ -33,6 +33,54 @@ TEST_F(CanonicalizeEntryPointIOTest, Error_MissingTransformData) {
     EXPECT_EQ(expect, str(got));
 }
 
+TEST_F(CanonicalizeEntryPointIOTest, ShouldRunEmptyModule) {
+    auto* src = R"()";
+
+    DataMap data;
+    data.Add<CanonicalizeEntryPointIO::Config>(CanonicalizeEntryPointIO::ShaderStyle::kMsl);
+
+    EXPECT_FALSE(ShouldRun<CanonicalizeEntryPointIO>(src, data));
+}
+
+TEST_F(CanonicalizeEntryPointIOTest, ShouldRunNoEntryPoint) {
+    auto* src = R"(
+fn foo() -> f32 {
+  return 1.0;
+}
+)";
+
+    DataMap data;
+    data.Add<CanonicalizeEntryPointIO::Config>(CanonicalizeEntryPointIO::ShaderStyle::kMsl);
+
+    EXPECT_FALSE(ShouldRun<CanonicalizeEntryPointIO>(src, data));
+}
+
+TEST_F(CanonicalizeEntryPointIOTest, ShouldRunStructWithShaderIO) {
+    auto* src = R"(
+struct S {
+  @location(0) value : f32,
+}
+)";
+
+    DataMap data;
+    data.Add<CanonicalizeEntryPointIO::Config>(CanonicalizeEntryPointIO::ShaderStyle::kMsl);
+
+    EXPECT_TRUE(ShouldRun<CanonicalizeEntryPointIO>(src, data));
+}
+
+TEST_F(CanonicalizeEntryPointIOTest, ShouldRunEntryPoint) {
+    auto* src = R"(
+@compute @workgroup_size(1)
+fn main() {
+}
+)";
+
+    DataMap data;
+    data.Add<CanonicalizeEntryPointIO::Config>(CanonicalizeEntryPointIO::ShaderStyle::kMsl);
+
+    EXPECT_TRUE(ShouldRun<CanonicalizeEntryPointIO>(src, data));
+}
+
 TEST_F(CanonicalizeEntryPointIOTest, NoShaderIO) {
     // Test that we do not introduce wrapper functions when there is no shader IO
     // to process.
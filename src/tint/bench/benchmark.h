@@ -67,20 +67,22 @@ std::variant<ProgramAndFile, Error> LoadProgram(std::string name);
 #define TINT_BENCHMARK_WGSL_PROGRAM(FUNC, WGSL_NAME) BENCHMARK_CAPTURE(FUNC, WGSL_NAME, WGSL_NAME);
 
 /// Declares a set of benchmarks for the given function using a list of WGSL files.
-#define TINT_BENCHMARK_WGSL_PROGRAMS(FUNC)                                   \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "animometer.wgsl");                    \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "atan2-const-eval.wgsl");              \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "bloom-vertical-blur.wgsl");           \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "cluster-lights.wgsl");                \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "empty.wgsl");                         \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "metaball-isosurface.wgsl");           \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "particles.wgsl");                     \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "shadow-fragment.wgsl");               \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "simple-compute.wgsl");                \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "simple-fragment.wgsl");               \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "simple-vertex.wgsl");                 \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "skinned-shadowed-pbr-fragment.wgsl"); \
-    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "skinned-shadowed-pbr-vertex.wgsl");   \
+#define TINT_BENCHMARK_WGSL_PROGRAMS(FUNC)                                            \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "animometer.wgsl");                             \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "atan2-const-eval.wgsl");                       \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "bloom-vertical-blur.wgsl");                    \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "cluster-lights.wgsl");                         \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "empty.wgsl");                                  \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "lut-const-eval.wgsl");                         \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "metaball-isosurface.wgsl");                    \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "particles.wgsl");                              \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "shadow-fragment.wgsl");                        \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "simple-compute.wgsl");                         \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "simple-fragment.wgsl");                        \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "simple-vertex.wgsl");                          \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "skinned-shadowed-pbr-fragment.wgsl");          \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "skinned-shadowed-pbr-vertex.wgsl");            \
+    TINT_BENCHMARK_WGSL_PROGRAM(FUNC, "uniformity-analysis-pointer-parameters.wgsl"); \
     TINT_BENCHMARK_EXTERNAL_WGSL_PROGRAMS(FUNC)
 
 /// Declares a set of benchmarks for the given function using a list of SPIR-V files.
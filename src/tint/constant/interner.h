@@ -0,0 +1,243 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_TINT_CONSTANT_INTERNER_H_
+#define SRC_TINT_CONSTANT_INTERNER_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "src/tint/constant/scalar.h"
+#include "src/tint/constant/value.h"
+#include "src/tint/utils/block_allocator.h"
+#include "src/tint/utils/hashmap.h"
+#include "src/tint/utils/vector.h"
+
+// Forward declarations
+namespace tint::constant {
+class Composite;
+class Splat;
+}  // namespace tint::constant
+
+namespace tint::constant {
+
+/// Interner de-duplicates constant values, like type::Manager de-duplicates types, so that equal
+/// constants share a single node and can be compared by pointer.
+///
+/// Two constants are equal if they are of the same class and type, and:
+/// * for scalars, their values are bit-identical. Positive and negative zero are not equal.
+/// * for splats and composites, their elements are the same nodes. As the elements are interned
+///   before the constants that hold them, this compares the elements by value.
+class Interner {
+  public:
+    /// Constructor
+    Interner();
+
+    /// Move constructor
+    Interner(Interner&&);
+
+    /// Destructor
+    ~Interner();
+
+    /// Move assignment operator
+    /// @returns this Interner
+    Interner& operator=(Interner&&);
+
+    /// @param allocator the allocator used to create the constant, if it wasn't interned yet
+    /// @param args the arguments used to construct the constant
+    /// @returns a pointer to a constant of type `T` constructed with @p args. If an equal constant
+    /// was interned before, then the pointer to that constant is returned.
+    template <typename T, typename... ARGS>
+    const T* Get(utils::BlockAllocator<Value>& allocator, ARGS&&... args) {
+        if constexpr (IsScalar<T>::value) {
+            return GetScalar<T>(allocator, std::forward<ARGS>(args)...);
+        } else if constexpr (std::is_same_v<T, Splat>) {
+            return GetSplat<T>(allocator, std::forward<ARGS>(args)...);
+        } else {
+            static_assert(std::is_same_v<T, Composite>, "T must be a Scalar, Splat or Composite");
+            return GetComposite<T>(allocator, std::forward<ARGS>(args)...);
+        }
+    }
+
+  private:
+    /// IsScalar::value is true if `T` is a Scalar
+    template <typename T>
+    struct IsScalar : std::false_type {};
+    /// IsScalar specialization for Scalar
+    template <typename T>
+    struct IsScalar<Scalar<T>> : std::true_type {};
+
+    /// ScalarKey is the key of an interned scalar
+    struct ScalarKey {
+        /// The TypeInfo of the Scalar class
+        const utils::TypeInfo* info;
+        /// The scalar type
+        const type::Type* type;
+        /// The bits of the scalar value
+        uint64_t bits;
+
+        /// @param other the key to compare against
+        /// @returns true if this key is equal to @p other
+        bool operator==(const ScalarKey& other) const {
+            return info == other.info && type == other.type && bits == other.bits;
+        }
+
+        /// Hasher provides the hash function of a ScalarKey
+        struct Hasher {
+            /// @param key the key to hash
+            /// @returns the hash of the key
+            size_t operator()(const ScalarKey& key) const {
+                return Mix(utils::Hash(key.info, key.type, key.bits));
+            }
+        };
+    };
+
+    /// SplatKey is the key of an interned splat
+    struct SplatKey {
+        /// The splat type
+        const type::Type* type;
+        /// The interned element
+        const Value* el;
+        /// The number of elements
+        size_t count;
+
+        /// @param other the key to compare against
+        /// @returns true if this key is equal to @p other
+        bool operator==(const SplatKey& other) const {
+            return type == other.type && el == other.el && count == other.count;
+        }
+
+        /// Hasher provides the hash function of a SplatKey
+        struct Hasher {
+            /// @param key the key to hash
+            /// @returns the hash of the key
+            size_t operator()(const SplatKey& key) const {
+                return Mix(utils::Hash(key.type, key.el, key.count));
+            }
+        };
+    };
+
+    /// CompositeKey is the key of an interned composite. Lookups point the key at the elements
+    /// passed to Get(), and interned composites at their own elements, so no constant has to be
+    /// built to find an existing one. The elements are interned, so they are compared by pointer.
+    struct CompositeKey {
+        /// The composite type
+        const type::Type* type;
+        /// The interned elements
+        const Value* const* elements;
+        /// The number of elements
+        size_t count;
+
+        /// @param other the key to compare against
+        /// @returns true if this key is equal to @p other
+        bool operator==(const CompositeKey& other) const {
+            return type == other.type && count == other.count &&
+                   std::equal(elements, elements + count, other.elements);
+        }
+
+        /// Hasher provides the hash function of a CompositeKey
+        struct Hasher {
+            /// @param key the key to hash
+            /// @returns the hash of the key
+            size_t operator()(const CompositeKey& key) const {
+                size_t hash = utils::Hash(key.type, key.count);
+                for (size_t i = 0; i < key.count; i++) {
+                    hash = utils::HashCombine(hash, key.elements[i]);
+                }
+                return Mix(hash);
+            }
+        };
+    };
+
+    /// @param hash the hash to mix
+    /// @returns @p hash with its bits mixed. The hashes of integers only differ by their value, so
+    /// consecutive integers would fill consecutive slots of the maps, and other constants hashed
+    /// into that run would have to probe to its end.
+    static size_t Mix(size_t hash) {
+        uint64_t h = static_cast<uint64_t>(hash);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+
+    /// @param allocator the allocator used to create the scalar, if it wasn't interned yet
+    /// @param type the scalar type
+    /// @param value the scalar value
+    /// @returns the interned scalar of type @p type and value @p value
+    template <typename T, typename V>
+    const T* GetScalar(utils::BlockAllocator<Value>& allocator, const type::Type* type, V value) {
+        ScalarKey key{&utils::TypeInfo::Of<T>(), type, 0};
+        if constexpr (std::is_same_v<V, bool>) {
+            key.bits = value ? 1 : 0;
+        } else {
+            static_assert(sizeof(value.value) <= sizeof(key.bits));
+            std::memcpy(&key.bits, &value.value, sizeof(value.value));
+        }
+        return static_cast<const T*>(scalars_.GetOrCreate(
+            key, [&] { return allocator.template Create<T>(type, value); }));
+    }
+
+    /// @param allocator the allocator used to create the splat, if it wasn't interned yet
+    /// @param type the splat type
+    /// @param el the interned element
+    /// @param count the number of elements
+    /// @returns the interned splat of type @p type with @p count elements @p el
+    template <typename T>
+    const T* GetSplat(utils::BlockAllocator<Value>& allocator,
+                      const type::Type* type,
+                      const Value* el,
+                      size_t count) {
+        return static_cast<const T*>(splats_.GetOrCreate(SplatKey{type, el, count}, [&] {
+            return allocator.template Create<T>(type, el, count);
+        }));
+    }
+
+    /// @param allocator the allocator used to create the composite, if it wasn't interned yet
+    /// @param type the composite type
+    /// @param elements the interned elements
+    /// @param all_zero true if all elements are 0
+    /// @param any_zero true if any element is 0
+    /// @returns the interned composite of type @p type with the elements @p elements
+    template <typename T>
+    const T* GetComposite(utils::BlockAllocator<Value>& allocator,
+                          const type::Type* type,
+                          utils::VectorRef<const Value*> elements,
+                          bool all_zero,
+                          bool any_zero) {
+        if (auto existing = composites_.Find(
+                CompositeKey{type, elements.begin(), elements.Length()})) {
+            return static_cast<const T*>(*existing);
+        }
+        const T* value =
+            allocator.template Create<T>(type, std::move(elements), all_zero, any_zero);
+        composites_.Add(CompositeKey{type, value->elements.begin(), value->elements.Length()},
+                        value);
+        return value;
+    }
+
+    /// The interned scalars
+    utils::Hashmap<ScalarKey, const Value*, 32, ScalarKey::Hasher> scalars_;
+    /// The interned splats
+    utils::Hashmap<SplatKey, const Value*, 16, SplatKey::Hasher> splats_;
+    /// The interned composites
+    utils::Hashmap<CompositeKey, const Value*, 16, CompositeKey::Hasher> composites_;
+};
+
+}  // namespace tint::constant
+
+#endif  // SRC_TINT_CONSTANT_INTERNER_H_
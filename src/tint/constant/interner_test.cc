@@ -0,0 +1,87 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/constant/interner.h"
+
+#include "src/tint/constant/scalar.h"
+#include "src/tint/constant/test_helper.h"
+#include "src/tint/type/abstract_float.h"
+
+namespace tint::constant {
+namespace {
+
+using namespace tint::number_suffixes;  // NOLINT
+
+using ConstantTest_Interner = TestHelper;
+
+TEST_F(ConstantTest_Interner, Scalars) {
+    auto* f32 = create<type::F32>();
+    auto* i32 = create<type::I32>();
+    auto* af = create<type::AbstractFloat>();
+
+    EXPECT_EQ(create<Scalar<tint::f32>>(f32, 1_f), create<Scalar<tint::f32>>(f32, 1_f));
+    EXPECT_NE(create<Scalar<tint::f32>>(f32, 1_f), create<Scalar<tint::f32>>(f32, 2_f));
+    EXPECT_EQ(create<Scalar<tint::i32>>(i32, 1_i), create<Scalar<tint::i32>>(i32, 1_i));
+    EXPECT_NE(create<Scalar<tint::i32>>(i32, 1_i), create<Scalar<tint::i32>>(i32, 2_i));
+
+    // Scalars of different types are not interned together.
+    EXPECT_NE(static_cast<const Value*>(create<Scalar<tint::f32>>(f32, 1_f)),
+              static_cast<const Value*>(create<Scalar<AFloat>>(af, 1.0_a)));
+
+    // The sign of zero is preserved.
+    auto* pos0 = create<Scalar<tint::f32>>(f32, 0_f);
+    auto* neg0 = create<Scalar<tint::f32>>(f32, -0_f);
+    EXPECT_NE(pos0, neg0);
+    EXPECT_TRUE(pos0->AllZero());
+    EXPECT_FALSE(neg0->AllZero());
+    EXPECT_EQ(neg0, create<Scalar<tint::f32>>(f32, -0_f));
+}
+
+TEST_F(ConstantTest_Interner, Composites) {
+    auto* f32 = create<type::F32>();
+    auto* vec3f = create<type::Vector>(f32, 3u);
+
+    auto make = [&](tint::f32 x, tint::f32 y, tint::f32 z) {
+        return create<Composite>(vec3f, utils::Vector<const Value*, 3>{
+                                            create<Scalar<tint::f32>>(f32, x),
+                                            create<Scalar<tint::f32>>(f32, y),
+                                            create<Scalar<tint::f32>>(f32, z),
+                                        });
+    };
+
+    auto* a = make(1_f, 2_f, 3_f);
+    EXPECT_TRUE(a->Is<Composite>());
+    EXPECT_EQ(a, make(1_f, 2_f, 3_f));
+    EXPECT_NE(a, make(1_f, 2_f, 4_f));
+    EXPECT_NE(make(0_f, 0_f, 1_f), make(-0_f, 0_f, 1_f));
+}
+
+TEST_F(ConstantTest_Interner, Splats) {
+    auto* f32 = create<type::F32>();
+    auto* vec2f = create<type::Vector>(f32, 2u);
+    auto* vec4f = create<type::Vector>(f32, 4u);
+    auto* one = create<Scalar<tint::f32>>(f32, 1_f);
+
+    auto* a = create<Splat>(vec4f, one, 4);
+    EXPECT_EQ(a, create<Splat>(vec4f, one, 4));
+    EXPECT_NE(static_cast<const Value*>(a),
+              static_cast<const Value*>(create<Splat>(vec2f, one, 2)));
+
+    // Composites of identical elements are created as splats, so they are interned together.
+    auto* b = create<Composite>(vec4f, utils::Vector<const Value*, 4>{one, one, one, one});
+    EXPECT_EQ(b, static_cast<const Value*>(a));
+}
+
+}  // namespace
+}  // namespace tint::constant
@@ -43,6 +43,8 @@ ProgramBuilder::ProgramBuilder(ProgramBuilder&& rhs)
       types_(std::move(rhs.types_)),
       ast_nodes_(std::move(rhs.ast_nodes_)),
       sem_nodes_(std::move(rhs.sem_nodes_)),
+      constant_nodes_(std::move(rhs.constant_nodes_)),
+      constants_(std::move(rhs.constants_)),
       ast_(std::move(rhs.ast_)),
       sem_(std::move(rhs.sem_)),
       symbols_(std::move(rhs.symbols_)),
@@ -60,6 +62,8 @@ ProgramBuilder& ProgramBuilder::operator=(ProgramBuilder&& rhs) {
     types_ = std::move(rhs.types_);
     ast_nodes_ = std::move(rhs.ast_nodes_);
     sem_nodes_ = std::move(rhs.sem_nodes_);
+    constant_nodes_ = std::move(rhs.constant_nodes_);
+    constants_ = std::move(rhs.constants_);
     ast_ = std::move(rhs.ast_);
     sem_ = std::move(rhs.sem_);
     symbols_ = std::move(rhs.symbols_);
@@ -167,8 +171,8 @@ const constant::Value* ProgramBuilder::createSplatOrComposite(
         return create<constant::Splat>(type, elements[0], elements.Length());
     }
 
-    return constant_nodes_.Create<constant::Composite>(type, std::move(elements), all_zero,
-                                                       any_zero);
+    return constants_.Get<constant::Composite>(constant_nodes_, type, std::move(elements), all_zero,
+                                               any_zero);
 }
 
 }  // namespace tint
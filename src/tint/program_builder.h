@@ -79,6 +79,7 @@
 #include "src/tint/builtin/interpolation_sampling.h"
 #include "src/tint/builtin/interpolation_type.h"
 #include "src/tint/constant/composite.h"
+#include "src/tint/constant/interner.h"
 #include "src/tint/constant/splat.h"
 #include "src/tint/constant/value.h"
 #include "src/tint/number.h"
@@ -529,17 +530,18 @@ class ProgramBuilder {
     }
 
     /// Creates a new constant::Value owned by the ProgramBuilder.
-    /// When the ProgramBuilder is destructed, the sem::Node will also be destructed.
+    /// When the ProgramBuilder is destructed, the constant::Value will also be destructed.
+    /// Constants are interned, so calling create() with equal arguments returns the same pointer.
     /// @param args the arguments to pass to the constructor
     /// @returns the node pointer
     template <typename T, typename... ARGS>
     utils::traits::EnableIf<utils::traits::IsTypeOrDerived<T, constant::Value> &&
                                 !utils::traits::IsTypeOrDerived<T, constant::Composite> &&
                                 !utils::traits::IsTypeOrDerived<T, constant::Splat>,
-                            T>*
+                            const T>*
     create(ARGS&&... args) {
         AssertNotMoved();
-        return constant_nodes_.Create<T>(std::forward<ARGS>(args)...);
+        return constants_.Get<T>(constant_nodes_, std::forward<ARGS>(args)...);
     }
 
     /// Constructs a constant of a vector, matrix or array type.
@@ -572,7 +574,7 @@ class ProgramBuilder {
                                   const constant::Value* element,
                                   size_t n) {
         AssertNotMoved();
-        return constant_nodes_.Create<constant::Splat>(type, element, n);
+        return constants_.Get<constant::Splat>(constant_nodes_, type, element, n);
     }
 
     /// Creates a new type::Node owned by the ProgramBuilder.
@@ -3971,6 +3973,7 @@ class ProgramBuilder {
     ASTNodeAllocator ast_nodes_;
     SemNodeAllocator sem_nodes_;
     ConstantAllocator constant_nodes_;
+    constant::Interner constants_;
     ast::Module* ast_;
     sem::Info sem_;
     SymbolTable symbols_{id_};
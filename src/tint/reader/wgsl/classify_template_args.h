@@ -17,10 +17,139 @@
 
 #include <vector>
 
+#include "src/tint/debug.h"
 #include "src/tint/reader/wgsl/token.h"
+#include "src/tint/utils/vector.h"
 
 namespace tint::reader::wgsl {
 
+/// TemplateArgClassifier classifies the '<' and '>' tokens that open and close template argument
+/// lists, one token at a time. This allows the classification to be performed on a stream of
+/// tokens, as they are lexed.
+class TemplateArgClassifier {
+  public:
+    /// Classifies the token at index @p i of @p tokens, which may also classify the token at index
+    /// `i + 1`.
+    /// @param tokens the indexable list of tokens. The token at `i + 1` must exist.
+    /// @param i the index of the token to classify
+    /// @returns the index of the next token to classify
+    template <typename TOKENS>
+    size_t Classify(TOKENS& tokens, size_t i) {
+        switch (tokens[i].type()) {
+            case Token::Type::kIdentifier:
+            case Token::Type::kVar:
+            case Token::Type::kBitcast: {
+                auto& next = tokens[i + 1];
+                if (next.type() == Token::Type::kLessThan) {
+                    // ident '<'
+                    // Push this '<' to the stack, along with the current nesting expr_depth.
+                    stack_.Push(StackEntry{i + 1, expr_depth_});
+                    return i + 2;  // Skip the '<'
+                }
+                break;
+            }
+            case Token::Type::kGreaterThan:       // '>'
+            case Token::Type::kShiftRight:        // '>>'
+            case Token::Type::kGreaterThanEqual:  // '>='
+            case Token::Type::kShiftRightEqual:   // '>>='
+                if (!stack_.IsEmpty() && stack_.Back().expr_depth == expr_depth_) {
+                    // '<' and '>' at same expr_depth, and no terminating tokens in-between.
+                    // Consider both as a template argument list.
+                    MaybeSplit(tokens[i], tokens[i + 1]);
+                    tokens[stack_.Pop().index].SetType(Token::Type::kTemplateArgsLeft);
+                    tokens[i].SetType(Token::Type::kTemplateArgsRight);
+                }
+                break;
+
+            case Token::Type::kParenLeft:    // '('
+            case Token::Type::kBracketLeft:  // '['
+                // Entering a nested expression
+                expr_depth_++;
+                break;
+
+            case Token::Type::kParenRight:    // ')'
+            case Token::Type::kBracketRight:  // ']'
+                // Exiting a nested expression
+                // Pop the stack until we return to the current expression expr_depth
+                while (!stack_.IsEmpty() && stack_.Back().expr_depth == expr_depth_) {
+                    stack_.Pop();
+                }
+                if (expr_depth_ > 0) {
+                    expr_depth_--;
+                }
+                break;
+
+            case Token::Type::kSemicolon:  // ';'
+            case Token::Type::kBraceLeft:  // '{'
+            case Token::Type::kEqual:      // '='
+            case Token::Type::kColon:      // ':'
+                // Expression terminating tokens. No opening template list can hold these tokens, so
+                // clear the stack and expression depth.
+                expr_depth_ = 0;
+                stack_.Clear();
+                break;
+
+            case Token::Type::kOrOr:    // '||'
+            case Token::Type::kAndAnd:  // '&&'
+                // Treat 'a < b || c > d' as a logical binary operator of two comparison operators
+                // instead of a single template argument 'b||c'.
+                // Use parentheses around 'b||c' to parse as a template argument list.
+                while (!stack_.IsEmpty() && stack_.Back().expr_depth == expr_depth_) {
+                    stack_.Pop();
+                }
+                break;
+
+            default:
+                break;
+        }
+        return i + 1;
+    }
+
+    /// @returns true if there are no '<' tokens waiting for a matching '>'. When this is true, all
+    /// the classified tokens have their final type.
+    bool IsResolved() const { return stack_.IsEmpty(); }
+
+  private:
+    /// If @p token is a '>>', '>=' or '>>=', then the token is split into two, with the first
+    /// being '>' and the second replacing the @p placeholder. Otherwise MaybeSplit() is a no-op.
+    static void MaybeSplit(Token& token, Token& placeholder) {
+        switch (token.type()) {
+            case Token::Type::kShiftRight:  //  '>>'
+                TINT_ASSERT(Reader, placeholder.type() == Token::Type::kPlaceholder);
+                token.SetType(Token::Type::kGreaterThan);
+                placeholder.SetType(Token::Type::kGreaterThan);
+                break;
+            case Token::Type::kGreaterThanEqual:  //  '>='
+                TINT_ASSERT(Reader, placeholder.type() == Token::Type::kPlaceholder);
+                token.SetType(Token::Type::kGreaterThan);
+                placeholder.SetType(Token::Type::kEqual);
+                break;
+            case Token::Type::kShiftRightEqual:  // '>>='
+                TINT_ASSERT(Reader, placeholder.type() == Token::Type::kPlaceholder);
+                token.SetType(Token::Type::kGreaterThan);
+                placeholder.SetType(Token::Type::kGreaterThanEqual);
+                break;
+            default:
+                break;
+        }
+    }
+
+    /// The current expression nesting depth.
+    /// Each '(', '[' increments the depth.
+    /// Each ')', ']' decrements the depth.
+    uint64_t expr_depth_ = 0;
+
+    /// A stack of '<' tokens.
+    /// Used to pair '<' and '>' tokens at the same expression depth.
+    struct StackEntry {
+        size_t index;         // The index of the opening '<' token
+        uint64_t expr_depth;  // The value of 'expr_depth' for the opening '<'
+    };
+    utils::Vector<StackEntry, 16> stack_;
+};
+
+/// Classifies all the template argument list '<' and '>' tokens in @p tokens.
+/// @param tokens the full list of tokens, ending with an EOF or error token
 void ClassifyTemplateArguments(std::vector<Token>& tokens);
 
 }  // namespace tint::reader::wgsl
@@ -14,6 +14,7 @@
 
 #include "src/tint/reader/wgsl/lexer.h"
 
+#include <array>
 #include <cctype>
 #include <charconv>
 #include <cmath>
@@ -68,6 +69,106 @@ bool read_blankspace(std::string_view str, size_t i, bool* is_blankspace, size_t
     return true;
 }
 
+/// Classes of the first byte of a token, used by Lexer::next() to pick the only token kinds that
+/// can start with that byte.
+enum class CharClass : uint8_t {
+    kOther,       // Punctuation, or an invalid character.
+    kBlank,       // ASCII blankspace.
+    kDigit,       // Start of a numeric literal.
+    kPeriod,      // Start of a float literal, or a period.
+    kIdentStart,  // Start of an identifier or keyword, or '_'. Includes all non-ASCII bytes.
+};
+
+constexpr std::array<CharClass, 256> BuildCharClassTable() {
+    std::array<CharClass, 256> table{};
+    for (size_t c = 0; c < table.size(); c++) {
+        if (c == ' ' || c == '\t') {
+            table[c] = CharClass::kBlank;
+        } else if (c >= '0' && c <= '9') {
+            table[c] = CharClass::kDigit;
+        } else if (c == '.') {
+            table[c] = CharClass::kPeriod;
+        } else if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c >= 0x80) {
+            table[c] = CharClass::kIdentStart;
+        } else {
+            table[c] = CharClass::kOther;
+        }
+    }
+    return table;
+}
+
+constexpr std::array<CharClass, 256> kCharClasses = BuildCharClassTable();
+
+CharClass ClassOf(char c) {
+    return kCharClasses[static_cast<uint8_t>(c)];
+}
+
+struct Keyword {
+    std::string_view name;
+    Token::Type type = Token::Type::kUninitialized;
+};
+
+constexpr Keyword kKeywords[] = {
+    {"alias", Token::Type::kAlias},
+    {"bitcast", Token::Type::kBitcast},
+    {"break", Token::Type::kBreak},
+    {"case", Token::Type::kCase},
+    {"const", Token::Type::kConst},
+    {"const_assert", Token::Type::kConstAssert},
+    {"continue", Token::Type::kContinue},
+    {"continuing", Token::Type::kContinuing},
+    {"diagnostic", Token::Type::kDiagnostic},
+    {"discard", Token::Type::kDiscard},
+    {"default", Token::Type::kDefault},
+    {"else", Token::Type::kElse},
+    {"enable", Token::Type::kEnable},
+    {"fallthrough", Token::Type::kFallthrough},
+    {"false", Token::Type::kFalse},
+    {"fn", Token::Type::kFn},
+    {"for", Token::Type::kFor},
+    {"if", Token::Type::kIf},
+    {"let", Token::Type::kLet},
+    {"loop", Token::Type::kLoop},
+    {"override", Token::Type::kOverride},
+    {"return", Token::Type::kReturn},
+    {"requires", Token::Type::kRequires},
+    {"struct", Token::Type::kStruct},
+    {"switch", Token::Type::kSwitch},
+    {"true", Token::Type::kTrue},
+    {"var", Token::Type::kVar},
+    {"while", Token::Type::kWhile},
+};
+
+constexpr size_t kKeywordTableSize = 64;
+
+/// A perfect hash of the keywords in kKeywords, built from the length and the first and last
+/// characters of the string. The multipliers were picked so that no two keywords collide.
+constexpr size_t KeywordHash(std::string_view str) {
+    return (str.size() + 14 * static_cast<uint8_t>(str.front()) +
+            30 * static_cast<uint8_t>(str.back())) &
+           (kKeywordTableSize - 1);
+}
+
+struct KeywordTable {
+    std::array<Keyword, kKeywordTableSize> slots{};
+    bool has_collisions = false;
+};
+
+constexpr KeywordTable BuildKeywordTable() {
+    KeywordTable table;
+    for (auto& keyword : kKeywords) {
+        auto& slot = table.slots[KeywordHash(keyword.name)];
+        if (!slot.name.empty()) {
+            table.has_collisions = true;
+        }
+        slot = keyword;
+    }
+    return table;
+}
+
+constexpr KeywordTable kKeywordTable = BuildKeywordTable();
+static_assert(!kKeywordTable.has_collisions, "KeywordHash() is not a perfect hash of kKeywords");
+
 uint32_t dec_value(char c) {
     if (c >= '0' && c <= '9') {
         return static_cast<uint32_t>(c - '0');
@@ -98,20 +199,7 @@ std::vector<Token> Lexer::Lex() {
     std::vector<Token> tokens;
     tokens.reserve(kDefaultListSize);
 
-    while (true) {
-        tokens.emplace_back(next());
-        if (tokens.back().IsEof() || tokens.back().IsError()) {
-            break;
-        }
-
-        // If the token can be split, we insert a placeholder element(s) into the stream to hold the
-        // split character.
-        size_t num_placeholders = tokens.back().NumPlaceholders();
-        for (size_t i = 0; i < num_placeholders; i++) {
-            auto src = tokens.back().source();
-            src.range.begin.column++;
-            tokens.emplace_back(Token::Type::kPlaceholder, src);
-        }
+    while (LexNext(tokens)) {
     }
     return tokens;
 }
@@ -173,24 +261,37 @@ Token Lexer::next() {
         return std::move(t.value());
     }
 
-    if (auto t = try_hex_float(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
-
-    if (auto t = try_hex_integer(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
-
-    if (auto t = try_float(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
-
-    if (auto t = try_integer(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
-
-    if (auto t = try_ident(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
+    // Only try the token kinds that can start with the current character.
+    switch (ClassOf(at(pos()))) {
+        case CharClass::kDigit:
+            if (matches(pos(), '0') && (matches(pos() + 1, 'x') || matches(pos() + 1, 'X'))) {
+                if (auto t = try_hex_float(); t.has_value() && !t->IsUninitialized()) {
+                    return std::move(t.value());
+                }
+                if (auto t = try_hex_integer(); t.has_value() && !t->IsUninitialized()) {
+                    return std::move(t.value());
+                }
+            }
+            if (auto t = try_float(); t.has_value() && !t->IsUninitialized()) {
+                return std::move(t.value());
+            }
+            if (auto t = try_integer(); t.has_value() && !t->IsUninitialized()) {
+                return std::move(t.value());
+            }
+            break;
+        case CharClass::kPeriod:
+            if (auto t = try_float(); t.has_value() && !t->IsUninitialized()) {
+                return std::move(t.value());
+            }
+            break;
+        case CharClass::kIdentStart:
+            if (auto t = try_ident(); t.has_value() && !t->IsUninitialized()) {
+                return std::move(t.value());
+            }
+            break;
+        case CharClass::kBlank:
+        case CharClass::kOther:
+            break;
     }
 
     if (auto t = try_punctuation(); t.has_value() && !t->IsUninitialized()) {
@@ -248,6 +349,12 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
                 continue;
             }
 
+            // Fast path for ASCII blankspace, which doesn't need to be UTF-8 decoded.
+            if (ClassOf(at(pos())) == CharClass::kBlank) {
+                advance();
+                continue;
+            }
+
             bool is_blankspace;
             size_t blankspace_size;
             if (!read_blankspace(line(), pos(), &is_blankspace, &blankspace_size)) {
@@ -281,12 +388,13 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
 std::optional<Token> Lexer::skip_comment() {
     if (matches(pos(), "//")) {
         // Line comment: ignore everything until the end of line.
-        while (!is_eol()) {
-            if (is_null()) {
-                return Token{Token::Type::kError, begin_source(), "null character found"};
-            }
-            advance();
+        // memchr() is used to scan the rest of the line for null characters in bulk.
+        auto rest = line().substr(pos());
+        if (auto* null = static_cast<const char*>(std::memchr(rest.data(), 0, rest.size()))) {
+            advance(static_cast<size_t>(null - rest.data()));
+            return Token{Token::Type::kError, begin_source(), "null character found"};
         }
+        advance(rest.size());
         return {};
     }
 
@@ -1195,89 +1303,9 @@ std::optional<Token> Lexer::try_punctuation() {
 }
 
 std::optional<Token> Lexer::check_keyword(const Source& source, std::string_view str) {
-    if (str == "alias") {
-        return Token{Token::Type::kAlias, source, "alias"};
-    }
-    if (str == "bitcast") {
-        return Token{Token::Type::kBitcast, source, "bitcast"};
-    }
-    if (str == "break") {
-        return Token{Token::Type::kBreak, source, "break"};
-    }
-    if (str == "case") {
-        return Token{Token::Type::kCase, source, "case"};
-    }
-    if (str == "const") {
-        return Token{Token::Type::kConst, source, "const"};
-    }
-    if (str == "const_assert") {
-        return Token{Token::Type::kConstAssert, source, "const_assert"};
-    }
-    if (str == "continue") {
-        return Token{Token::Type::kContinue, source, "continue"};
-    }
-    if (str == "continuing") {
-        return Token{Token::Type::kContinuing, source, "continuing"};
-    }
-    if (str == "diagnostic") {
-        return Token{Token::Type::kDiagnostic, source, "diagnostic"};
-    }
-    if (str == "discard") {
-        return Token{Token::Type::kDiscard, source, "discard"};
-    }
-    if (str == "default") {
-        return Token{Token::Type::kDefault, source, "default"};
-    }
-    if (str == "else") {
-        return Token{Token::Type::kElse, source, "else"};
-    }
-    if (str == "enable") {
-        return Token{Token::Type::kEnable, source, "enable"};
-    }
-    if (str == "fallthrough") {
-        return Token{Token::Type::kFallthrough, source, "fallthrough"};
-    }
-    if (str == "false") {
-        return Token{Token::Type::kFalse, source, "false"};
-    }
-    if (str == "fn") {
-        return Token{Token::Type::kFn, source, "fn"};
-    }
-    if (str == "for") {
-        return Token{Token::Type::kFor, source, "for"};
-    }
-    if (str == "if") {
-        return Token{Token::Type::kIf, source, "if"};
-    }
-    if (str == "let") {
-        return Token{Token::Type::kLet, source, "let"};
-    }
-    if (str == "loop") {
-        return Token{Token::Type::kLoop, source, "loop"};
-    }
-    if (str == "override") {
-        return Token{Token::Type::kOverride, source, "override"};
-    }
-    if (str == "return") {
-        return Token{Token::Type::kReturn, source, "return"};
-    }
-    if (str == "requires") {
-        return Token{Token::Type::kRequires, source, "requires"};
-    }
-    if (str == "struct") {
-        return Token{Token::Type::kStruct, source, "struct"};
-    }
-    if (str == "switch") {
-        return Token{Token::Type::kSwitch, source, "switch"};
-    }
-    if (str == "true") {
-        return Token{Token::Type::kTrue, source, "true"};
-    }
-    if (str == "var") {
-        return Token{Token::Type::kVar, source, "var"};
-    }
-    if (str == "while") {
-        return Token{Token::Type::kWhile, source, "while"};
+    auto& keyword = kKeywordTable.slots[KeywordHash(str)];
+    if (keyword.name == str) {
+        return Token{keyword.type, source, keyword.name};
     }
     return {};
 }
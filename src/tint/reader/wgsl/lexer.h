@@ -34,6 +34,28 @@ class Lexer {
     /// @return the token list.
     std::vector<Token> Lex();
 
+    /// Lexes the next token in the input stream, appending it to @p tokens, followed by any
+    /// placeholder tokens required to hold the token's split characters.
+    /// @param tokens the list of tokens to append to
+    /// @returns false if the appended token was an EOF or error token, otherwise true
+    template <typename TOKENS>
+    bool LexNext(TOKENS& tokens) {
+        tokens.emplace_back(next());
+        if (tokens.back().IsEof() || tokens.back().IsError()) {
+            return false;
+        }
+
+        // If the token can be split, we insert a placeholder element(s) into the stream to hold the
+        // split character.
+        size_t num_placeholders = tokens.back().NumPlaceholders();
+        for (size_t i = 0; i < num_placeholders; i++) {
+            auto src = tokens.back().source();
+            src.range.begin.column++;
+            tokens.emplace_back(Token::Type::kPlaceholder, src);
+        }
+        return true;
+    }
+
   private:
     /// Returns the next token in the input stream.
     /// @return Token
@@ -15,6 +15,7 @@
 #include <string>
 
 #include "src/tint/bench/benchmark.h"
+#include "src/tint/reader/wgsl/lexer.h"
 
 namespace tint::reader::wgsl {
 namespace {
@@ -36,5 +37,28 @@ void ParseWGSL(benchmark::State& state, std::string input_name) {
 
 TINT_BENCHMARK_PROGRAMS(ParseWGSL);
 
+void LexWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto& file = std::get<Source::File>(res);
+    size_t num_tokens = 0;
+    for (auto _ : state) {
+        Lexer l(&file);
+        auto tokens = l.Lex();
+        if (tokens.back().IsError()) {
+            state.SkipWithError(tokens.back().to_str().c_str());
+        }
+        num_tokens += tokens.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * file.content.data.size()));
+    state.counters["tokens"] =
+        benchmark::Counter(static_cast<double>(num_tokens), benchmark::Counter::kIsRate);
+}
+
+TINT_BENCHMARK_PROGRAMS(LexWGSL);
+
 }  // namespace
 }  // namespace tint::reader::wgsl
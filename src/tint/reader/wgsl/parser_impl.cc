@@ -14,6 +14,7 @@
 
 #include "src/tint/reader/wgsl/parser_impl.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "src/tint/ast/assignment_statement.h"
@@ -253,37 +254,39 @@ void ParserImpl::deprecated(const Source& source, std::string_view msg) {
 
 const Token& ParserImpl::next() {
     // If the next token is already an error or the end of file, stay there.
-    if (tokens_[next_token_idx_].IsEof() || tokens_[next_token_idx_].IsError()) {
-        return tokens_[next_token_idx_];
+    lex_to(next_token_idx_);
+    if (token_at(next_token_idx_).IsEof() || token_at(next_token_idx_).IsError()) {
+        return token_at(next_token_idx_);
     }
 
     // Skip over any placeholder elements
     while (true) {
-        if (!tokens_[next_token_idx_].IsPlaceholder()) {
+        if (!token_at(next_token_idx_).IsPlaceholder()) {
             break;
         }
         next_token_idx_++;
+        lex_to(next_token_idx_);
     }
     last_source_idx_ = next_token_idx_;
 
-    if (!tokens_[next_token_idx_].IsEof() && !tokens_[next_token_idx_].IsError()) {
+    if (!token_at(next_token_idx_).IsEof() && !token_at(next_token_idx_).IsError()) {
         next_token_idx_++;
     }
-    return tokens_[last_source_idx_];
+    return token_at(last_source_idx_);
 }
 
 const Token& ParserImpl::peek(size_t count) {
-    for (size_t idx = next_token_idx_; idx < tokens_.size(); idx++) {
-        if (tokens_[idx].IsPlaceholder()) {
+    for (size_t idx = next_token_idx_; lex_to(idx); idx++) {
+        if (token_at(idx).IsPlaceholder()) {
             continue;
         }
         if (count == 0) {
-            return tokens_[idx];
+            return token_at(idx);
         }
         count--;
     }
     // Walked off the end of the token list, return last token.
-    return tokens_[tokens_.size() - 1];
+    return tokens_.back();
 }
 
 bool ParserImpl::peek_is(Token::Type tok, size_t idx) {
@@ -295,25 +298,88 @@ void ParserImpl::split_token(Token::Type lhs, Token::Type rhs) {
         TINT_ICE(Reader, builder_.Diagnostics())
             << "attempt to update placeholder at beginning of tokens";
     }
-    if (TINT_UNLIKELY(next_token_idx_ >= tokens_.size())) {
+    if (TINT_UNLIKELY(!lex_to(next_token_idx_))) {
         TINT_ICE(Reader, builder_.Diagnostics())
             << "attempt to update placeholder past end of tokens";
     }
-    if (TINT_UNLIKELY(!tokens_[next_token_idx_].IsPlaceholder())) {
+    if (TINT_UNLIKELY(!token_at(next_token_idx_).IsPlaceholder())) {
         TINT_ICE(Reader, builder_.Diagnostics()) << "attempt to update non-placeholder token";
     }
-    tokens_[next_token_idx_ - 1].SetType(lhs);
-    tokens_[next_token_idx_].SetType(rhs);
+    token_at(next_token_idx_ - 1).SetType(lhs);
+    token_at(next_token_idx_).SetType(rhs);
 }
 
 Source ParserImpl::last_source() const {
-    return tokens_[last_source_idx_].source();
+    return token_at(last_source_idx_).source();
 }
 
 void ParserImpl::InitializeLex() {
-    Lexer l{file_};
-    tokens_ = l.Lex();
-    ClassifyTemplateArguments(tokens_);
+    lexer_ = std::make_unique<Lexer>(file_);
+    classifier_ = TemplateArgClassifier{};
+    tokens_.clear();
+    tokens_classified_ = 0;
+    tokens_final_ = 0;
+    lex_done_ = false;
+    next_token_idx_ = 0;
+    last_source_idx_ = 0;
+    // Ensure there's always at least one token to return from peek().
+    lex_to(0);
+}
+
+void ParserImpl::lex_batch() {
+    for (size_t i = 0; i < kLexBatchSize && !lex_done_; i++) {
+        lex_done_ = !lexer_->LexNext(tokens_);
+    }
+
+    // Classify the template argument list tokens. Classification of a token may depend on the
+    // token that follows it, so the last lexed token is left until the next batch is lexed.
+    const size_t end = tokens_.end();
+    while (tokens_classified_ + 1 < end) {
+        tokens_classified_ = classifier_.Classify(tokens_, tokens_classified_);
+        if (classifier_.IsResolved()) {
+            // No '<' tokens are waiting for a closing '>', so the classified tokens will not
+            // change.
+            tokens_final_ = tokens_classified_;
+        }
+    }
+
+    if (lex_done_) {
+        // The final token is an EOF or error token. Any unmatched '<' are less-than operators.
+        tokens_final_ = end;
+    }
+}
+
+void ParserImpl::release_consumed_tokens() {
+    // The token at last_source_idx_ is still referenced by last_source().
+    tokens_.release(std::min(last_source_idx_, tokens_final_));
+}
+
+void ParserImpl::TokenWindow::release(size_t idx) {
+    if (end_ == 0) {
+        return;
+    }
+    // The chunk holding the last token is always kept, so that back() remains valid.
+    size_t keep_chunk = std::min(idx, end_ - 1) >> kChunkShift;
+    if (keep_chunk <= first_chunk_) {
+        return;
+    }
+    size_t count = keep_chunk - first_chunk_;
+    spare_chunk_ = std::move(chunks_[count - 1]);
+    spare_chunk_.clear();
+    chunks_.erase(chunks_.begin(), chunks_.begin() + static_cast<std::ptrdiff_t>(count));
+    first_chunk_ += count;
+}
+
+void ParserImpl::TokenWindow::clear() {
+    chunks_.clear();
+    first_chunk_ = 0;
+    end_ = 0;
+}
+
+void ParserImpl::TokenWindow::add_chunk() {
+    chunks_.emplace_back(std::move(spare_chunk_));
+    chunks_.back().reserve(kChunkSize);
+    spare_chunk_ = std::vector<Token>{};
 }
 
 bool ParserImpl::Parse() {
@@ -327,6 +393,9 @@ bool ParserImpl::Parse() {
 void ParserImpl::translation_unit() {
     bool after_global_decl = false;
     while (continue_parsing()) {
+        // Tokens of previous declarations are no longer required.
+        release_consumed_tokens();
+
         auto& p = peek();
         if (p.IsEof()) {
             break;
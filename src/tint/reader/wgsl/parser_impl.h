@@ -24,6 +24,7 @@
 
 #include "src/tint/builtin/access.h"
 #include "src/tint/program_builder.h"
+#include "src/tint/reader/wgsl/classify_template_args.h"
 #include "src/tint/reader/wgsl/parser_impl_detail.h"
 #include "src/tint/reader/wgsl/token.h"
 
@@ -293,8 +294,8 @@ class ParserImpl {
     explicit ParserImpl(Source::File const* file);
     ~ParserImpl();
 
-    /// Reads tokens from the source file. This will be called automatically
-    /// by |parse|.
+    /// Prepares the parser to read tokens from the source file. Tokens are lexed lazily, as the
+    /// parser peeks ahead. This will be called automatically by |parse|.
     void InitializeLex();
 
     /// Run the parser
@@ -853,8 +854,102 @@ class ParserImpl {
         return builder_.create<T>(std::forward<ARGS>(args)...);
     }
 
+    /// TokenWindow holds the lexed tokens that the parser may still reference, indexed by their
+    /// absolute index in the token stream. The tokens are stored in fixed-size chunks, so
+    /// appending a token never moves the tokens already held, and indexing is a shift and a mask.
+    class TokenWindow {
+      public:
+        /// @param idx the absolute index of the token, which must be held by the window
+        /// @returns the token at index @p idx
+        Token& operator[](size_t idx) {
+            return chunks_[(idx >> kChunkShift) - first_chunk_][idx & kChunkMask];
+        }
+        /// @param idx the absolute index of the token, which must be held by the window
+        /// @returns the token at index @p idx
+        const Token& operator[](size_t idx) const {
+            return chunks_[(idx >> kChunkShift) - first_chunk_][idx & kChunkMask];
+        }
+
+        /// Constructs a new token at the end of the window
+        /// @param args the arguments to pass to the Token constructor
+        template <typename... ARGS>
+        void emplace_back(ARGS&&... args) {
+            if ((end_ & kChunkMask) == 0) {
+                add_chunk();
+            }
+            chunks_.back().emplace_back(std::forward<ARGS>(args)...);
+            end_++;
+        }
+
+        /// @returns the last token of the window
+        Token& back() { return chunks_.back().back(); }
+        /// @returns the last token of the window
+        const Token& back() const { return chunks_.back().back(); }
+
+        /// @returns the absolute index one past the last token of the window
+        size_t end() const { return end_; }
+
+        /// Discards the chunks that only hold tokens before the absolute index @p idx.
+        /// @param idx the absolute index of the first token that must be kept
+        void release(size_t idx);
+
+        /// Removes all the tokens
+        void clear();
+
+      private:
+        static constexpr size_t kChunkShift = 8;
+        static constexpr size_t kChunkSize = size_t{1} << kChunkShift;
+        static constexpr size_t kChunkMask = kChunkSize - 1;
+
+        /// Appends an empty chunk, reusing #spare_chunk_'s allocation if it has one.
+        void add_chunk();
+
+        /// The chunks of tokens. The first chunk holds the tokens from the absolute index
+        /// `first_chunk_ * kChunkSize`.
+        std::vector<std::vector<Token>> chunks_;
+        /// A released chunk, kept for reuse by the next chunk.
+        std::vector<Token> spare_chunk_;
+        /// The index of the first chunk in #chunks_, counted from the start of the token stream.
+        size_t first_chunk_ = 0;
+        /// The absolute index one past the last token.
+        size_t end_ = 0;
+    };
+
+    /// The number of tokens lexed by each call to lex_batch().
+    static constexpr size_t kLexBatchSize = 64;
+
+    /// Lexes and classifies tokens until the token at index @p idx has its final type, or the
+    /// end of the token stream has been reached.
+    /// @param idx the absolute index of the token
+    /// @returns true if the token at index @p idx exists
+    bool lex_to(size_t idx) {
+        while (idx >= tokens_final_ && !lex_done_) {
+            lex_batch();
+        }
+        return idx < tokens_.end();
+    }
+    /// Lexes the next #kLexBatchSize tokens, and classifies any template argument tokens that can
+    /// be classified. Lexing in batches keeps the per-token cost close to that of lexing the whole
+    /// file up front.
+    void lex_batch();
+    /// Discards the consumed tokens that are no longer referenced by the parser.
+    void release_consumed_tokens();
+    /// @returns the token at the absolute index @p idx, which must be held by #tokens_
+    Token& token_at(size_t idx) { return tokens_[idx]; }
+    /// @returns the token at the absolute index @p idx, which must be held by #tokens_
+    const Token& token_at(size_t idx) const { return tokens_[idx]; }
+
     Source::File const* const file_;
-    std::vector<Token> tokens_;
+    std::unique_ptr<Lexer> lexer_;
+    TemplateArgClassifier classifier_;
+    /// The window of lexed tokens.
+    TokenWindow tokens_;
+    /// The absolute index of the next token to pass to #classifier_.
+    size_t tokens_classified_ = 0;
+    /// The absolute index of the first token that may still be reclassified.
+    size_t tokens_final_ = 0;
+    /// True when the lexer has produced an EOF or error token.
+    bool lex_done_ = false;
     size_t next_token_idx_ = 0;
     size_t last_source_idx_ = 0;
     bool synchronized_ = true;
@@ -56,6 +56,48 @@ fn foo() -> S {
     ASSERT_EQ(1u, program.AST().TypeDecls().Length());
 }
 
+TEST_F(ParserImplTest, Parses_ManyDeclarations) {
+    // Tokens are lexed on demand, and released after each global declaration.
+    // Ensure that template argument lists are still correctly classified across declarations.
+    std::string src;
+    for (int i = 0; i < 100; i++) {
+        auto n = std::to_string(i);
+        src += "var<private> v" + n + " : array<vec4<f32>, (1 + 2)>;\n";
+        src += "fn f" + n + "(a : i32, b : i32) -> bool { return a < b || b > a; }\n";
+    }
+    auto p = parser(src);
+    ASSERT_TRUE(p->Parse()) << p->error();
+
+    Program program = p->program();
+    ASSERT_EQ(100u, program.AST().Functions().Length());
+    ASSERT_EQ(100u, program.AST().GlobalVariables().Length());
+}
+
+TEST_F(ParserImplTest, Parses_SplitTokensAfterReleasedDeclarations) {
+    // The parser splits `--` in `a--b` and `&&` in `&&a = 2` into two tokens. Ensure that splitting
+    // works once the tokens of the preceding declarations have been released.
+    std::string src;
+    for (int i = 0; i < 50; i++) {
+        src += "var<private> v" + std::to_string(i) + " : array<vec4<f32>, 4>;\n";
+    }
+    src += R"(
+var<private> m : vec2<vec2<f32>> = vec2(vec2(1.0));
+fn f(x : bool, y : bool) -> bool {
+  var a = 1;
+  a--;
+  let b = a--a;
+  **&&a = 2;
+  return x && y;
+}
+)";
+    auto p = parser(src);
+    ASSERT_TRUE(p->Parse()) << p->error();
+
+    Program program = p->program();
+    ASSERT_EQ(1u, program.AST().Functions().Length());
+    ASSERT_EQ(51u, program.AST().GlobalVariables().Length());
+}
+
 TEST_F(ParserImplTest, HandlesError) {
     auto p = parser(R"(
 fn main() ->  {  // missing return type
@@ -522,6 +522,184 @@ ConstEval::Result TransformBinaryElements(ProgramBuilder& builder,
     }
     return builder.create<constant::Composite>(composite_ty, std::move(els));
 }
+
+/// Component-wise addition, for use with TransformBinaryElementsBatched()
+struct BatchedAdd {
+    /// @returns `a + b`
+    template <typename T>
+    static T Apply(T a, T b) {
+        return a + b;
+    }
+    /// @returns `a + b`, or an empty optional if the result overflowed
+    static std::optional<AInt> Checked(AInt a, AInt b) { return CheckedAdd(a, b); }
+};
+
+/// Component-wise subtraction, for use with TransformBinaryElementsBatched()
+struct BatchedSub {
+    /// @returns `a - b`
+    template <typename T>
+    static T Apply(T a, T b) {
+        return a - b;
+    }
+    /// @returns `a - b`, or an empty optional if the result overflowed
+    static std::optional<AInt> Checked(AInt a, AInt b) { return CheckedSub(a, b); }
+};
+
+/// Component-wise multiplication, for use with TransformBinaryElementsBatched()
+struct BatchedMul {
+    /// @returns `a * b`
+    template <typename T>
+    static T Apply(T a, T b) {
+        return a * b;
+    }
+    /// @returns `a * b`, or an empty optional if the result overflowed
+    static std::optional<AInt> Checked(AInt a, AInt b) { return CheckedMul(a, b); }
+};
+
+/// Applies the operation `OP` to each pair of elements of @p lhs and @p rhs, writing the results
+/// to @p out. The loops have no early exit and no per-element dispatch, so that the compiler can
+/// vectorize them.
+/// @returns false if any of the results cannot be represented by `NumberT`
+template <typename OP, typename NumberT>
+bool BatchedBinaryOp(const NumberT* lhs, const NumberT* rhs, NumberT* out, size_t count) {
+    using T = UnwrapNumber<NumberT>;
+    if constexpr (std::is_same_v<NumberT, AInt>) {
+        bool ok = true;
+        for (size_t i = 0; i < count; i++) {
+            auto r = OP::Checked(lhs[i], rhs[i]);
+            ok &= r.has_value();
+            out[i] = r.value_or(AInt(0));
+        }
+        return ok;
+    } else if constexpr (IsFloatingPoint<NumberT>) {
+        // Constructing the NumberT quantizes f16 values.
+        bool ok = true;
+        for (size_t i = 0; i < count; i++) {
+            out[i] = NumberT{OP::Apply(lhs[i].value, rhs[i].value)};
+            ok &= std::isfinite(out[i].value);
+        }
+        return ok;
+    } else {
+        // Concrete integers wrap on overflow. Operate on unsigned values to avoid UB.
+        using UT = std::make_unsigned_t<T>;
+        for (size_t i = 0; i < count; i++) {
+            out[i] = NumberT{static_cast<T>(
+                OP::Apply(static_cast<UT>(lhs[i].value), static_cast<UT>(rhs[i].value)))};
+        }
+        return true;
+    }
+}
+
+/// Appends the most deeply nested elements of @p c to @p out, in the order they are visited by
+/// TransformBinaryElements().
+template <typename NumberT, size_t N>
+void GatherElements(const constant::Value* c, utils::Vector<NumberT, N>& out) {
+    uint32_t n = 0;
+    auto* el_ty = type::Type::ElementOf(c->Type(), &n);
+    if (el_ty == c->Type()) {
+        out.Push(c->ValueAs<NumberT>());
+        return;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        GatherElements(c->Index(i), out);
+    }
+}
+
+/// Builds a constant of type @p ty from the most deeply nested elements that start at @p next, in
+/// the order they are visited by TransformBinaryElements(). @p next is advanced past the consumed
+/// elements.
+template <typename NumberT>
+const constant::Value* BuildElements(ProgramBuilder& builder,
+                                     const type::Type* ty,
+                                     const NumberT*& next) {
+    uint32_t n = 0;
+    auto* el_ty = type::Type::ElementOf(ty, &n);
+    if (el_ty == ty) {
+        return builder.create<constant::Scalar<NumberT>>(ty, *(next++));
+    }
+    utils::Vector<const constant::Value*, 8> els;
+    els.Reserve(n);
+    for (uint32_t i = 0; i < n; i++) {
+        els.Push(BuildElements(builder, el_ty, next));
+    }
+    return builder.create<constant::Composite>(ty, std::move(els));
+}
+
+/// Implementation of TransformBinaryElementsBatched for elements of type `NumberT`
+template <typename OP, typename NumberT>
+const constant::Value* TransformBinaryElementsBatched(ProgramBuilder& builder,
+                                                      const type::Type* composite_ty,
+                                                      size_t count,
+                                                      const constant::Value* c0,
+                                                      const constant::Value* c1) {
+    utils::Vector<NumberT, 16> lhs;
+    utils::Vector<NumberT, 16> rhs;
+    lhs.Reserve(count);
+    rhs.Reserve(count);
+    GatherElements(c0, lhs);
+    GatherElements(c1, rhs);
+    // A scalar operand is applied to all the elements of the other operand.
+    if (lhs.Length() == 1) {
+        NumberT scalar = lhs[0];
+        lhs.Resize(count, scalar);
+    }
+    if (rhs.Length() == 1) {
+        NumberT scalar = rhs[0];
+        rhs.Resize(count, scalar);
+    }
+    if (TINT_UNLIKELY(lhs.Length() != count || rhs.Length() != count)) {
+        return nullptr;
+    }
+
+    utils::Vector<NumberT, 16> results;
+    results.Resize(count);
+    if (!BatchedBinaryOp<OP>(&lhs[0], &rhs[0], &results[0], count)) {
+        return nullptr;
+    }
+    const NumberT* next = &results[0];
+    return BuildElements(builder, composite_ty, next);
+}
+
+/// TransformBinaryElementsBatched is a fast path for TransformBinaryElements(), for the
+/// component-wise arithmetic operation `OP` on numeric vectors or matrices, or a vector or matrix
+/// and a scalar. Rather than dispatching on the type of each element, the elements of both
+/// operands are gathered into contiguous buffers of their C++ number type, and the operation is
+/// applied to all of them in a single loop.
+/// @returns the resulting constant, or nullptr if the operation isn't on vectors or matrices of the
+/// same numeric element type, or if any of the results cannot be represented. In that case, the
+/// caller must fall back to TransformBinaryElements(), which also raises the errors.
+template <typename OP>
+const constant::Value* TransformBinaryElementsBatched(ProgramBuilder& builder,
+                                                      const type::Type* composite_ty,
+                                                      const constant::Value* c0,
+                                                      const constant::Value* c1) {
+    uint32_t count = 0;
+    auto* el_ty = type::Type::DeepestElementOf(composite_ty, &count);
+    if (count <= 1 || type::Type::DeepestElementOf(c0->Type()) != el_ty ||
+        type::Type::DeepestElementOf(c1->Type()) != el_ty) {
+        return nullptr;
+    }
+    return Switch(
+        el_ty,  //
+        [&](const type::AbstractInt*) {
+            return TransformBinaryElementsBatched<OP, AInt>(builder, composite_ty, count, c0, c1);
+        },
+        [&](const type::AbstractFloat*) {
+            return TransformBinaryElementsBatched<OP, AFloat>(builder, composite_ty, count, c0, c1);
+        },
+        [&](const type::F32*) {
+            return TransformBinaryElementsBatched<OP, f32>(builder, composite_ty, count, c0, c1);
+        },
+        [&](const type::F16*) {
+            return TransformBinaryElementsBatched<OP, f16>(builder, composite_ty, count, c0, c1);
+        },
+        [&](const type::I32*) {
+            return TransformBinaryElementsBatched<OP, i32>(builder, composite_ty, count, c0, c1);
+        },
+        [&](const type::U32*) {
+            return TransformBinaryElementsBatched<OP, u32>(builder, composite_ty, count, c0, c1);
+        });
+}
 }  // namespace
 
 ConstEval::ConstEval(ProgramBuilder& b, bool use_runtime_semantics /* = false */)
@@ -1174,6 +1352,9 @@ ConstEval::Result ConstEval::Mul(const Source& source,
                                  const type::Type* ty,
                                  const constant::Value* v1,
                                  const constant::Value* v2) {
+    if (auto* batched = TransformBinaryElementsBatched<BatchedMul>(builder, ty, v1, v2)) {
+        return batched;
+    }
     auto transform = [&](const constant::Value* c0, const constant::Value* c1) {
         return Dispatch_fia_fiu32_f16(MulFunc(source, c0->Type()), c0, c1);
     };
@@ -1184,6 +1365,9 @@ ConstEval::Result ConstEval::Sub(const Source& source,
                                  const type::Type* ty,
                                  const constant::Value* v1,
                                  const constant::Value* v2) {
+    if (auto* batched = TransformBinaryElementsBatched<BatchedSub>(builder, ty, v1, v2)) {
+        return batched;
+    }
     auto transform = [&](const constant::Value* c0, const constant::Value* c1) {
         return Dispatch_fia_fiu32_f16(SubFunc(source, c0->Type()), c0, c1);
     };
@@ -1490,6 +1674,9 @@ ConstEval::Result ConstEval::OpNot(const type::Type* ty,
 ConstEval::Result ConstEval::OpPlus(const type::Type* ty,
                                     utils::VectorRef<const constant::Value*> args,
                                     const Source& source) {
+    if (auto* batched = TransformBinaryElementsBatched<BatchedAdd>(builder, ty, args[0], args[1])) {
+        return batched;
+    }
     auto transform = [&](const constant::Value* c0, const constant::Value* c1) {
         return Dispatch_fia_fiu32_f16(AddFunc(source, c0->Type()), c0, c1);
     };
@@ -165,6 +165,47 @@ std::vector<Case> OpAddFloatCases() {
         E(T::Lowest(), Negate(T::Highest()), error_msg(T::Lowest(), Negate(T::Highest()))),
     };
 }
+template <typename T>
+std::vector<Case> OpAddVecCases() {
+    auto r = std::vector<Case>{
+        // s + vec3 = vec3
+        C(Val(T{2}), Vec(T{1}, T{2}, T{3}), Vec(T{3}, T{4}, T{5})),
+        // vec3 + s = vec3
+        C(Vec(T{1}, T{2}, T{3}), Val(T{2}), Vec(T{3}, T{4}, T{5})),
+        // vec4 + vec4 = vec4
+        C(Vec(T{1}, T{2}, T{3}, T{4}), Vec(T{4}, T{3}, T{2}, T{1}), Vec(T{5}, T{5}, T{5}, T{5})),
+    };
+    if constexpr (IsAbstract<T> || IsFloatingPoint<T>) {
+        auto error_msg = [](auto a, auto b) {
+            return "12:34 error: " + OverflowErrorMessage(a, "+", b);
+        };
+        ConcatInto(  //
+            r, std::vector<Case>{
+                   // The error is raised for the first element that overflows
+                   E(Vec(T{1}, T::Highest(), T::Lowest()), Vec(T{1}, T::Highest(), T::Lowest()),
+                     error_msg(T::Highest(), T::Highest())),
+                   E(Val(T::Lowest()), Vec(T{1}, T::Lowest()), error_msg(T::Lowest(), T::Lowest())),
+               });
+    } else {
+        ConcatInto(  //
+            r, std::vector<Case>{
+                   C(Vec(T::Highest(), T{1}), Vec(T{1}, T{1}), Vec(T::Lowest(), T{2})),
+               });
+    }
+    if constexpr (IsFloatingPoint<T>) {
+        ConcatInto(  //
+            r, std::vector<Case>{
+                   // mat2x3 + mat2x3 = mat2x3
+                   C(Mat({T{1.0}, T{2.0}, T{3.0}},   //
+                         {T{4.0}, T{5.0}, T{6.0}}),  //
+                     Mat({T{0.5}, T{0.5}, T{0.5}},   //
+                         {T{1.0}, T{1.0}, T{1.0}}),  //
+                     Mat({T{1.5}, T{2.5}, T{3.5}},   //
+                         {T{5.0}, T{6.0}, T{7.0}})),
+               });
+    }
+    return r;
+}
 INSTANTIATE_TEST_SUITE_P(Add,
                          ResolverConstEvalBinaryOpTest,
                          testing::Combine(testing::Values(ast::BinaryOp::kAdd),
@@ -174,7 +215,13 @@ INSTANTIATE_TEST_SUITE_P(Add,
                                               OpAddIntCases<u32>(),
                                               OpAddFloatCases<AFloat>(),
                                               OpAddFloatCases<f32>(),
-                                              OpAddFloatCases<f16>()))));
+                                              OpAddFloatCases<f16>(),
+                                              OpAddVecCases<AInt>(),
+                                              OpAddVecCases<i32>(),
+                                              OpAddVecCases<u32>(),
+                                              OpAddVecCases<AFloat>(),
+                                              OpAddVecCases<f32>(),
+                                              OpAddVecCases<f16>()))));
 
 template <typename T>
 std::vector<Case> OpSubIntCases() {
@@ -221,6 +268,34 @@ std::vector<Case> OpSubFloatCases() {
         E(T::Lowest(), T::Highest(), error_msg(T::Lowest(), T::Highest())),
     };
 }
+template <typename T>
+std::vector<Case> OpSubVecCases() {
+    auto r = std::vector<Case>{
+        // s - vec3 = vec3
+        C(Val(T{5}), Vec(T{1}, T{2}, T{3}), Vec(T{4}, T{3}, T{2})),
+        // vec3 - s = vec3
+        C(Vec(T{3}, T{4}, T{5}), Val(T{2}), Vec(T{1}, T{2}, T{3})),
+        // vec4 - vec4 = vec4
+        C(Vec(T{5}, T{5}, T{5}, T{5}), Vec(T{4}, T{3}, T{2}, T{1}), Vec(T{1}, T{2}, T{3}, T{4})),
+    };
+    if constexpr (IsAbstract<T> || IsFloatingPoint<T>) {
+        auto error_msg = [](auto a, auto b) {
+            return "12:34 error: " + OverflowErrorMessage(a, "-", b);
+        };
+        ConcatInto(  //
+            r, std::vector<Case>{
+                   // The error is raised for the first element that overflows
+                   E(Vec(T{1}, T::Lowest(), T::Highest()), Vec(T{1}, T::Highest(), T::Lowest()),
+                     error_msg(T::Lowest(), T::Highest())),
+               });
+    } else {
+        ConcatInto(  //
+            r, std::vector<Case>{
+                   C(Vec(T::Lowest(), T{3}), Vec(T{1}, T{1}), Vec(T::Highest(), T{2})),
+               });
+    }
+    return r;
+}
 INSTANTIATE_TEST_SUITE_P(Sub,
                          ResolverConstEvalBinaryOpTest,
                          testing::Combine(testing::Values(ast::BinaryOp::kSubtract),
@@ -230,7 +305,13 @@ INSTANTIATE_TEST_SUITE_P(Sub,
                                               OpSubIntCases<u32>(),
                                               OpSubFloatCases<AFloat>(),
                                               OpSubFloatCases<f32>(),
-                                              OpSubFloatCases<f16>()))));
+                                              OpSubFloatCases<f16>(),
+                                              OpSubVecCases<AInt>(),
+                                              OpSubVecCases<i32>(),
+                                              OpSubVecCases<u32>(),
+                                              OpSubVecCases<AFloat>(),
+                                              OpSubVecCases<f32>(),
+                                              OpSubVecCases<f16>()))));
 
 template <typename T>
 std::vector<Case> OpMulScalarCases() {
@@ -284,6 +365,8 @@ std::vector<Case> OpMulVecCases() {
                 // Fail if result is +/-inf
                 E(Val(T::Highest()), Vec(T{2}, T{1}), error_msg(T::Highest(), T{2})),
                 E(Val(T::Lowest()), Vec(Negate(T{2}), T{1}), error_msg(T::Lowest(), Negate(T{2}))),
+                // The error is raised for the first element that overflows
+                E(Vec(T{1}, T{2}, T::Highest()), Val(T{2}), error_msg(T::Highest(), T{2})),
             });
     } else {
         ConcatInto(  //
@@ -950,6 +950,30 @@ bool operator==(const IntrinsicPrototype& a, const IntrinsicPrototype& b) {
     return true;
 }
 
+/// IntrinsicMatchKey holds the inputs of an intrinsic overload resolution, which fully determine
+/// its result.
+struct IntrinsicMatchKey {
+    /// Hasher provides a hash function for the IntrinsicMatchKey
+    struct Hasher {
+        /// @param k the IntrinsicMatchKey to create a hash for
+        /// @return the hash value
+        inline std::size_t operator()(const IntrinsicMatchKey& k) const {
+            return utils::Hash(k.intrinsic, k.template_type, k.earliest_eval_stage, k.args);
+        }
+    };
+
+    const IntrinsicInfo* intrinsic = nullptr;
+    type::Type const* template_type = nullptr;
+    sem::EvaluationStage earliest_eval_stage = sem::EvaluationStage::kRuntime;
+    utils::Vector<const type::Type*, kNumFixedParams> args;
+};
+
+/// Equality operator for IntrinsicMatchKey
+bool operator==(const IntrinsicMatchKey& a, const IntrinsicMatchKey& b) {
+    return a.intrinsic == b.intrinsic && a.template_type == b.template_type &&
+           a.earliest_eval_stage == b.earliest_eval_stage && a.args == b.args;
+}
+
 /// Impl is the private implementation of the IntrinsicTable interface.
 class Impl : public IntrinsicTable {
   public:
@@ -1018,12 +1042,23 @@ class Impl : public IntrinsicTable {
     /// @returns the matched intrinsic. If no intrinsic could be matched then IntrinsicPrototype
     ///          will hold nullptrs for IntrinsicPrototype::overload and
     ///          IntrinsicPrototype::return_type.
+    /// @note successful matches are memoized, so that repeated lookups with the same inputs do
+    ///       not score the overloads again. Failed matches always go through the diagnostic path.
     IntrinsicPrototype MatchIntrinsic(const IntrinsicInfo& intrinsic,
                                       const char* intrinsic_name,
                                       utils::VectorRef<const type::Type*> args,
                                       sem::EvaluationStage earliest_eval_stage,
                                       TemplateState templates,
-                                      const OnNoMatch& on_no_match) const;
+                                      const OnNoMatch& on_no_match);
+
+    /// Scores all the overloads of the intrinsic and resolves the best one, without memoization.
+    /// @see MatchIntrinsic
+    IntrinsicPrototype MatchIntrinsicUncached(const IntrinsicInfo& intrinsic,
+                                              const char* intrinsic_name,
+                                              utils::VectorRef<const type::Type*> args,
+                                              sem::EvaluationStage earliest_eval_stage,
+                                              TemplateState templates,
+                                              const OnNoMatch& on_no_match) const;
 
     /// Evaluates the single overload for the provided argument types.
     /// @param overload the overload being considered
@@ -1079,6 +1114,7 @@ class Impl : public IntrinsicTable {
 
     ProgramBuilder& builder;
     Matchers matchers;
+    utils::Hashmap<IntrinsicMatchKey, IntrinsicPrototype, 64, IntrinsicMatchKey::Hasher> matches;
     utils::Hashmap<IntrinsicPrototype, sem::Builtin*, 64, IntrinsicPrototype::Hasher> builtins;
     utils::Hashmap<IntrinsicPrototype, sem::ValueConstructor*, 16, IntrinsicPrototype::Hasher>
         constructors;
@@ -1386,7 +1422,29 @@ IntrinsicPrototype Impl::MatchIntrinsic(const IntrinsicInfo& intrinsic,
                                         utils::VectorRef<const type::Type*> args,
                                         sem::EvaluationStage earliest_eval_stage,
                                         TemplateState templates,
-                                        const OnNoMatch& on_no_match) const {
+                                        const OnNoMatch& on_no_match) {
+    // The only template argument that can be explicitly specified is the type of value
+    // constructors, e.g. `vec3<f32>()`.
+    TINT_ASSERT(Resolver, templates.Count() <= 1);
+    IntrinsicMatchKey key{&intrinsic, templates.Type(0), earliest_eval_stage, args};
+    if (auto cached = matches.Find(key)) {
+        return *cached;
+    }
+
+    auto match = MatchIntrinsicUncached(intrinsic, intrinsic_name, args, earliest_eval_stage,
+                                        std::move(templates), on_no_match);
+    if (match.overload) {
+        matches.Add(std::move(key), match);
+    }
+    return match;
+}
+
+IntrinsicPrototype Impl::MatchIntrinsicUncached(const IntrinsicInfo& intrinsic,
+                                                const char* intrinsic_name,
+                                                utils::VectorRef<const type::Type*> args,
+                                                sem::EvaluationStage earliest_eval_stage,
+                                                TemplateState templates,
+                                                const OnNoMatch& on_no_match) const {
     size_t num_matched = 0;
     size_t match_idx = 0;
     utils::Vector<Candidate, kNumFixedCandidates> candidates;
@@ -768,6 +768,56 @@ TEST_F(IntrinsicTableTest, MismatchBinaryOp) {
 )");
 }
 
+TEST_F(IntrinsicTableTest, MatchRepeatedBinaryOp) {
+    auto* i32 = create<type::I32>();
+    auto* f32 = create<type::F32>();
+    auto* vec3_f32 = create<type::Vector>(f32, 3u);
+    auto first = table->Lookup(ast::BinaryOp::kMultiply, f32, vec3_f32,
+                               sem::EvaluationStage::kConstant, Source{}, false);
+    auto second = table->Lookup(ast::BinaryOp::kMultiply, f32, vec3_f32,
+                                sem::EvaluationStage::kConstant, Source{}, false);
+    EXPECT_EQ(second.result, first.result);
+    EXPECT_EQ(second.lhs, first.lhs);
+    EXPECT_EQ(second.rhs, first.rhs);
+    EXPECT_EQ(second.const_eval_fn, first.const_eval_fn);
+
+    // A lookup of the same operator with other argument types doesn't use the first match.
+    auto other = table->Lookup(ast::BinaryOp::kMultiply, i32, i32, sem::EvaluationStage::kConstant,
+                               Source{}, false);
+    EXPECT_EQ(other.result, i32);
+    EXPECT_EQ(Diagnostics().str(), "");
+}
+
+TEST_F(IntrinsicTableTest, MismatchRepeatedBinaryOp) {
+    auto* f32 = create<type::F32>();
+    auto* bool_ = create<type::Bool>();
+    for (int i = 0; i < 2; i++) {
+        auto result = table->Lookup(ast::BinaryOp::kMultiply, f32, bool_,
+                                    sem::EvaluationStage::kConstant, Source{{12, 34}}, false);
+        ASSERT_EQ(result.result, nullptr);
+    }
+    // Failed lookups aren't memoized so each of them raises an error.
+    EXPECT_EQ(Diagnostics().error_count(), 2u);
+}
+
+TEST_F(IntrinsicTableTest, MatchRepeatedTypeConversion) {
+    auto* i32 = create<type::I32>();
+    auto* u32 = create<type::U32>();
+    auto* f32 = create<type::F32>();
+    auto* vec3_f32 = create<type::Vector>(f32, 3u);
+    auto to_i32 = table->Lookup(CtorConvIntrinsic::kVec3, i32, utils::Vector{vec3_f32},
+                                sem::EvaluationStage::kConstant, Source{});
+    auto to_u32 = table->Lookup(CtorConvIntrinsic::kVec3, u32, utils::Vector{vec3_f32},
+                                sem::EvaluationStage::kConstant, Source{});
+    auto to_i32_again = table->Lookup(CtorConvIntrinsic::kVec3, i32, utils::Vector{vec3_f32},
+                                      sem::EvaluationStage::kConstant, Source{});
+    ASSERT_NE(to_i32.target, nullptr);
+    ASSERT_NE(to_u32.target, nullptr);
+    EXPECT_EQ(to_i32.target->ReturnType(), create<type::Vector>(i32, 3u));
+    EXPECT_EQ(to_u32.target->ReturnType(), create<type::Vector>(u32, 3u));
+    EXPECT_EQ(to_i32_again.target, to_i32.target);
+}
+
 TEST_F(IntrinsicTableTest, MatchCompoundOp) {
     auto* i32 = create<type::I32>();
     auto* vec3_i32 = create<type::Vector>(i32, 3u);
@@ -0,0 +1,133 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+
+#include "src/tint/bench/benchmark.h"
+#include "src/tint/reader/wgsl/parser_impl.h"
+#include "src/tint/resolver/resolver.h"
+
+namespace tint::resolver {
+namespace {
+
+/// Resolves the WGSL source @p file once per benchmark iteration.
+/// Parsing of the source is excluded from the measured time.
+/// The number of constant nodes created for the module is reported in the `constants` counter.
+void Resolve(benchmark::State& state, const Source::File& file) {
+    std::unique_ptr<reader::wgsl::ParserImpl> parser;
+    for (auto _ : state) {
+        state.PauseTiming();
+        parser = std::make_unique<reader::wgsl::ParserImpl>(&file);
+        parser->Parse();
+        if (parser->has_error()) {
+            state.SkipWithError(parser->error().c_str());
+            return;
+        }
+        state.ResumeTiming();
+
+        Resolver resolver(&parser->builder());
+        if (!resolver.Resolve()) {
+            state.SkipWithError(resolver.error().c_str());
+            return;
+        }
+    }
+    if (parser) {
+        state.counters["constants"] =
+            static_cast<double>(parser->builder().ConstantNodes().Count());
+    }
+}
+
+void ResolveWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    Resolve(state, std::get<Source::File>(res));
+}
+
+TINT_BENCHMARK_PROGRAMS(ResolveWGSL);
+
+/// Resolves a synthetic module of `state.range(0)` helper functions, where each function calls
+/// the two functions declared before it.
+void ResolveManyFunctions(benchmark::State& state) {
+    const auto num_functions = static_cast<size_t>(state.range(0));
+
+    std::string wgsl = "fn fn_0(a : vec4<f32>, b : f32) -> vec4<f32> { return a * b; }\n";
+    wgsl += "fn fn_1(a : vec4<f32>, b : f32) -> vec4<f32> { return a + b; }\n";
+    for (size_t i = 2; i < num_functions; i++) {
+        auto fn = "fn_" + std::to_string(i);
+        auto prev1 = "fn_" + std::to_string(i - 1);
+        auto prev2 = "fn_" + std::to_string(i - 2);
+        wgsl += "fn " + fn + "(a : vec4<f32>, b : f32) -> vec4<f32> {\n";
+        wgsl += "  var v = " + prev1 + "(a, b + 1.0);\n";
+        wgsl += "  if (v.x > b) {\n";
+        wgsl += "    v = " + prev2 + "(v, clamp(b, 0.0, 1.0));\n";
+        wgsl += "  }\n";
+        wgsl += "  return normalize(v) * dot(a, v);\n";
+        wgsl += "}\n";
+    }
+    wgsl += "@fragment fn main(@location(0) a : vec4<f32>) -> @location(0) vec4<f32> {\n";
+    wgsl += "  return fn_" + std::to_string(num_functions - 1) + "(a, 0.5);\n";
+    wgsl += "}\n";
+
+    Source::File file("many-functions.wgsl", wgsl);
+    Resolve(state, file);
+
+    state.counters["functions"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * num_functions), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(ResolveManyFunctions)->Arg(50)->Arg(500);
+
+/// Resolves a synthetic function of `state.range(0)` statements, each made of builtin calls and
+/// binary operators over the same few argument types. This stresses intrinsic overload resolution.
+void ResolveManyOperators(benchmark::State& state) {
+    const auto num_statements = static_cast<size_t>(state.range(0));
+
+    std::string wgsl = "fn f(a : vec4<f32>, b : vec4<f32>, s : f32, i : i32) -> vec4<f32> {\n";
+    wgsl += "  var v = a;\n";
+    wgsl += "  var x = s;\n";
+    wgsl += "  var n = i;\n";
+    for (size_t i = 0; i < num_statements; i++) {
+        switch (i % 4) {
+            case 0:
+                wgsl += "  v = mix(v, b * x, 0.5) + a * dot(v, b);\n";
+                break;
+            case 1:
+                wgsl += "  x = x * dot(a, v) + clamp(x, 0.0, 1.0) - s / 2.0;\n";
+                break;
+            case 2:
+                wgsl += "  n = (n + i * 3) % 7 - min(n, i);\n";
+                break;
+            case 3:
+                wgsl += "  v = max(v * x - b, -a) + vec4<f32>(f32(n), x, 1.0, s);\n";
+                break;
+        }
+    }
+    wgsl += "  return v;\n";
+    wgsl += "}\n";
+
+    Source::File file("many-operators.wgsl", wgsl);
+    Resolve(state, file);
+
+    state.counters["statements"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * num_statements), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(ResolveManyOperators)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace tint::resolver
@@ -42,7 +42,6 @@
 #include "src/tint/utils/defer.h"
 #include "src/tint/utils/map.h"
 #include "src/tint/utils/string_stream.h"
-#include "src/tint/utils/unique_vector.h"
 
 // Set to `1` to dump the uniformity graph for each function in graphviz format.
 #define TINT_DUMP_UNIFORMITY_GRAPH 0
@@ -131,17 +130,19 @@ struct Node {
     /// The function call argument index, if applicable.
     uint32_t arg_index = 0xffffffffu;
 
-    /// The set of edges from this node to other nodes in the graph.
-    utils::UniqueVector<Node*, 4> edges;
+    /// The index of this node in the graph of its function.
+    uint32_t index = 0;
 
-    /// The node that this node was visited from, or nullptr if not visited.
-    Node* visited_from = nullptr;
+    /// The edges from this node to other nodes in the graph, in the order they were added.
+    /// This may contain duplicates. Once the graph is finalized, the edges are traversed through
+    /// FunctionInfo::EdgesOf() instead.
+    utils::Vector<Node*, 4> edges;
 
     /// Add an edge to the `to` node.
     /// @param to the destination node
     void AddEdge(Node* to) {
         TINT_ASSERT(Resolver, to != nullptr);
-        edges.Add(to);
+        edges.Push(to);
     }
 };
 
@@ -229,6 +230,9 @@ struct FunctionInfo {
     /// The control flow graph.
     utils::BlockAllocator<Node> nodes;
 
+    /// The nodes of the graph, by index.
+    utils::Vector<Node*, 32> node_list;
+
     /// Special `RequiredToBeUniform` nodes.
     Node* required_to_be_uniform_error = nullptr;
     Node* required_to_be_uniform_warning = nullptr;
@@ -295,6 +299,8 @@ struct FunctionInfo {
     Node* CreateNode([[maybe_unused]] std::initializer_list<std::string_view> tag_list,
                      const ast::Node* ast = nullptr) {
         auto* node = nodes.Create(ast);
+        node->index = static_cast<uint32_t>(node_list.Length());
+        node_list.Push(node);
 
 #if TINT_DUMP_UNIFORMITY_GRAPH
         // Make the tag unique and set it.
@@ -315,14 +321,119 @@ struct FunctionInfo {
         return node;
     }
 
+    /// Finalize the graph once all of its nodes and edges have been added, by flattening the edges
+    /// into a compressed sparse row layout with duplicate edges removed.
+    void Finalize() {
+        auto count = static_cast<uint32_t>(node_list.Length());
+        size_t edge_count = 0;
+        for (auto* node : node_list) {
+            edge_count += node->edges.Length();
+        }
+
+        // last_source[i] is the index of the last node that was given an edge to node `i`.
+        utils::Vector<uint32_t, 32> last_source;
+        last_source.Resize(count, kNoNode);
+        edge_offsets.Resize(count + 1);
+        edge_targets.Reserve(edge_count);
+        for (uint32_t i = 0; i < count; i++) {
+            edge_offsets[i] = static_cast<uint32_t>(edge_targets.Length());
+            for (auto* to : node_list[i]->edges) {
+                if (last_source[to->index] != i) {
+                    last_source[to->index] = i;
+                    edge_targets.Push(to->index);
+                }
+            }
+        }
+        edge_offsets[count] = static_cast<uint32_t>(edge_targets.Length());
+
+        visit_states.Resize(count);
+        generation = 1;
+    }
+
+    /// @param node a node in the finalized graph
+    /// @returns the indices of the nodes that @p node has edges to
+    utils::Slice<const uint32_t> EdgesOf(const Node* node) const {
+        auto begin = edge_offsets[node->index];
+        auto end = edge_offsets[node->index + 1];
+        return {edge_targets.begin() + begin, end - begin, end - begin};
+    }
+
     /// Reset the visited status of every node in the graph.
     void ResetVisited() {
-        for (auto* node : nodes.Objects()) {
-            node->visited_from = nullptr;
+        if (++generation == 0) {
+            // The generation counter wrapped, so the old marks could alias the new generation.
+            for (auto& state : visit_states) {
+                state = {};
+            }
+            generation = 1;
+        }
+    }
+
+    /// Traverse the graph starting at `source`, marking all visited nodes as reached and recording
+    /// which node they were reached from. The nodes reached by earlier traversals remain marked
+    /// until ResetVisited() is called.
+    /// @param source the starting node
+    void Traverse(const Node* source) {
+        utils::Vector<uint32_t, 8> to_visit{source->index};
+
+        while (!to_visit.IsEmpty()) {
+            auto node = to_visit.Back();
+            to_visit.Pop();
+
+            visit_states[node].reached = generation;
+            for (uint32_t i = edge_offsets[node], end = edge_offsets[node + 1]; i < end; i++) {
+                auto& to = visit_states[edge_targets[i]];
+                if (to.visited != generation) {
+                    to.visited = generation;
+                    to.visited_from = node;
+                    to_visit.Push(edge_targets[i]);
+                }
+            }
         }
     }
 
+    /// @param node the node to check
+    /// @returns true if @p node was reached by a traversal since the last ResetVisited()
+    bool Reached(const Node* node) const {
+        return visit_states[node->index].reached == generation;
+    }
+
+    /// @param node the node to check
+    /// @returns the node that @p node was visited from, or nullptr if @p node was not visited
+    /// through an edge since the last ResetVisited()
+    Node* VisitedFrom(const Node* node) const {
+        auto& state = visit_states[node->index];
+        return state.visited == generation ? node_list[state.visited_from] : nullptr;
+    }
+
   private:
+    /// The index used for "no node".
+    static constexpr uint32_t kNoNode = 0xffffffffu;
+
+    /// VisitState is the traversal state of a node. A node is only considered reached or visited if
+    /// the corresponding generation matches the current generation, so that ResetVisited() does not
+    /// need to touch every node.
+    struct VisitState {
+        /// The generation in which the node was reached by a traversal.
+        uint32_t reached = 0;
+        /// The generation in which the node was visited through an edge.
+        uint32_t visited = 0;
+        /// The index of the node that this node was visited from.
+        uint32_t visited_from = kNoNode;
+    };
+
+    /// The edges of node `i` are the node indices in `edge_targets`, from `edge_offsets[i]` up to
+    /// `edge_offsets[i + 1]`.
+    utils::Vector<uint32_t, 32> edge_offsets;
+    /// The node indices of the edges of all nodes.
+    utils::Vector<uint32_t, 64> edge_targets;
+
+    /// The traversal state of each node, by index.
+    utils::Vector<VisitState, 32> visit_states;
+
+    /// The current traversal generation.
+    uint32_t generation = 0;
+
     /// A list of tags that have already been used within the current function.
     utils::Hashset<std::string, 8> tags_;
 
@@ -424,33 +535,35 @@ class UniformityGraph {
         if (func->body) {
             ProcessStatement(current_function_->cf_start, func->body);
         }
+        current_function_->Finalize();
 
 #if TINT_DUMP_UNIFORMITY_GRAPH
         // Dump the graph for this function as a subgraph.
         std::cout << "\nsubgraph cluster_" << current_function_->name << " {\n";
         std::cout << "  label=" << current_function_->name << ";";
-        for (auto* node : current_function_->nodes.Objects()) {
+        for (auto* node : current_function_->node_list) {
             std::cout << "\n  \"" << node->tag << "\";";
-            for (auto* edge : node->edges) {
-                std::cout << "\n  \"" << node->tag << "\" -> \"" << edge->tag << "\";";
+            for (auto edge : current_function_->EdgesOf(node)) {
+                std::cout << "\n  \"" << node->tag << "\" -> \""
+                          << current_function_->node_list[edge]->tag << "\";";
             }
         }
         std::cout << "\n}\n";
 #endif
 
         /// Helper to generate a tag for the uniformity requirements of the parameter at `index`.
-        auto get_param_tag = [&](utils::UniqueVector<Node*, 4>& reachable, size_t index) {
+        auto get_param_tag = [&](size_t index) {
             auto* param = sem_.Get(func->params[index]);
             auto& param_info = current_function_->parameters[index];
             if (param->Type()->Is<type::Pointer>()) {
                 // For pointers, we distinguish between requiring uniformity of the contents versus
                 // the pointer itself.
-                if (reachable.Contains(param_info.ptr_input_contents)) {
+                if (current_function_->Reached(param_info.ptr_input_contents)) {
                     return ParameterTag::ParameterContentsRequiredToBeUniform;
-                } else if (reachable.Contains(param_info.value)) {
+                } else if (current_function_->Reached(param_info.value)) {
                     return ParameterTag::ParameterValueRequiredToBeUniform;
                 }
-            } else if (reachable.Contains(current_function_->variables.Get(param))) {
+            } else if (current_function_->Reached(current_function_->variables.Get(param))) {
                 // For non-pointers, the requirement is always on the value.
                 return ParameterTag::ParameterValueRequiredToBeUniform;
             }
@@ -459,14 +572,13 @@ class UniformityGraph {
 
         // Look at which nodes are reachable from "RequiredToBeUniform".
         {
-            utils::UniqueVector<Node*, 4> reachable;
             auto traverse = [&](builtin::DiagnosticSeverity severity) {
-                Traverse(current_function_->RequiredToBeUniform(severity), &reachable);
-                if (reachable.Contains(current_function_->may_be_non_uniform)) {
+                current_function_->Traverse(current_function_->RequiredToBeUniform(severity));
+                if (current_function_->Reached(current_function_->may_be_non_uniform)) {
                     MakeError(*current_function_, current_function_->may_be_non_uniform, severity);
                     return false;
                 }
-                if (reachable.Contains(current_function_->cf_start)) {
+                if (current_function_->Reached(current_function_->cf_start)) {
                     if (current_function_->callsite_tag.tag == CallSiteTag::CallSiteNoRestriction) {
                         current_function_->callsite_tag = {CallSiteTag::CallSiteRequiredToBeUniform,
                                                            severity};
@@ -477,8 +589,7 @@ class UniformityGraph {
                 for (size_t i = 0; i < func->params.Length(); i++) {
                     if (current_function_->parameters[i].tag_direct.tag ==
                         ParameterTag::ParameterNoRestriction) {
-                        current_function_->parameters[i].tag_direct = {get_param_tag(reachable, i),
-                                                                       severity};
+                        current_function_->parameters[i].tag_direct = {get_param_tag(i), severity};
                     }
                 }
                 return true;
@@ -495,17 +606,15 @@ class UniformityGraph {
         // If "Value_return" exists, look at which nodes are reachable from it.
         if (current_function_->value_return) {
             current_function_->ResetVisited();
-
-            utils::UniqueVector<Node*, 4> reachable;
-            Traverse(current_function_->value_return, &reachable);
-            if (reachable.Contains(current_function_->may_be_non_uniform)) {
+            current_function_->Traverse(current_function_->value_return);
+            if (current_function_->Reached(current_function_->may_be_non_uniform)) {
                 current_function_->function_tag = ReturnValueMayBeNonUniform;
             }
 
             // Set the tags to capture the uniformity requirements of each parameter with respect to
             // the function return value.
             for (size_t i = 0; i < func->params.Length(); i++) {
-                current_function_->parameters[i].tag_retval = {get_param_tag(reachable, i)};
+                current_function_->parameters[i].tag_retval = {get_param_tag(i)};
             }
         }
 
@@ -518,10 +627,8 @@ class UniformityGraph {
 
             // Reset "visited" state for all nodes.
             current_function_->ResetVisited();
-
-            utils::UniqueVector<Node*, 4> reachable;
-            Traverse(param_info.ptr_output_contents, &reachable);
-            if (reachable.Contains(current_function_->may_be_non_uniform)) {
+            current_function_->Traverse(param_info.ptr_output_contents);
+            if (current_function_->Reached(current_function_->may_be_non_uniform)) {
                 param_info.pointer_may_become_non_uniform = true;
             }
 
@@ -529,7 +636,7 @@ class UniformityGraph {
             // This includes checking this parameter (as it may feed into its own output value), so
             // we do not skip the `i==j` case.
             for (size_t j = 0; j < func->params.Length(); j++) {
-                auto tag = get_param_tag(reachable, j);
+                auto tag = get_param_tag(j);
                 auto* source_param = sem_.Get<sem::Parameter>(func->params[j]);
                 if (tag == ParameterTag::ParameterContentsRequiredToBeUniform) {
                     param_info.ptr_output_source_param_contents.Push(source_param);
@@ -1688,41 +1795,19 @@ class UniformityGraph {
         return {cf_after, result};
     }
 
-    /// Traverse a graph starting at `source`, inserting all visited nodes into `reachable` and
-    /// recording which node they were reached from.
-    /// @param source the starting node
-    /// @param reachable the set of reachable nodes to populate, if required
-    void Traverse(Node* source, utils::UniqueVector<Node*, 4>* reachable = nullptr) {
-        utils::Vector<Node*, 8> to_visit{source};
-
-        while (!to_visit.IsEmpty()) {
-            auto* node = to_visit.Back();
-            to_visit.Pop();
-
-            if (reachable) {
-                reachable->Add(node);
-            }
-            for (auto* to : node->edges) {
-                if (to->visited_from == nullptr) {
-                    to->visited_from = node;
-                    to_visit.Push(to);
-                }
-            }
-        }
-    }
-
     /// Trace back along a path from `start` until finding a node that matches a predicate.
+    /// @param function the function that holds the graph that was traversed
     /// @param start the starting node
     /// @param pred the predicate function
     /// @returns the first node found that matches the predicate, or nullptr
     template <typename F>
-    Node* TraceBackAlongPathUntil(Node* start, F&& pred) {
+    Node* TraceBackAlongPathUntil(const FunctionInfo& function, Node* start, F&& pred) {
         auto* current = start;
         while (current) {
             if (pred(current)) {
                 break;
             }
-            current = current->visited_from;
+            current = function.VisitedFrom(current);
         }
         return current;
     }
@@ -1740,7 +1825,8 @@ class UniformityGraph {
             // This is a call to a user-defined function, so inspect the functions called by that
             // function and look for one whose node has an edge from the RequiredToBeUniform node.
             auto target_info = functions_.Find(user->Declaration());
-            for (auto* call_node : target_info->RequiredToBeUniform(severity)->edges) {
+            for (auto edge : target_info->EdgesOf(target_info->RequiredToBeUniform(severity))) {
+                auto* call_node = target_info->node_list[edge];
                 if (call_node->type == Node::kRegular) {
                     auto* child_call = call_node->ast->As<ast::CallExpression>();
                     return FindBuiltinThatRequiresUniformity(child_call, severity);
@@ -1762,15 +1848,15 @@ class UniformityGraph {
                                    Node* may_be_non_uniform) {
         // Traverse the graph to generate a path from the node to the source of non-uniformity.
         function.ResetVisited();
-        Traverse(required_to_be_uniform);
+        function.Traverse(required_to_be_uniform);
 
         // Get the source of the non-uniform value.
-        auto* non_uniform_source = may_be_non_uniform->visited_from;
+        auto* non_uniform_source = function.VisitedFrom(may_be_non_uniform);
         TINT_ASSERT(Resolver, non_uniform_source);
 
         // Show where the non-uniform value results in non-uniform control flow.
         auto* control_flow = TraceBackAlongPathUntil(
-            non_uniform_source, [](Node* node) { return node->affects_control_flow; });
+            function, non_uniform_source, [](Node* node) { return node->affects_control_flow; });
         if (control_flow) {
             diagnostics_.add_note(diag::System::Resolver,
                                   "control flow depends on possibly non-uniform value",
@@ -1907,12 +1993,12 @@ class UniformityGraph {
 
         // Traverse the graph to generate a path from RequiredToBeUniform to the source node.
         function.ResetVisited();
-        Traverse(function.RequiredToBeUniform(severity));
-        TINT_ASSERT(Resolver, source_node->visited_from);
+        function.Traverse(function.RequiredToBeUniform(severity));
+        TINT_ASSERT(Resolver, function.VisitedFrom(source_node));
 
         // Find a node that is required to be uniform that has a path to the source node.
-        auto* cause = TraceBackAlongPathUntil(source_node, [&](Node* node) {
-            return node->visited_from == function.RequiredToBeUniform(severity);
+        auto* cause = TraceBackAlongPathUntil(function, source_node, [&](Node* node) {
+            return function.VisitedFrom(node) == function.RequiredToBeUniform(severity);
         });
 
         // The node will always have a corresponding call expression.
@@ -1942,7 +2028,7 @@ class UniformityGraph {
             report(call->args[cause->arg_index]->source, ss.str(), /* note */ user_func != nullptr);
 
             // Show the origin of non-uniformity for the value or data that is being passed.
-            ShowSourceOfNonUniformity(source_node->visited_from);
+            ShowSourceOfNonUniformity(function.VisitedFrom(source_node));
         } else {
             auto* builtin_call = FindBuiltinThatRequiresUniformity(call, severity);
             {
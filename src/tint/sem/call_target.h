@@ -38,6 +38,10 @@ struct CallTargetSignature {
     /// Copy constructor
     CallTargetSignature(const CallTargetSignature&);
 
+    /// Copy assignment operator
+    /// @returns this CallTargetSignature
+    CallTargetSignature& operator=(const CallTargetSignature&);
+
     /// Destructor
     ~CallTargetSignature();
 
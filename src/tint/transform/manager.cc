@@ -14,6 +14,8 @@
 
 #include "src/tint/transform/manager.h"
 
+#include <chrono>
+
 /// If set to 1 then the transform::Manager will dump the WGSL of the program
 /// before and after each transform. Helpful for debugging bad output.
 #define TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM 0
@@ -26,9 +28,15 @@
 #endif  // TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
 
 TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager::Statistics);
 
 namespace tint::transform {
 
+Manager::Statistics::Statistics() = default;
+Manager::Statistics::Statistics(const Statistics&) = default;
+Manager::Statistics::~Statistics() = default;
+Manager::Statistics& Manager::Statistics::operator=(const Statistics&) = default;
+
 Manager::Manager() = default;
 Manager::~Manager() = default;
 
@@ -52,11 +60,37 @@ ast::transform::Transform::ApplyResult Manager::Apply(const Program* program,
 #endif
 
     std::optional<Program> output;
+    std::unique_ptr<Statistics> stats;
+    if (collect_statistics_) {
+        stats = std::make_unique<Statistics>();
+        stats->transforms.reserve(transforms_.size());
+    }
 
     TINT_IF_PRINT_PROGRAM(print_program("Input of", this));
 
     for (const auto& transform : transforms_) {
-        if (auto result = transform->Apply(program, inputs, outputs)) {
+        std::chrono::steady_clock::time_point start;
+        if (stats) {
+            start = std::chrono::steady_clock::now();
+        }
+
+        auto result = transform->Apply(program, inputs, outputs);
+
+        if (stats) {
+            auto& entry = stats->transforms.emplace_back();
+            entry.name = transform->TypeInfo().name;
+            entry.duration_ns = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count());
+            entry.skipped = !result.has_value();
+            if (result) {
+                entry.ast_nodes = result->ASTNodes().Count();
+                entry.sem_nodes = result->SemNodes().Count();
+            }
+        }
+
+        if (result) {
             output.emplace(std::move(result.value()));
             program = &output.value();
 
@@ -74,6 +108,10 @@ ast::transform::Transform::ApplyResult Manager::Apply(const Program* program,
 
     TINT_IF_PRINT_PROGRAM(print_program("Final output of", this));
 
+    if (stats) {
+        outputs.Put(std::move(stats));
+    }
+
     return output;
 }
 
@@ -16,6 +16,7 @@
 #define SRC_TINT_TRANSFORM_MANAGER_H_
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -29,10 +30,48 @@ namespace tint::transform {
 /// the error can be retrieved with the Output's diagnostics.
 class Manager final : public tint::utils::Castable<Manager, ast::transform::Transform> {
   public:
+    /// Statistics is added to the output DataMap of Apply() when statistics collection has been
+    /// enabled with EnableStatistics().
+    struct Statistics final : public utils::Castable<Statistics, ast::transform::Data> {
+        /// Constructor
+        Statistics();
+
+        /// Copy constructor
+        Statistics(const Statistics&);
+
+        /// Destructor
+        ~Statistics() override;
+
+        /// Assignment operator
+        /// @returns this Statistics
+        Statistics& operator=(const Statistics&);
+
+        /// The statistics of a single transform run by the manager.
+        struct Entry {
+            /// The name of the transform type
+            std::string name;
+            /// The time spent in the transform's Apply(), in nanoseconds
+            uint64_t duration_ns = 0;
+            /// True if the transform returned SkipTransform, and so did not clone the program
+            bool skipped = false;
+            /// The number of AST nodes allocated by the transform's output program
+            size_t ast_nodes = 0;
+            /// The number of semantic nodes allocated by the transform's output program
+            size_t sem_nodes = 0;
+        };
+
+        /// The statistics of each transform, in the order they were run
+        std::vector<Entry> transforms;
+    };
+
     /// Constructor
     Manager();
     ~Manager() override;
 
+    /// Enables the collection of per-transform Statistics by Apply()
+    /// @param enable true to collect statistics
+    void EnableStatistics(bool enable = true) { collect_statistics_ = enable; }
+
     /// Add pass to the manager
     /// @param transform the transform to append
     void append(std::unique_ptr<Transform> transform) {
@@ -54,6 +93,7 @@ class Manager final : public tint::utils::Castable<Manager, ast::transform::Tran
 
   private:
     std::vector<std::unique_ptr<Transform>> transforms_;
+    bool collect_statistics_ = false;
 };
 
 }  // namespace tint::transform
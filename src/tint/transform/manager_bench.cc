@@ -0,0 +1,98 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include "src/tint/ast/transform/canonicalize_entry_point_io.h"
+#include "src/tint/ast/transform/demote_to_helper.h"
+#include "src/tint/ast/transform/disable_uniformity_analysis.h"
+#include "src/tint/ast/transform/expand_compound_assignment.h"
+#include "src/tint/ast/transform/promote_initializers_to_let.h"
+#include "src/tint/ast/transform/promote_side_effects_to_decl.h"
+#include "src/tint/ast/transform/remove_phonies.h"
+#include "src/tint/ast/transform/simplify_pointers.h"
+#include "src/tint/ast/transform/unshadow.h"
+#include "src/tint/ast/transform/vectorize_scalar_matrix_initializers.h"
+#include "src/tint/ast/transform/zero_init_workgroup_memory.h"
+#include "src/tint/bench/benchmark.h"
+#include "src/tint/transform/manager.h"
+
+namespace tint::transform {
+namespace {
+
+// Runs a sanitizer-like chain of transforms, reporting the time spent in each transform, how
+// often each transform was skipped, and the number of AST and semantic nodes allocated for the
+// cloned programs.
+void ApplyTransforms(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto& program = std::get<bench::ProgramAndFile>(res).program;
+
+    Manager manager;
+    manager.EnableStatistics();
+    manager.Add<ast::transform::DisableUniformityAnalysis>();
+    manager.Add<ast::transform::ExpandCompoundAssignment>();
+    manager.Add<ast::transform::Unshadow>();
+    manager.Add<ast::transform::PromoteSideEffectsToDecl>();
+    manager.Add<ast::transform::ZeroInitWorkgroupMemory>();
+    manager.Add<ast::transform::CanonicalizeEntryPointIO>();
+    manager.Add<ast::transform::PromoteInitializersToLet>();
+    manager.Add<ast::transform::DemoteToHelper>();
+    manager.Add<ast::transform::VectorizeScalarMatrixInitializers>();
+    manager.Add<ast::transform::RemovePhonies>();
+    manager.Add<ast::transform::SimplifyPointers>();
+
+    ast::transform::DataMap inputs;
+    inputs.Add<ast::transform::CanonicalizeEntryPointIO::Config>(
+        ast::transform::CanonicalizeEntryPointIO::ShaderStyle::kMsl);
+
+    double clones = 0;
+    double ast_nodes = 0;
+    double sem_nodes = 0;
+    for (auto _ : state) {
+        auto output = manager.Run(&program, inputs);
+        if (!output.program.IsValid()) {
+            state.SkipWithError(output.program.Diagnostics().str().c_str());
+            return;
+        }
+        auto* stats = output.data.Get<Manager::Statistics>();
+        if (!stats) {
+            continue;
+        }
+        for (auto& entry : stats->transforms) {
+            state.counters[entry.name + "_ns"].value += static_cast<double>(entry.duration_ns);
+            if (!entry.skipped) {
+                clones++;
+                ast_nodes += static_cast<double>(entry.ast_nodes);
+                sem_nodes += static_cast<double>(entry.sem_nodes);
+            }
+        }
+    }
+
+    // Report all the counters as averages per iteration.
+    state.counters["clones"] = clones;
+    state.counters["ast_nodes"] = ast_nodes;
+    state.counters["sem_nodes"] = sem_nodes;
+    for (auto& counter : state.counters) {
+        counter.second.flags = benchmark::Counter::kAvgIterations;
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(ApplyTransforms);
+
+}  // namespace
+}  // namespace tint::transform
@@ -14,16 +14,163 @@
 
 #include "src/tint/utils/string_stream.h"
 
+#include <functional>
+#include <limits>
+
 namespace tint::utils {
 
-StringStream::StringStream() {
-    sstream_.flags(sstream_.flags() | std::ios_base::showpoint | std::ios_base::fixed);
-    sstream_.imbue(std::locale::classic());
-    sstream_.precision(9);
+namespace {
+
+/// The buffer size needed to print any float or double in fixed point with 20 fractional digits.
+constexpr size_t kFloatBufferSize = 384;
+
+/// Formats `value` into `buf`, as described by StringStream::EmitFloat().
+/// @param value the value to format
+/// @param buf the buffer to format into
+/// @param str the string that holds the formatted value, if it isn't held by `buf`
+/// @returns the formatted value
+template <typename T>
+std::string_view FormatFloat(T value, char (&buf)[kFloatBufferSize], std::string& str) {
+#if defined(__cpp_lib_to_chars)
+    (void)str;
+
+    // Try printing the float in fixed point, with a smallish limit on the precision
+    char* end = std::to_chars(buf, buf + kFloatBufferSize, value, std::chars_format::fixed, 20).ptr;
+
+    // If this string can be parsed without loss of information, use it.
+    double roundtripped = 0;
+    std::from_chars(buf, end, roundtripped);
+    auto float_equal_no_warning = std::equal_to<T>();
+    if (float_equal_no_warning(value, static_cast<T>(roundtripped))) {
+        // Strip trailing zeros from the number.
+        while (end - buf >= 2 && end[-1] == '0' && end[-2] != '.') {
+            end--;
+        }
+        return std::string_view(buf, static_cast<size_t>(end - buf));
+    }
+
+    // Resort to scientific, with the minimum precision needed to preserve the whole float
+    end = std::to_chars(buf, buf + kFloatBufferSize, value, std::chars_format::general,
+                        std::numeric_limits<T>::max_digits10)
+              .ptr;
+    return std::string_view(buf, static_cast<size_t>(end - buf));
+#else
+    // The standard library lacks floating point std::to_chars() and std::from_chars(), so fall
+    // back to iostreams.
+    (void)buf;
+
+    // Try printing the float in fixed point, with a smallish limit on the precision
+    std::stringstream fixed;
+    fixed.flags(fixed.flags() | std::ios_base::showpoint | std::ios_base::fixed);
+    fixed.imbue(std::locale::classic());
+    fixed.precision(20);
+    fixed << value;
+
+    str = fixed.str();
+
+    // If this string can be parsed without loss of information, use it.
+    // (Use double here to dodge a bug in older libc++ versions which would incorrectly read
+    // back FLT_MAX as INF.)
+    double roundtripped;
+    fixed >> roundtripped;
+
+    // Strip trailing zeros from the number.
+    auto float_equal_no_warning = std::equal_to<T>();
+    if (float_equal_no_warning(value, static_cast<T>(roundtripped))) {
+        while (str.length() >= 2 && str[str.size() - 1] == '0' && str[str.size() - 2] != '.') {
+            str.pop_back();
+        }
+        return str;
+    }
+
+    // Resort to scientific, with the minimum precision needed to preserve the whole float
+    std::stringstream sci;
+    sci.imbue(std::locale::classic());
+    sci.precision(std::numeric_limits<T>::max_digits10);
+    sci << value;
+    str = sci.str();
+    return str;
+#endif
 }
 
+}  // namespace
+
+StringStream::StringStream()
+    : flags_(std::ios_base::dec | std::ios_base::showpoint | std::ios_base::fixed) {}
+
 StringStream::~StringStream() = default;
 
+StringStream& StringStream::operator<<(const void* value) {
+    char buf[2 + sizeof(uintptr_t) * 2] = {'0', 'x'};
+    char* end = std::to_chars(buf + 2, buf + sizeof(buf), reinterpret_cast<uintptr_t>(value), 16).ptr;
+    return Emit(std::string_view(buf, static_cast<size_t>(end - buf)), 2);
+}
+
+StringStream& StringStream::operator<<(StdEndl manipulator) {
+    if (manipulator == static_cast<StdEndl>(std::endl)) {
+        buffer_.push_back('\n');
+        return *this;
+    }
+    // Apply the manipulator to a scratch stream, and append anything it wrote.
+    std::stringstream scratch;
+    manipulator(scratch);
+    buffer_.append(scratch.str());
+    return *this;
+}
+
+StringStream& StringStream::operator<<(decltype(std::hex) manipulator) {
+    if (manipulator == &std::hex) {
+        flags_ = (flags_ & ~std::ios_base::basefield) | std::ios_base::hex;
+    } else if (manipulator == &std::dec) {
+        flags_ = (flags_ & ~std::ios_base::basefield) | std::ios_base::dec;
+    } else {
+        // Apply the manipulator to a scratch stream to read back the modified flags.
+        std::stringstream scratch;
+        scratch.flags(flags_);
+        manipulator(scratch);
+        flags_ = scratch.flags();
+    }
+    return *this;
+}
+
+StringStream& StringStream::EmitPadded(std::string_view value, size_t internal_pos) {
+    auto width = static_cast<size_t>(width_);
+    width_ = 0;
+    if (value.size() >= width) {
+        buffer_.append(value);
+        return *this;
+    }
+    size_t padding = width - value.size();
+    switch (flags_ & std::ios_base::adjustfield) {
+        case std::ios_base::left:
+            buffer_.append(value);
+            buffer_.append(padding, fill_);
+            break;
+        case std::ios_base::internal:
+            buffer_.append(value.substr(0, internal_pos));
+            buffer_.append(padding, fill_);
+            buffer_.append(value.substr(internal_pos));
+            break;
+        default:
+            buffer_.append(padding, fill_);
+            buffer_.append(value);
+            break;
+    }
+    return *this;
+}
+
+StringStream& StringStream::EmitFloat(float value) {
+    char buf[kFloatBufferSize];
+    std::string str;
+    return Emit(FormatFloat(value, buf, str));
+}
+
+StringStream& StringStream::EmitFloat(double value) {
+    char buf[kFloatBufferSize];
+    std::string str;
+    return Emit(FormatFloat(value, buf, str));
+}
+
 utils::StringStream& operator<<(utils::StringStream& out, CodePoint code_point) {
     if (code_point < 0x7f) {
         // See https://en.cppreference.com/w/cpp/language/escape
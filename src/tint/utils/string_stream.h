@@ -15,20 +15,26 @@
 #ifndef SRC_TINT_UTILS_STRING_STREAM_H_
 #define SRC_TINT_UTILS_STRING_STREAM_H_
 
-#include <functional>
+#include <charconv>
+#include <cstdint>
 #include <iomanip>
-#include <iterator>
-#include <limits>
+#include <ios>
+#include <ostream>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
+#include "src/tint/utils/compiler_macros.h"
 #include "src/tint/utils/unicode.h"
 
 namespace tint::utils {
 
-/// Stringstream wrapper which automatically resets the locale and sets floating point emission
-/// settings needed for Tint.
+/// StringStream is an append-only string builder with an std::ostream-like interface.
+/// Numbers are always formatted with the classic locale, and floating point values are emitted with
+/// enough precision to round-trip. Unlike std::stringstream, constructing a StringStream does not
+/// allocate or touch the locale, and integers are formatted with std::to_chars.
 class StringStream {
     using SetWRetTy = decltype(std::setw(std::declval<int>()));
     using SetPrecisionRetTy = decltype(std::setprecision(std::declval<int>()));
@@ -40,6 +46,12 @@ class StringStream {
                                       std::is_same_v<SetPrecisionRetTy, std::decay_t<T>> ||
                                       std::is_same_v<SetFillRetTy, std::decay_t<T>>;
 
+    /// Evaluates to true if `T` is a character type that is emitted as a character.
+    template <typename T>
+    static constexpr bool IsCharType = std::is_same_v<T, char> ||
+                                       std::is_same_v<T, signed char> ||
+                                       std::is_same_v<T, unsigned char>;
+
   public:
     /// Constructor
     StringStream();
@@ -47,11 +59,13 @@ class StringStream {
     ~StringStream();
 
     /// @returns the format flags for the stream
-    std::ios_base::fmtflags flags() const { return sstream_.flags(); }
+    std::ios_base::fmtflags flags() const { return flags_; }
 
     /// @param flags the flags to set
     /// @returns the original format flags
-    std::ios_base::fmtflags flags(std::ios_base::fmtflags flags) { return sstream_.flags(flags); }
+    std::ios_base::fmtflags flags(std::ios_base::fmtflags flags) {
+        return std::exchange(flags_, flags);
+    }
 
     /// Emit `value` to the stream
     /// @param value the value to emit
@@ -59,26 +73,26 @@ class StringStream {
     template <typename T,
               typename std::enable_if_t<std::is_integral_v<std::decay_t<T>>, bool> = true>
     StringStream& operator<<(T&& value) {
-        return EmitValue(std::forward<T>(value));
+        return EmitInteger(static_cast<std::decay_t<T>>(value));
     }
 
     /// Emit `value` to the stream
     /// @param value the value to emit
     /// @returns a reference to this
-    StringStream& operator<<(const char* value) { return EmitValue(value); }
+    StringStream& operator<<(const char* value) { return Emit(value); }
     /// Emit `value` to the stream
     /// @param value the value to emit
     /// @returns a reference to this
-    StringStream& operator<<(const std::string& value) { return EmitValue(value); }
+    StringStream& operator<<(const std::string& value) { return Emit(value); }
     /// Emit `value` to the stream
     /// @param value the value to emit
     /// @returns a reference to this
-    StringStream& operator<<(std::string_view value) { return EmitValue(value); }
+    StringStream& operator<<(std::string_view value) { return Emit(value); }
 
     /// Emit `value` to the stream
     /// @param value the value to emit
     /// @returns a reference to this
-    StringStream& operator<<(const void* value) { return EmitValue(value); }
+    StringStream& operator<<(const void* value);
 
     /// Emit `value` to the stream
     /// @param value the value to emit
@@ -86,101 +100,153 @@ class StringStream {
     template <typename T,
               typename std::enable_if_t<std::is_floating_point_v<std::decay_t<T>>, bool> = true>
     StringStream& operator<<(T&& value) {
-        return EmitFloat(std::forward<T>(value));
-    }
-
-    /// Emit `value` to the stream
-    /// @param value the value to emit
-    /// @returns a reference to this
-    template <typename T>
-    StringStream& EmitValue(T&& value) {
-        sstream_ << std::forward<T>(value);
-        return *this;
-    }
-
-    /// Emit `value` to the stream
-    /// @param value the value to emit
-    /// @returns a reference to this
-    template <typename T>
-    StringStream& EmitFloat(const T& value) {
-        // Try printing the float in fixed point, with a smallish limit on the precision
-        std::stringstream fixed;
-        fixed.flags(fixed.flags() | std::ios_base::showpoint | std::ios_base::fixed);
-        fixed.imbue(std::locale::classic());
-        fixed.precision(20);
-        fixed << value;
-
-        std::string str = fixed.str();
-
-        // If this string can be parsed without loss of information, use it.
-        // (Use double here to dodge a bug in older libc++ versions which would incorrectly read
-        // back FLT_MAX as INF.)
-        double roundtripped;
-        fixed >> roundtripped;
-
-        // Strip trailing zeros from the number.
-        auto float_equal_no_warning = std::equal_to<T>();
-        if (float_equal_no_warning(value, static_cast<T>(roundtripped))) {
-            while (str.length() >= 2 && str[str.size() - 1] == '0' && str[str.size() - 2] != '.') {
-                str.pop_back();
-            }
-
-            sstream_ << str;
-            return *this;
+        if constexpr (std::is_same_v<std::decay_t<T>, float>) {
+            return EmitFloat(value);
+        } else {
+            return EmitFloat(static_cast<double>(value));
         }
-
-        // Resort to scientific, with the minimum precision needed to preserve the whole float
-        std::stringstream sci;
-        sci.imbue(std::locale::classic());
-        sci.precision(std::numeric_limits<T>::max_digits10);
-        sci << value;
-        sstream_ << sci.str();
-
-        return *this;
     }
 
     /// Swaps streams
     /// @param other stream to swap too
-    void swap(StringStream& other) { sstream_.swap(other.sstream_); }
+    void swap(StringStream& other) {
+        std::swap(buffer_, other.buffer_);
+        std::swap(flags_, other.flags_);
+        std::swap(width_, other.width_);
+        std::swap(fill_, other.fill_);
+    }
 
     /// repeat queues the character c to be written to the printer n times.
     /// @param c the character to print `n` times
     /// @param n the number of times to print character `c`
-    void repeat(char c, size_t n) { std::fill_n(std::ostream_iterator<char>(sstream_), n, c); }
+    void repeat(char c, size_t n) { buffer_.append(n, c); }
 
     /// The callback to emit a `endl` to the stream
     using StdEndl = std::ostream& (*)(std::ostream&);
 
     /// @param manipulator the callback to emit too
     /// @returns a reference to this
-    StringStream& operator<<(StdEndl manipulator) {
-        // call the function, and return it's value
-        manipulator(sstream_);
-        return *this;
-    }
+    StringStream& operator<<(StdEndl manipulator);
 
     /// @param manipulator the callback to emit too
     /// @returns a reference to this
-    StringStream& operator<<(decltype(std::hex) manipulator) {
-        // call the function, and return it's value
-        manipulator(sstream_);
-        return *this;
-    }
+    StringStream& operator<<(decltype(std::hex) manipulator);
 
     /// @param value the value to emit
     /// @returns a reference to this
+    /// @note floating point values are always emitted with enough precision to round-trip, so
+    /// std::setprecision() has no effect.
     template <typename T, typename std::enable_if_t<IsSetType<T>, int> = 0>
     StringStream& operator<<(T&& value) {
-        // call the function, and return it's value
-        sstream_ << std::forward<T>(value);
+        // The types returned by the manipulators are unspecified, so apply the manipulator to a
+        // scratch stream to read back the width and fill.
+        std::stringstream scratch;
+        scratch.width(width_);
+        scratch.fill(fill_);
+        scratch << std::forward<T>(value);
+        width_ = scratch.width();
+        fill_ = scratch.fill();
         return *this;
     }
 
     /// @returns the string contents of the stream
-    std::string str() const { return sstream_.str(); }
+    std::string str() const { return buffer_; }
+
+    /// @returns a view of the contents of the stream, which is invalidated by the next write
+    std::string_view view() const { return buffer_; }
 
   private:
-    std::stringstream sstream_;
+    /// Emits `value`, padded to the current width
+    /// @param value the value to emit
+    /// @param internal_pos the position in `value` where padding is inserted when the adjustment
+    /// is std::internal, which is after the sign and base prefix of numbers
+    /// @returns a reference to this
+    StringStream& Emit(std::string_view value, size_t internal_pos = 0) {
+        if (TINT_LIKELY(width_ <= 0)) {
+            buffer_.append(value);
+            return *this;
+        }
+        return EmitPadded(value, internal_pos);
+    }
+
+    /// Emits `value` padded to the current width, and resets the width.
+    /// @param value the value to emit
+    /// @param internal_pos the position in `value` where padding is inserted when the adjustment
+    /// is std::internal
+    /// @returns a reference to this
+    StringStream& EmitPadded(std::string_view value, size_t internal_pos);
+
+    /// Emits the integer `value`, following the format flags of the stream
+    /// @param value the value to emit
+    /// @returns a reference to this
+    template <typename T>
+    StringStream& EmitInteger(T value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            if (flags_ & std::ios_base::boolalpha) {
+                return Emit(value ? "true" : "false");
+            }
+            return Emit(value ? "1" : "0");
+        } else if constexpr (IsCharType<T>) {
+            char c = static_cast<char>(value);
+            return Emit(std::string_view(&c, 1));
+        } else {
+            // Large enough for the octal digits of a 64-bit integer, with a sign or base prefix.
+            char buf[32];
+            char* end = buf;
+            size_t prefix = 0;
+            auto base = flags_ & std::ios_base::basefield;
+            if (base == std::ios_base::hex || base == std::ios_base::oct) {
+                // Like std::ostream, print negative numbers as their two's complement bits.
+                auto bits = static_cast<std::make_unsigned_t<T>>(value);
+                if ((flags_ & std::ios_base::showbase) && bits != 0) {
+                    *end++ = '0';
+                    if (base == std::ios_base::hex) {
+                        *end++ = (flags_ & std::ios_base::uppercase) ? 'X' : 'x';
+                    }
+                }
+                prefix = static_cast<size_t>(end - buf);
+                char* digits = end;
+                end = std::to_chars(end, buf + sizeof(buf), bits,
+                                    base == std::ios_base::hex ? 16 : 8)
+                          .ptr;
+                if (flags_ & std::ios_base::uppercase) {
+                    for (char* c = digits; c != end; c++) {
+                        if (*c >= 'a' && *c <= 'f') {
+                            *c = static_cast<char>(*c - 'a' + 'A');
+                        }
+                    }
+                }
+            } else {
+                if constexpr (std::is_signed_v<T>) {
+                    if ((flags_ & std::ios_base::showpos) && value >= 0) {
+                        *end++ = '+';
+                    }
+                }
+                end = std::to_chars(end, buf + sizeof(buf), +value).ptr;
+                prefix = (buf[0] == '+' || buf[0] == '-') ? 1 : 0;
+            }
+            return Emit(std::string_view(buf, static_cast<size_t>(end - buf)), prefix);
+        }
+    }
+
+    /// Emits the floating point `value`. The value is printed in fixed point if this can be done
+    /// with at most 20 fractional digits without loss of information, otherwise in scientific
+    /// notation with the minimum precision needed to preserve the whole value.
+    /// @param value the value to emit
+    /// @returns a reference to this
+    StringStream& EmitFloat(float value);
+
+    /// @copydoc EmitFloat(float)
+    StringStream& EmitFloat(double value);
+
+    /// The string contents
+    std::string buffer_;
+    /// The format flags
+    std::ios_base::fmtflags flags_;
+    /// The minimum width of the next emitted value
+    std::streamsize width_ = 0;
+    /// The character used to pad values to `width_`
+    char fill_ = ' ';
 };
 
 /// Writes the CodePoint to the stream.
@@ -16,6 +16,7 @@
 
 #include <math.h>
 #include <cstring>
+#include <iomanip>
 #include <limits>
 
 #include "gtest/gtest.h"
@@ -107,5 +108,69 @@ TEST_F(StringStreamTest, Precision) {
     }
 }
 
+TEST_F(StringStreamTest, Integers) {
+    StringStream s;
+    s << 0 << " " << -42 << " " << 42u << " " << std::numeric_limits<int64_t>::min() << " "
+      << std::numeric_limits<uint64_t>::max();
+    EXPECT_EQ(s.str(), "0 -42 42 -9223372036854775808 18446744073709551615");
+}
+
+TEST_F(StringStreamTest, Chars) {
+    StringStream s;
+    s << 'a' << static_cast<unsigned char>('b') << true << false;
+    EXPECT_EQ(s.str(), "ab10");
+}
+
+TEST_F(StringStreamTest, Hex) {
+    StringStream s;
+    s << std::hex << 255 << " " << -1 << " " << std::dec << 255;
+    EXPECT_EQ(s.str(), "ff ffffffff 255");
+}
+
+TEST_F(StringStreamTest, ShowPos) {
+    StringStream s;
+    s << std::showpos << 1 << " " << -1 << " " << 0 << " " << 1u;
+    EXPECT_EQ(s.str(), "+1 -1 +0 1");
+}
+
+TEST_F(StringStreamTest, Width) {
+    StringStream s;
+    s << "[" << std::setw(4) << 7 << "][" << std::setw(4) << "ab" << "][" << 7 << "]";
+    EXPECT_EQ(s.str(), "[   7][  ab][7]");
+}
+
+TEST_F(StringStreamTest, WidthFill) {
+    StringStream s;
+    s << std::hex << std::setfill('0') << std::setw(4) << 0xab << " " << std::setw(1) << 0xab;
+    EXPECT_EQ(s.str(), "00ab ab");
+}
+
+TEST_F(StringStreamTest, WidthLeftAndInternal) {
+    StringStream s;
+    s << std::left << std::setw(4) << -7 << "|" << std::internal << std::setw(4) << -7;
+    EXPECT_EQ(s.str(), "-7  |-  7");
+}
+
+TEST_F(StringStreamTest, Flags) {
+    StringStream s;
+    auto flags = s.flags();
+    s << std::hex << 16;
+    s.flags(flags);
+    s << " " << 16;
+    EXPECT_EQ(s.str(), "10 16");
+}
+
+TEST_F(StringStreamTest, Endl) {
+    StringStream s;
+    s << "a" << std::endl << "b";
+    EXPECT_EQ(s.str(), "a\nb");
+}
+
+TEST_F(StringStreamTest, Double) {
+    StringStream s;
+    s << 0.5 << " " << 1e-30;
+    EXPECT_EQ(s.str(), "0.5 1.0000000000000001e-30");
+}
+
 }  // namespace
 }  // namespace tint::utils
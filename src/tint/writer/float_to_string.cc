@@ -65,7 +65,7 @@ std::string ToBitPreservingString(F f) {
     // For the NaN case, avoid handling the number as a floating point value.
     // Some machines will modify the top bit in the mantissa of a NaN.
 
-    std::stringstream ss;
+    utils::StringStream ss;
 
     typename T::uint_t float_bits = 0u;
     static_assert(sizeof(float_bits) == sizeof(f));
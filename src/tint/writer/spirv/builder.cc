@@ -48,7 +48,6 @@
 #include "src/tint/type/vector.h"
 #include "src/tint/utils/compiler_macros.h"
 #include "src/tint/utils/defer.h"
-#include "src/tint/utils/map.h"
 #include "src/tint/utils/string_stream.h"
 #include "src/tint/writer/append_vector.h"
 #include "src/tint/writer/check_supported_extensions.h"
@@ -292,18 +291,18 @@ bool Builder::Build() {
 }
 
 void Builder::RegisterVariable(const sem::Variable* var, uint32_t id) {
-    var_to_id_.emplace(var, id);
-    id_to_var_.emplace(id, var);
+    var_to_id_.Add(var, id);
+    id_to_var_.Add(id, var);
 }
 
 uint32_t Builder::LookupVariableID(const sem::Variable* var) {
-    auto it = var_to_id_.find(var);
-    if (it == var_to_id_.end()) {
+    auto id = var_to_id_.Find(var);
+    if (!id) {
         TINT_ICE(Writer, builder_.Diagnostics())
             << "unable to find ID for variable: " + var->Declaration()->name->symbol.Name();
         return 0;
     }
-    return it->second;
+    return *id;
 }
 
 void Builder::PushScope() {
@@ -445,7 +444,7 @@ bool Builder::GenerateEntryPoint(const ast::Function* func, uint32_t id) {
 
         operands.push_back(Operand(var_id));
     }
-    module_.PushEntryPoint(spv::Op::OpEntryPoint, operands);
+    module_.PushEntryPoint(spv::Op::OpEntryPoint, std::move(operands));
 
     return true;
 }
@@ -589,7 +588,7 @@ bool Builder::GenerateFunction(const ast::Function* func_ast) {
         }
     }
 
-    func_symbol_to_id_[func_ast->name->symbol] = func_id;
+    func_symbol_to_id_.Replace(func_ast->name->symbol, func_id);
 
     // Add the function to the module.
     module_.PushFunction(std::move(current_function_));
@@ -598,7 +597,7 @@ bool Builder::GenerateFunction(const ast::Function* func_ast) {
 }
 
 uint32_t Builder::GenerateFunctionTypeIfNeeded(const sem::Function* func) {
-    return utils::GetOrCreate(func_sig_to_id_, func->Signature(), [&]() -> uint32_t {
+    return func_sig_to_id_.GetOrCreate(func->Signature(), [&]() -> uint32_t {
         auto func_op = result_op();
         auto func_type_id = std::get<uint32_t>(func_op);
 
@@ -979,7 +978,7 @@ bool Builder::GenerateMemberAccessor(const ast::MemberAccessorExpression* expr,
                     ops.push_back(Operand(id));
                 }
 
-                if (!push_function_inst(spv::Op::OpAccessChain, ops)) {
+                if (!push_function_inst(spv::Op::OpAccessChain, std::move(ops))) {
                     return false;
                 }
 
@@ -1004,7 +1003,7 @@ bool Builder::GenerateMemberAccessor(const ast::MemberAccessorExpression* expr,
                 ops.push_back(Operand(idx));
             }
 
-            if (!push_function_inst(spv::Op::OpVectorShuffle, ops)) {
+            if (!push_function_inst(spv::Op::OpVectorShuffle, std::move(ops))) {
                 return false;
             }
             info->source_id = result_id;
@@ -1085,7 +1084,7 @@ uint32_t Builder::GenerateAccessorExpression(const ast::AccessorExpression* expr
             ops.push_back(Operand(id));
         }
 
-        if (!push_function_inst(spv::Op::OpAccessChain, ops)) {
+        if (!push_function_inst(spv::Op::OpAccessChain, std::move(ops))) {
             return false;
         }
         info.source_id = result_id;
@@ -1167,9 +1166,8 @@ uint32_t Builder::GenerateUnaryOpExpression(const ast::UnaryOpExpression* expr)
 }
 
 uint32_t Builder::GetGLSLstd450Import() {
-    auto where = import_name_to_id_.find(kGLSLstd450);
-    if (where != import_name_to_id_.end()) {
-        return where->second;
+    if (auto id = import_name_to_id_.Find(kGLSLstd450)) {
+        return *id;
     }
 
     // It doesn't exist yet. Generate it.
@@ -1179,7 +1177,7 @@ uint32_t Builder::GetGLSLstd450Import() {
     module_.PushExtImport(spv::Op::OpExtInstImport, {result, Operand(kGLSLstd450)});
 
     // Remember it for later.
-    import_name_to_id_[kGLSLstd450] = id;
+    import_name_to_id_.Add(kGLSLstd450, id);
     return id;
 }
 
@@ -1377,16 +1375,17 @@ uint32_t Builder::GenerateValueConstructorOrConversion(const sem::Call* call,
                       ? scope_stack_[0]       // Global scope
                       : scope_stack_.back();  // Lexical scope
 
-    return utils::GetOrCreate(stack.type_init_to_id_, OperandListKey{ops}, [&]() -> uint32_t {
+    OperandListKey key{ops};
+    return stack.type_init_to_id_.GetOrCreate(key, [&]() -> uint32_t {
         auto result = result_op();
         ops[kOpsResultIdx] = result;
 
         if (result_is_spec_composite) {
-            module_.PushType(spv::Op::OpSpecConstantComposite, ops);
+            module_.PushType(spv::Op::OpSpecConstantComposite, std::move(ops));
         } else if (result_is_constant_composite) {
-            module_.PushType(spv::Op::OpConstantComposite, ops);
+            module_.PushType(spv::Op::OpConstantComposite, std::move(ops));
         } else {
-            if (!push_function_inst(spv::Op::OpCompositeConstruct, ops)) {
+            if (!push_function_inst(spv::Op::OpCompositeConstruct, std::move(ops))) {
                 return 0;
             }
         }
@@ -1619,13 +1618,13 @@ uint32_t Builder::GenerateConstantIfNeeded(const constant::Value* constant) {
         }
 
         auto& global_scope = scope_stack_[0];
-        return utils::GetOrCreate(
-            global_scope.type_init_to_id_, OperandListKey{ops}, [&]() -> uint32_t {
-                auto result = result_op();
-                ops[kOpsResultIdx] = result;
-                module_.PushType(spv::Op::OpConstantComposite, std::move(ops));
-                return std::get<uint32_t>(result);
-            });
+        OperandListKey key{ops};
+        return global_scope.type_init_to_id_.GetOrCreate(key, [&]() -> uint32_t {
+            auto result = result_op();
+            ops[kOpsResultIdx] = result;
+            module_.PushType(spv::Op::OpConstantComposite, std::move(ops));
+            return std::get<uint32_t>(result);
+        });
     };
 
     return Switch(
@@ -1669,9 +1668,8 @@ uint32_t Builder::GenerateConstantIfNeeded(const constant::Value* constant) {
 }
 
 uint32_t Builder::GenerateConstantIfNeeded(const ScalarConstant& constant) {
-    auto it = const_to_id_.find(constant);
-    if (it != const_to_id_.end()) {
-        return it->second;
+    if (auto id = const_to_id_.Find(constant)) {
+        return *id;
     }
 
     uint32_t type_id = 0;
@@ -1738,7 +1736,7 @@ uint32_t Builder::GenerateConstantIfNeeded(const ScalarConstant& constant) {
         }
     }
 
-    const_to_id_[constant] = result_id;
+    const_to_id_.Add(constant, result_id);
     return result_id;
 }
 
@@ -1748,7 +1746,7 @@ uint32_t Builder::GenerateConstantNullIfNeeded(const type::Type* type) {
         return 0;
     }
 
-    return utils::GetOrCreate(const_null_to_id_, type, [&] {
+    return const_null_to_id_.GetOrCreate(type, [&] {
         auto result = result_op();
 
         module_.PushType(spv::Op::OpConstantNull, {Operand(type_id), result});
@@ -1764,7 +1762,7 @@ uint32_t Builder::GenerateConstantVectorSplatIfNeeded(const type::Vector* type,
     }
 
     uint64_t key = (static_cast<uint64_t>(type->Width()) << 32) + value_id;
-    return utils::GetOrCreate(const_splat_to_id_, key, [&] {
+    return const_splat_to_id_.GetOrCreate(key, [&] {
         auto result = result_op();
         auto result_id = std::get<uint32_t>(result);
 
@@ -1774,9 +1772,7 @@ uint32_t Builder::GenerateConstantVectorSplatIfNeeded(const type::Vector* type,
         for (uint32_t i = 0; i < type->Width(); i++) {
             ops.push_back(Operand(value_id));
         }
-        module_.PushType(spv::Op::OpConstantComposite, ops);
-
-        const_splat_to_id_[key] = result_id;
+        module_.PushType(spv::Op::OpConstantComposite, std::move(ops));
         return result_id;
     });
 }
@@ -1869,7 +1865,7 @@ uint32_t Builder::GenerateSplat(uint32_t scalar_id, const type::Type* vec_type)
     for (size_t i = 0; i < vec_type->As<type::Vector>()->Width(); ++i) {
         ops.push_back(Operand(scalar_id));
     }
-    if (!push_function_inst(spv::Op::OpCompositeConstruct, ops)) {
+    if (!push_function_inst(spv::Op::OpCompositeConstruct, std::move(ops))) {
         return 0;
     }
 
@@ -1930,7 +1926,7 @@ uint32_t Builder::GenerateMatrixAddOrSub(uint32_t lhs_id,
     auto result_mat_id = result_op();
     ops.insert(ops.begin(), result_mat_id);
     ops.insert(ops.begin(), Operand(GenerateTypeIfNeeded(type)));
-    if (!push_function_inst(spv::Op::OpCompositeConstruct, ops)) {
+    if (!push_function_inst(spv::Op::OpCompositeConstruct, std::move(ops))) {
         return 0;
     }
 
@@ -2215,7 +2211,7 @@ uint32_t Builder::GenerateFunctionCall(const sem::Call* call, const sem::Functio
 
     OperandList ops = {Operand(type_id), result};
 
-    auto func_id = func_symbol_to_id_[ident->symbol];
+    auto func_id = func_symbol_to_id_.Get(ident->symbol).value_or(0u);
     if (func_id == 0) {
         TINT_ICE(Writer, builder_.Diagnostics())
             << "unable to find called function: " + ident->symbol.Name();
@@ -2352,7 +2348,7 @@ uint32_t Builder::GenerateBuiltinCall(const sem::Call* call, const sem::Builtin*
             // Runtime array must be the last member in the structure
             params.push_back(Operand(uint32_t(type->As<type::Struct>()->Members().Length() - 1)));
 
-            if (!push_function_inst(spv::Op::OpArrayLength, params)) {
+            if (!push_function_inst(spv::Op::OpArrayLength, std::move(params))) {
                 return 0;
             }
             return result_id;
@@ -3243,7 +3239,7 @@ uint32_t Builder::GenerateSampledImage(const type::Type* texture_type,
     }
 
     uint32_t sampled_image_type_id =
-        utils::GetOrCreate(texture_type_to_sampled_image_type_id_, texture_type, [&] {
+        texture_type_to_sampled_image_type_id_.GetOrCreate(texture_type, [&] {
             // We need to create the sampled image type and cache the result.
             auto sampled_image_type = result_op();
             auto texture_type_id = GenerateTypeIfNeeded(texture_type);
@@ -3418,7 +3414,7 @@ bool Builder::GenerateSwitchStatement(const ast::SwitchStatement* stmt) {
                             {Operand(merge_block_id), U32Operand(SpvSelectionControlMaskNone)})) {
         return false;
     }
-    if (!push_function_inst(spv::Op::OpSwitch, params)) {
+    if (!push_function_inst(spv::Op::OpSwitch, std::move(params))) {
         return false;
     }
 
@@ -3548,8 +3544,8 @@ bool Builder::GenerateLoopStatement(const ast::LoopStatement* stmt) {
 
     // Generate the backedge.
     TINT_ASSERT(Writer, !backedge_stack_.empty());
-    const Backedge& backedge = backedge_stack_.back();
-    if (!push_function_inst(backedge.opcode, backedge.operands)) {
+    Backedge& backedge = backedge_stack_.back();
+    if (!push_function_inst(backedge.opcode, std::move(backedge.operands))) {
         return false;
     }
     backedge_stack_.pop_back();
@@ -3627,7 +3623,7 @@ uint32_t Builder::GenerateTypeIfNeeded(const type::Type* type) {
                                               builtin::Access::kReadWrite);
     }
 
-    return utils::GetOrCreate(type_to_id_, type, [&]() -> uint32_t {
+    return type_to_id_.GetOrCreate(type, [&]() -> uint32_t {
         auto result = result_op();
         auto id = std::get<uint32_t>(result);
         bool ok = Switch(
@@ -3682,13 +3678,18 @@ uint32_t Builder::GenerateTypeIfNeeded(const type::Type* type) {
                 // Register all three access types of StorageTexture names. In
                 // SPIR-V, we must output a single type, while the variable is
                 // annotated with the access type. Doing this ensures we de-dupe.
-                type_to_id_[builder_.create<type::StorageTexture>(
-                    tex->dim(), tex->texel_format(), builtin::Access::kRead, tex->type())] = id;
-                type_to_id_[builder_.create<type::StorageTexture>(
-                    tex->dim(), tex->texel_format(), builtin::Access::kWrite, tex->type())] = id;
-                type_to_id_[builder_.create<type::StorageTexture>(
-                    tex->dim(), tex->texel_format(), builtin::Access::kReadWrite, tex->type())] =
-                    id;
+                type_to_id_.Replace(builder_.create<type::StorageTexture>(
+                                        tex->dim(), tex->texel_format(), builtin::Access::kRead,
+                                        tex->type()),
+                                    id);
+                type_to_id_.Replace(builder_.create<type::StorageTexture>(
+                                        tex->dim(), tex->texel_format(), builtin::Access::kWrite,
+                                        tex->type()),
+                                    id);
+                type_to_id_.Replace(builder_.create<type::StorageTexture>(
+                                        tex->dim(), tex->texel_format(),
+                                        builtin::Access::kReadWrite, tex->type()),
+                                    id);
                 return true;
             },
             [&](const type::Texture* tex) { return GenerateTextureType(tex, result); },
@@ -3698,10 +3699,11 @@ uint32_t Builder::GenerateTypeIfNeeded(const type::Type* type) {
                 // Register both of the sampler type names. In SPIR-V they're the same
                 // sampler type, so we need to match that when we do the dedup check.
                 if (s->kind() == type::SamplerKind::kSampler) {
-                    type_to_id_[builder_.create<type::Sampler>(
-                        type::SamplerKind::kComparisonSampler)] = id;
+                    type_to_id_.Replace(
+                        builder_.create<type::Sampler>(type::SamplerKind::kComparisonSampler), id);
                 } else {
-                    type_to_id_[builder_.create<type::Sampler>(type::SamplerKind::kSampler)] = id;
+                    type_to_id_.Replace(builder_.create<type::Sampler>(type::SamplerKind::kSampler),
+                                        id);
                 }
                 return true;
             },
@@ -4094,7 +4096,7 @@ SpvImageFormat Builder::convert_texel_format_to_spv(const builtin::TexelFormat f
     return SpvImageFormatUnknown;
 }
 
-bool Builder::push_function_inst(spv::Op op, const OperandList& operands) {
+bool Builder::push_function_inst(spv::Op op, OperandList operands) {
     if (!current_function_) {
         utils::StringStream ss;
         ss << "Internal error: trying to add SPIR-V instruction " << int(op)
@@ -4102,7 +4104,7 @@ bool Builder::push_function_inst(spv::Op op, const OperandList& operands) {
         TINT_ICE(Writer, builder_.Diagnostics()) << ss.str();
         return false;
     }
-    current_function_.push_inst(op, operands);
+    current_function_.push_inst(op, std::move(operands));
     return true;
 }
 
@@ -4144,10 +4146,12 @@ Builder::ContinuingInfo::ContinuingInfo(const ast::Statement* the_last_statement
 }
 
 Builder::Backedge::Backedge(spv::Op the_opcode, OperandList the_operands)
-    : opcode(the_opcode), operands(the_operands) {}
+    : opcode(the_opcode), operands(std::move(the_operands)) {}
 
 Builder::Backedge::Backedge(const Builder::Backedge& other) = default;
+Builder::Backedge::Backedge(Builder::Backedge&& other) noexcept = default;
 Builder::Backedge& Builder::Backedge::operator=(const Builder::Backedge& other) = default;
+Builder::Backedge& Builder::Backedge::operator=(Builder::Backedge&& other) noexcept = default;
 Builder::Backedge::~Backedge() = default;
 
 Builder::Scope::Scope() = default;
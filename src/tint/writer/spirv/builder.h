@@ -17,8 +17,8 @@
 
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "spirv/unified1/spirv.h"
@@ -39,6 +39,7 @@
 #include "src/tint/scope_stack.h"
 #include "src/tint/sem/builtin.h"
 #include "src/tint/type/storage_texture.h"
+#include "src/tint/utils/hashmap.h"
 #include "src/tint/writer/spirv/function.h"
 #include "src/tint/writer/spirv/module.h"
 #include "src/tint/writer/spirv/scalar_constant.h"
@@ -111,15 +112,15 @@ class Builder {
     /// @param op the operation
     /// @param operands the operands
     /// @returns true if we succeeded
-    bool push_function_inst(spv::Op op, const OperandList& operands);
+    bool push_function_inst(spv::Op op, OperandList operands);
     /// Pushes a variable to the current function
     /// @param operands the variable operands
-    void push_function_var(const OperandList& operands) {
+    void push_function_var(OperandList operands) {
         if (TINT_UNLIKELY(!current_function_)) {
             TINT_ICE(Writer, builder_.Diagnostics())
                 << "push_function_var() called without a function";
         }
-        current_function_.push_var(operands);
+        current_function_.push_var(std::move(operands));
     }
 
     /// @returns true if the current instruction insertion point is
@@ -519,19 +520,19 @@ class Builder {
         Scope();
         Scope(const Scope&);
         ~Scope();
-        std::unordered_map<OperandListKey, uint32_t> type_init_to_id_;
+        utils::Hashmap<OperandListKey, uint32_t, 8> type_init_to_id_;
     };
 
-    std::unordered_map<const sem::Variable*, uint32_t> var_to_id_;
-    std::unordered_map<uint32_t, const sem::Variable*> id_to_var_;
-    std::unordered_map<std::string, uint32_t> import_name_to_id_;
-    std::unordered_map<Symbol, uint32_t> func_symbol_to_id_;
-    std::unordered_map<sem::CallTargetSignature, uint32_t> func_sig_to_id_;
-    std::unordered_map<const type::Type*, uint32_t> type_to_id_;
-    std::unordered_map<ScalarConstant, uint32_t> const_to_id_;
-    std::unordered_map<const type::Type*, uint32_t> const_null_to_id_;
-    std::unordered_map<uint64_t, uint32_t> const_splat_to_id_;
-    std::unordered_map<const type::Type*, uint32_t> texture_type_to_sampled_image_type_id_;
+    utils::Hashmap<const sem::Variable*, uint32_t, 16> var_to_id_;
+    utils::Hashmap<uint32_t, const sem::Variable*, 16> id_to_var_;
+    utils::Hashmap<std::string, uint32_t, 4> import_name_to_id_;
+    utils::Hashmap<Symbol, uint32_t, 8> func_symbol_to_id_;
+    utils::Hashmap<sem::CallTargetSignature, uint32_t, 8> func_sig_to_id_;
+    utils::Hashmap<const type::Type*, uint32_t, 16> type_to_id_;
+    utils::Hashmap<ScalarConstant, uint32_t, 16> const_to_id_;
+    utils::Hashmap<const type::Type*, uint32_t, 4> const_null_to_id_;
+    utils::Hashmap<uint64_t, uint32_t, 4> const_splat_to_id_;
+    utils::Hashmap<const type::Type*, uint32_t, 4> texture_type_to_sampled_image_type_id_;
     std::vector<Scope> scope_stack_;
     std::vector<uint32_t> merge_stack_;
     std::vector<uint32_t> continue_stack_;
@@ -556,7 +557,9 @@ class Builder {
     struct Backedge {
         Backedge(spv::Op, OperandList);
         Backedge(const Backedge&);
+        Backedge(Backedge&&) noexcept;
         Backedge& operator=(const Backedge&);
+        Backedge& operator=(Backedge&&) noexcept;
         ~Backedge();
 
         spv::Op opcode;
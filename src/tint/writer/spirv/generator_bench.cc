@@ -26,15 +26,54 @@ void GenerateSPIRV(benchmark::State& state, std::string input_name) {
         return;
     }
     auto& program = std::get<bench::ProgramAndFile>(res).program;
+    size_t num_words = 0;
     for (auto _ : state) {
         auto res = Generate(&program, {});
         if (!res.error.empty()) {
             state.SkipWithError(res.error.c_str());
         }
+        num_words += res.spirv.size();
     }
+    state.counters["words"] =
+        benchmark::Counter(static_cast<double>(num_words), benchmark::Counter::kIsRate);
 }
 
 TINT_BENCHMARK_PROGRAMS(GenerateSPIRV);
 
+/// Generates SPIR-V for a synthetic shader with `state.range(0)` statements, each of which declares
+/// unique scalar and composite constants, and a composite initializer with runtime operands.
+void GenerateSPIRVManyConstants(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+
+    std::string wgsl = "@fragment fn main(@location(0) x : f32) -> @location(0) vec4<f32> {\n";
+    wgsl += "  var sum = vec4<f32>();\n";
+    for (size_t i = 0; i < count; i++) {
+        auto n = std::to_string(i);
+        wgsl += "  sum += vec4<f32>(x, " + n + ".5, x, 1.0);\n";
+        wgsl += "  sum += mat2x2<f32>(" + n + ".0, 1.0, 2.0, " + n + ".25)[0].xyxy;\n";
+        wgsl += "  sum += vec4<f32>(f32(" + n + "u));\n";
+    }
+    wgsl += "  return sum;\n";
+    wgsl += "}\n";
+
+    Source::File file("many-constants.wgsl", wgsl);
+    auto program = reader::wgsl::Parse(&file);
+    if (!program.IsValid()) {
+        state.SkipWithError(program.Diagnostics().str().c_str());
+        return;
+    }
+    for (auto _ : state) {
+        auto res = Generate(&program, {});
+        if (!res.error.empty()) {
+            state.SkipWithError(res.error.c_str());
+        }
+    }
+    state.counters["statements"] =
+        benchmark::Counter(static_cast<double>(state.iterations() * count * 3),
+                           benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(GenerateSPIRVManyConstants)->Arg(1000)->Arg(5000);
+
 }  // namespace
 }  // namespace tint::writer::spirv
@@ -14,6 +14,8 @@
 
 #include "src/tint/writer/spirv/generator_impl_ir.h"
 
+#include <utility>
+
 #include "spirv/unified1/spirv.h"
 #include "src/tint/ir/binary.h"
 #include "src/tint/ir/block.h"
@@ -171,7 +173,7 @@ void GeneratorImplIr::EmitFunction(const ir::Function* func) {
         OperandList operands = {func_ty_id, return_type_id};
         operands.insert(operands.end(), function_type.param_type_ids.begin(),
                         function_type.param_type_ids.end());
-        module_.PushType(spv::Op::OpTypeFunction, operands);
+        module_.PushType(spv::Op::OpTypeFunction, std::move(operands));
         return func_ty_id;
     });
 
@@ -183,14 +185,14 @@ void GeneratorImplIr::EmitFunction(const ir::Function* func) {
     // Create a function that we will add instructions to.
     // TODO(jrprice): Add the parameter declarations when they are supported in the IR.
     auto entry_block = module_.NextId();
-    current_function_ = Function(decl, entry_block, {});
+    current_function_ = Function(std::move(decl), entry_block, {});
     TINT_DEFER(current_function_ = Function());
 
     // Emit the body of the function.
     EmitBlock(func->start_target);
 
     // Add the function to the module.
-    module_.PushFunction(current_function_);
+    module_.PushFunction(std::move(current_function_));
 }
 
 void GeneratorImplIr::EmitEntryPoint(const ir::Function* func, uint32_t id) {
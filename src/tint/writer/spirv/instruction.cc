@@ -23,8 +23,12 @@ Instruction::Instruction(spv::Op op, OperandList operands)
 
 Instruction::Instruction(const Instruction&) = default;
 
+Instruction::Instruction(Instruction&&) noexcept = default;
+
 Instruction& Instruction::operator=(const Instruction&) = default;
 
+Instruction& Instruction::operator=(Instruction&&) noexcept = default;
+
 Instruction::~Instruction() = default;
 
 uint32_t Instruction::word_length() const {
@@ -15,6 +15,7 @@
 #include "src/tint/writer/spirv/instruction.h"
 
 #include <string>
+#include <utility>
 
 #include "gtest/gtest.h"
 
@@ -39,6 +40,24 @@ TEST_F(InstructionTest, Create) {
     EXPECT_EQ(std::get<std::string>(ops[2]), "my_str");
 }
 
+TEST_F(InstructionTest, Move) {
+    OperandList operands{Operand(1u), Operand("my_str")};
+    const auto* data = operands.data();
+
+    Instruction a(spv::Op::OpEntryPoint, std::move(operands));
+    Instruction b(std::move(a));
+    EXPECT_EQ(b.opcode(), spv::Op::OpEntryPoint);
+    ASSERT_EQ(b.operands().size(), 2u);
+    EXPECT_EQ(b.operands().data(), data);
+
+    Instruction c(spv::Op::OpNop, {});
+    c = std::move(b);
+    EXPECT_EQ(c.opcode(), spv::Op::OpEntryPoint);
+    ASSERT_EQ(c.operands().size(), 2u);
+    EXPECT_EQ(c.operands().data(), data);
+    EXPECT_EQ(std::get<std::string>(c.operands()[1]), "my_str");
+}
+
 TEST_F(InstructionTest, Length) {
     Instruction i(spv::Op::OpEntryPoint, {Operand(1.2f), Operand(1u), Operand("my_str")});
     EXPECT_EQ(i.word_length(), 5u);
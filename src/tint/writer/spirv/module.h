@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <functional>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "src/tint/writer/spirv/function.h"
@@ -68,8 +69,8 @@ class Module {
     /// Add an instruction to the list of imported extension instructions.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushExtImport(spv::Op op, const OperandList& operands) {
-        ext_imports_.push_back(Instruction{op, operands});
+    void PushExtImport(spv::Op op, OperandList operands) {
+        ext_imports_.push_back(Instruction{op, std::move(operands)});
     }
 
     /// @returns the ext imports
@@ -78,8 +79,8 @@ class Module {
     /// Add an instruction to the memory model.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushMemoryModel(spv::Op op, const OperandList& operands) {
-        memory_model_.push_back(Instruction{op, operands});
+    void PushMemoryModel(spv::Op op, OperandList operands) {
+        memory_model_.push_back(Instruction{op, std::move(operands)});
     }
 
     /// @returns the memory model
@@ -88,8 +89,8 @@ class Module {
     /// Add an instruction to the list pf entry points.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushEntryPoint(spv::Op op, const OperandList& operands) {
-        entry_points_.push_back(Instruction{op, operands});
+    void PushEntryPoint(spv::Op op, OperandList operands) {
+        entry_points_.push_back(Instruction{op, std::move(operands)});
     }
     /// @returns the entry points
     const InstructionList& EntryPoints() const { return entry_points_; }
@@ -97,8 +98,8 @@ class Module {
     /// Add an instruction to the execution mode declarations.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushExecutionMode(spv::Op op, const OperandList& operands) {
-        execution_modes_.push_back(Instruction{op, operands});
+    void PushExecutionMode(spv::Op op, OperandList operands) {
+        execution_modes_.push_back(Instruction{op, std::move(operands)});
     }
 
     /// @returns the execution modes
@@ -107,8 +108,8 @@ class Module {
     /// Add an instruction to the debug declarations.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushDebug(spv::Op op, const OperandList& operands) {
-        debug_.push_back(Instruction{op, operands});
+    void PushDebug(spv::Op op, OperandList operands) {
+        debug_.push_back(Instruction{op, std::move(operands)});
     }
 
     /// @returns the debug instructions
@@ -117,8 +118,8 @@ class Module {
     /// Add an instruction to the type declarations.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushType(spv::Op op, const OperandList& operands) {
-        types_.push_back(Instruction{op, operands});
+    void PushType(spv::Op op, OperandList operands) {
+        types_.push_back(Instruction{op, std::move(operands)});
     }
 
     /// @returns the type instructions
@@ -127,8 +128,8 @@ class Module {
     /// Add an instruction to the annotations.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushAnnot(spv::Op op, const OperandList& operands) {
-        annotations_.push_back(Instruction{op, operands});
+    void PushAnnot(spv::Op op, OperandList operands) {
+        annotations_.push_back(Instruction{op, std::move(operands)});
     }
 
     /// @returns the annotations
@@ -136,7 +137,7 @@ class Module {
 
     /// Add a function to the module.
     /// @param func the function to add
-    void PushFunction(const Function& func) { functions_.push_back(func); }
+    void PushFunction(Function func) { functions_.push_back(std::move(func)); }
 
     /// @returns the functions
     const std::vector<Function>& Functions() const { return functions_; }
@@ -15,6 +15,7 @@
 #include "src/tint/writer/text_generator.h"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 
 #include "src/tint/utils/map.h"
@@ -48,11 +49,12 @@ TextGenerator::LineWriter::LineWriter(LineWriter&& other) {
 
 TextGenerator::LineWriter::~LineWriter() {
     if (buffer) {
-        buffer->Append(os.str());
+        buffer->Append(os.view());
     }
 }
 
 TextGenerator::TextBuffer::TextBuffer() = default;
+TextGenerator::TextBuffer::TextBuffer(TextBuffer&&) = default;
 TextGenerator::TextBuffer::~TextBuffer() = default;
 
 void TextGenerator::TextBuffer::IncrementIndent() {
@@ -63,11 +65,11 @@ void TextGenerator::TextBuffer::DecrementIndent() {
     current_indent = std::max(2u, current_indent) - 2u;
 }
 
-void TextGenerator::TextBuffer::Append(const std::string& line) {
-    lines.emplace_back(Line{current_indent, line});
+void TextGenerator::TextBuffer::Append(std::string_view line) {
+    lines.emplace_back(Line{current_indent, Store(line)});
 }
 
-void TextGenerator::TextBuffer::Insert(const std::string& line, size_t before, uint32_t indent) {
+void TextGenerator::TextBuffer::Insert(std::string_view line, size_t before, uint32_t indent) {
     if (TINT_UNLIKELY(before >= lines.size())) {
         diag::List d;
         TINT_ICE(Writer, d) << "TextBuffer::Insert() called with before >= lines.size()\n"
@@ -76,13 +78,18 @@ void TextGenerator::TextBuffer::Insert(const std::string& line, size_t before, u
         return;
     }
     using DT = decltype(lines)::difference_type;
-    lines.insert(lines.begin() + static_cast<DT>(before), Line{indent, line});
+    lines.insert(lines.begin() + static_cast<DT>(before), Line{indent, Store(line)});
 }
 
 void TextGenerator::TextBuffer::Append(const TextBuffer& tb) {
+    size_t size = 0;
     for (auto& line : tb.lines) {
-        // TODO(bclayton): inefficient, consider optimizing
-        lines.emplace_back(Line{current_indent + line.indent, line.content});
+        size += line.content.size();
+    }
+    Reserve(size);
+    lines.reserve(lines.size() + tb.lines.size());
+    for (auto& line : tb.lines) {
+        lines.emplace_back(Line{current_indent + line.indent, Store(line.content)});
     }
 }
 
@@ -94,28 +101,64 @@ void TextGenerator::TextBuffer::Insert(const TextBuffer& tb, size_t before, uint
                             << "  lines.size(): " << lines.size();
         return;
     }
-    size_t idx = 0;
+    size_t size = 0;
+    for (auto& line : tb.lines) {
+        size += line.content.size();
+    }
+    Reserve(size);
+    // Open a gap for all the lines at once, instead of shifting the following lines per line.
+    using DT = decltype(lines)::difference_type;
+    auto gap = lines.insert(lines.begin() + static_cast<DT>(before), tb.lines.size(), Line{});
     for (auto& line : tb.lines) {
-        // TODO(bclayton): inefficient, consider optimizing
-        using DT = decltype(lines)::difference_type;
-        lines.insert(lines.begin() + static_cast<DT>(before + idx),
-                     Line{indent + line.indent, line.content});
-        idx++;
+        *gap++ = Line{indent + line.indent, Store(line.content)};
     }
 }
 
 std::string TextGenerator::TextBuffer::String(uint32_t indent /* = 0 */) const {
-    utils::StringStream ss;
+    size_t size = 0;
     for (auto& line : lines) {
         if (!line.content.empty()) {
-            for (uint32_t i = 0; i < indent + line.indent; i++) {
-                ss << " ";
-            }
-            ss << line.content;
+            size += indent + line.indent + line.content.size();
         }
-        ss << std::endl;
+        size++;
+    }
+
+    std::string str;
+    str.reserve(size);
+    for (auto& line : lines) {
+        if (!line.content.empty()) {
+            str.append(indent + line.indent, ' ');
+            str.append(line.content);
+        }
+        str.push_back('\n');
+    }
+    return str;
+}
+
+void TextGenerator::TextBuffer::Reserve(size_t size) {
+    if (chunk_remaining_ >= size) {
+        return;
+    }
+    // Double the chunk size with each chunk, up to 64KiB, as many buffers only hold a few lines.
+    constexpr size_t kMinChunkSize = 256;
+    constexpr size_t kMaxChunkShift = 8;
+    size_t chunk_size = kMinChunkSize << std::min<size_t>(chunks_.size(), kMaxChunkShift);
+    chunk_size = std::max(chunk_size, size);
+    chunks_.emplace_back(new char[chunk_size]);
+    chunk_next_ = chunks_.back().get();
+    chunk_remaining_ = chunk_size;
+}
+
+std::string_view TextGenerator::TextBuffer::Store(std::string_view text) {
+    if (text.empty()) {
+        return {};
     }
-    return ss.str();
+    Reserve(text.size());
+    std::memcpy(chunk_next_, text.data(), text.size());
+    std::string_view stored(chunk_next_, text.size());
+    chunk_next_ += text.size();
+    chunk_remaining_ -= text.size();
+    return stored;
 }
 
 TextGenerator::ScopedParen::ScopedParen(utils::StringStream& stream) : s(stream) {
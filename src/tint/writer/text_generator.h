@@ -15,7 +15,9 @@
 #ifndef SRC_TINT_WRITER_TEXT_GENERATOR_H_
 #define SRC_TINT_WRITER_TEXT_GENERATOR_H_
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -33,15 +35,22 @@ class TextGenerator {
     struct Line {
         /// The indentation of the line in blankspace
         uint32_t indent = 0;
-        /// The content of the line, without a trailing newline character
-        std::string content;
+        /// The content of the line, without a trailing newline character. The characters are owned
+        /// by the TextBuffer that holds the line.
+        std::string_view content;
     };
 
     /// TextBuffer holds a list of lines of text.
+    /// The content of the lines is stored in chunks of memory that are only ever appended to, so
+    /// inserting lines only moves the small Line records, and the text is only concatenated and
+    /// indented once, by String().
     struct TextBuffer {
         // Constructor
         TextBuffer();
 
+        // Move constructor
+        TextBuffer(TextBuffer&&);
+
         // Destructor
         ~TextBuffer();
 
@@ -55,13 +64,13 @@ class TextGenerator {
 
         /// Appends the line to the end of the TextBuffer
         /// @param line the line to append to the TextBuffer
-        void Append(const std::string& line);
+        void Append(std::string_view line);
 
         /// Inserts the line to the TextBuffer before the line with index `before`
         /// @param line the line to append to the TextBuffer
         /// @param before the zero-based index of the line to insert the text before
         /// @param indent the indentation to apply to the inserted lines
-        void Insert(const std::string& line, size_t before, uint32_t indent);
+        void Insert(std::string_view line, size_t before, uint32_t indent);
 
         /// Appends the lines of `tb` to the end of this TextBuffer
         /// @param tb the TextBuffer to append to the end of this TextBuffer
@@ -84,6 +93,26 @@ class TextGenerator {
 
         /// The lines
         std::vector<Line> lines;
+
+      private:
+        TextBuffer(const TextBuffer&) = delete;
+        TextBuffer& operator=(const TextBuffer&) = delete;
+
+        /// Ensures that the current chunk can hold at least `size` more characters
+        /// @param size the number of characters
+        void Reserve(size_t size);
+
+        /// Copies `text` to the chunks
+        /// @param text the text to copy
+        /// @returns a view of the copy of `text`
+        std::string_view Store(std::string_view text);
+
+        /// The chunks that hold the content of the lines
+        std::vector<std::unique_ptr<char[]>> chunks_;
+        /// The next free character of the current chunk
+        char* chunk_next_ = nullptr;
+        /// The number of free characters in the current chunk
+        size_t chunk_remaining_ = 0;
     };
 
     /// Constructor
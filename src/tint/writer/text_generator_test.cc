@@ -14,6 +14,8 @@
 
 #include "src/tint/writer/text_generator.h"
 
+#include <string>
+
 #include "gtest/gtest.h"
 
 namespace tint::writer {
@@ -42,5 +44,65 @@ TEST(TextGeneratorTest, UniqueIdentifier_ConflictWithExisting) {
     ASSERT_EQ(gen.UniqueIdentifier("ident"), "ident_5");
 }
 
+using TextBuffer = TextGenerator::TextBuffer;
+
+TEST(TextGeneratorTest, TextBuffer_Append) {
+    TextBuffer buffer;
+    buffer.Append("a");
+    buffer.IncrementIndent();
+    buffer.Append("b");
+    buffer.Append("");
+    buffer.DecrementIndent();
+    buffer.Append("c");
+    EXPECT_EQ(buffer.String(), "a\n  b\n\nc\n");
+    EXPECT_EQ(buffer.String(2), "  a\n    b\n\n  c\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_AppendBuffer) {
+    TextBuffer inner;
+    inner.Append("x");
+    inner.IncrementIndent();
+    inner.Append("y");
+
+    TextBuffer buffer;
+    buffer.Append("a");
+    buffer.IncrementIndent();
+    buffer.Append(inner);
+    EXPECT_EQ(buffer.String(), "a\n  x\n    y\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_Insert) {
+    TextBuffer buffer;
+    buffer.Append("a");
+    buffer.Append("c");
+    buffer.Insert("b", 1, 4);
+    EXPECT_EQ(buffer.String(), "a\n    b\nc\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_InsertBuffer) {
+    TextBuffer inner;
+    inner.Append("x");
+    inner.IncrementIndent();
+    inner.Append("y");
+
+    TextBuffer buffer;
+    buffer.Append("a");
+    buffer.Append("b");
+    buffer.Insert(inner, 1, 2);
+    EXPECT_EQ(buffer.String(), "a\n  x\n    y\nb\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_LongLines) {
+    // Lines longer than a chunk must survive later appends.
+    std::string long_line(100000, 'x');
+    TextBuffer buffer;
+    buffer.Append(long_line);
+    for (int i = 0; i < 1000; i++) {
+        buffer.Append("line");
+    }
+    EXPECT_EQ(buffer.lines[0].content, long_line);
+    EXPECT_EQ(buffer.lines[1000].content, "line");
+}
+
 }  // namespace
 }  // namespace tint::writer
@@ -0,0 +1,573 @@
+// Module-scope lookup tables built from vector and matrix expressions, to stress the constant
+// evaluation of composites.
+
+const scale = vec4<f32>(0.5, 0.25, 0.125, 0.0625);
+const bias = vec4<f32>(1.0, -1.0, 2.0, -2.0);
+const basis = mat4x4<f32>(
+  vec4<f32>(1.0, 0.0, 0.0, 0.0),
+  vec4<f32>(0.0, 0.5, 0.0, 0.0),
+  vec4<f32>(0.0, 0.0, 0.25, 0.0),
+  vec4<f32>(0.5, 0.5, 0.5, 1.0),
+);
+
+const lut = array<vec4<f32>, 256>(
+  (vec4<f32>(0.0, 1.625, 3.25, 4.875) * scale + bias) * vec4<f32>(0.0, 1.25, 2.5, 3.75) - scale,
+  (vec4<f32>(0.875, 2.5, 4.125, 5.75) * scale + bias) * vec4<f32>(0.75, 2.0, 3.25, 4.5) - scale,
+  (vec4<f32>(1.75, 3.375, 5.0, 6.625) * scale + bias) * vec4<f32>(1.5, 2.75, 4.0, 5.25) - scale,
+  (vec4<f32>(2.625, 4.25, 5.875, 7.5) * scale + bias) * vec4<f32>(2.25, 3.5, 4.75, 6.0) - scale,
+  (vec4<f32>(3.5, 5.125, 6.75, 8.375) * scale + bias) * vec4<f32>(3.0, 4.25, 5.5, 6.75) - scale,
+  (vec4<f32>(4.375, 6.0, 7.625, 9.25) * scale + bias) * vec4<f32>(3.75, 5.0, 6.25, 7.5) - scale,
+  (vec4<f32>(5.25, 6.875, 8.5, 10.125) * scale + bias) * vec4<f32>(4.5, 5.75, 7.0, 0.5) - scale,
+  (vec4<f32>(6.125, 7.75, 9.375, 11.0) * scale + bias) * vec4<f32>(5.25, 6.5, 0.0, 1.25) - scale,
+  (vec4<f32>(7.0, 8.625, 10.25, 11.875) * scale + bias) * vec4<f32>(6.0, 7.25, 0.75, 2.0) - scale,
+  (vec4<f32>(7.875, 9.5, 11.125, 0.625) * scale + bias) * vec4<f32>(6.75, 0.25, 1.5, 2.75) - scale,
+  (vec4<f32>(8.75, 10.375, 12.0, 1.5) * scale + bias) * vec4<f32>(7.5, 1.0, 2.25, 3.5) - scale,
+  (vec4<f32>(9.625, 11.25, 0.75, 2.375) * scale + bias) * vec4<f32>(0.5, 1.75, 3.0, 4.25) - scale,
+  (vec4<f32>(10.5, 0.0, 1.625, 3.25) * scale + bias) * vec4<f32>(1.25, 2.5, 3.75, 5.0) - scale,
+  (vec4<f32>(11.375, 0.875, 2.5, 4.125) * scale + bias) * vec4<f32>(2.0, 3.25, 4.5, 5.75) - scale,
+  (vec4<f32>(0.125, 1.75, 3.375, 5.0) * scale + bias) * vec4<f32>(2.75, 4.0, 5.25, 6.5) - scale,
+  (vec4<f32>(1.0, 2.625, 4.25, 5.875) * scale + bias) * vec4<f32>(3.5, 4.75, 6.0, 7.25) - scale,
+  (vec4<f32>(1.875, 3.5, 5.125, 6.75) * scale + bias) * vec4<f32>(4.25, 5.5, 6.75, 0.25) - scale,
+  (vec4<f32>(2.75, 4.375, 6.0, 7.625) * scale + bias) * vec4<f32>(5.0, 6.25, 7.5, 1.0) - scale,
+  (vec4<f32>(3.625, 5.25, 6.875, 8.5) * scale + bias) * vec4<f32>(5.75, 7.0, 0.5, 1.75) - scale,
+  (vec4<f32>(4.5, 6.125, 7.75, 9.375) * scale + bias) * vec4<f32>(6.5, 0.0, 1.25, 2.5) - scale,
+  (vec4<f32>(5.375, 7.0, 8.625, 10.25) * scale + bias) * vec4<f32>(7.25, 0.75, 2.0, 3.25) - scale,
+  (vec4<f32>(6.25, 7.875, 9.5, 11.125) * scale + bias) * vec4<f32>(0.25, 1.5, 2.75, 4.0) - scale,
+  (vec4<f32>(7.125, 8.75, 10.375, 12.0) * scale + bias) * vec4<f32>(1.0, 2.25, 3.5, 4.75) - scale,
+  (vec4<f32>(8.0, 9.625, 11.25, 0.75) * scale + bias) * vec4<f32>(1.75, 3.0, 4.25, 5.5) - scale,
+  (vec4<f32>(8.875, 10.5, 0.0, 1.625) * scale + bias) * vec4<f32>(2.5, 3.75, 5.0, 6.25) - scale,
+  (vec4<f32>(9.75, 11.375, 0.875, 2.5) * scale + bias) * vec4<f32>(3.25, 4.5, 5.75, 7.0) - scale,
+  (vec4<f32>(10.625, 0.125, 1.75, 3.375) * scale + bias) * vec4<f32>(4.0, 5.25, 6.5, 0.0) - scale,
+  (vec4<f32>(11.5, 1.0, 2.625, 4.25) * scale + bias) * vec4<f32>(4.75, 6.0, 7.25, 0.75) - scale,
+  (vec4<f32>(0.25, 1.875, 3.5, 5.125) * scale + bias) * vec4<f32>(5.5, 6.75, 0.25, 1.5) - scale,
+  (vec4<f32>(1.125, 2.75, 4.375, 6.0) * scale + bias) * vec4<f32>(6.25, 7.5, 1.0, 2.25) - scale,
+  (vec4<f32>(2.0, 3.625, 5.25, 6.875) * scale + bias) * vec4<f32>(7.0, 0.5, 1.75, 3.0) - scale,
+  (vec4<f32>(2.875, 4.5, 6.125, 7.75) * scale + bias) * vec4<f32>(0.0, 1.25, 2.5, 3.75) - scale,
+  (vec4<f32>(3.75, 5.375, 7.0, 8.625) * scale + bias) * vec4<f32>(0.75, 2.0, 3.25, 4.5) - scale,
+  (vec4<f32>(4.625, 6.25, 7.875, 9.5) * scale + bias) * vec4<f32>(1.5, 2.75, 4.0, 5.25) - scale,
+  (vec4<f32>(5.5, 7.125, 8.75, 10.375) * scale + bias) * vec4<f32>(2.25, 3.5, 4.75, 6.0) - scale,
+  (vec4<f32>(6.375, 8.0, 9.625, 11.25) * scale + bias) * vec4<f32>(3.0, 4.25, 5.5, 6.75) - scale,
+  (vec4<f32>(7.25, 8.875, 10.5, 0.0) * scale + bias) * vec4<f32>(3.75, 5.0, 6.25, 7.5) - scale,
+  (vec4<f32>(8.125, 9.75, 11.375, 0.875) * scale + bias) * vec4<f32>(4.5, 5.75, 7.0, 0.5) - scale,
+  (vec4<f32>(9.0, 10.625, 0.125, 1.75) * scale + bias) * vec4<f32>(5.25, 6.5, 0.0, 1.25) - scale,
+  (vec4<f32>(9.875, 11.5, 1.0, 2.625) * scale + bias) * vec4<f32>(6.0, 7.25, 0.75, 2.0) - scale,
+  (vec4<f32>(10.75, 0.25, 1.875, 3.5) * scale + bias) * vec4<f32>(6.75, 0.25, 1.5, 2.75) - scale,
+  (vec4<f32>(11.625, 1.125, 2.75, 4.375) * scale + bias) * vec4<f32>(7.5, 1.0, 2.25, 3.5) - scale,
+  (vec4<f32>(0.375, 2.0, 3.625, 5.25) * scale + bias) * vec4<f32>(0.5, 1.75, 3.0, 4.25) - scale,
+  (vec4<f32>(1.25, 2.875, 4.5, 6.125) * scale + bias) * vec4<f32>(1.25, 2.5, 3.75, 5.0) - scale,
+  (vec4<f32>(2.125, 3.75, 5.375, 7.0) * scale + bias) * vec4<f32>(2.0, 3.25, 4.5, 5.75) - scale,
+  (vec4<f32>(3.0, 4.625, 6.25, 7.875) * scale + bias) * vec4<f32>(2.75, 4.0, 5.25, 6.5) - scale,
+  (vec4<f32>(3.875, 5.5, 7.125, 8.75) * scale + bias) * vec4<f32>(3.5, 4.75, 6.0, 7.25) - scale,
+  (vec4<f32>(4.75, 6.375, 8.0, 9.625) * scale + bias) * vec4<f32>(4.25, 5.5, 6.75, 0.25) - scale,
+  (vec4<f32>(5.625, 7.25, 8.875, 10.5) * scale + bias) * vec4<f32>(5.0, 6.25, 7.5, 1.0) - scale,
+  (vec4<f32>(6.5, 8.125, 9.75, 11.375) * scale + bias) * vec4<f32>(5.75, 7.0, 0.5, 1.75) - scale,
+  (vec4<f32>(7.375, 9.0, 10.625, 0.125) * scale + bias) * vec4<f32>(6.5, 0.0, 1.25, 2.5) - scale,
+  (vec4<f32>(8.25, 9.875, 11.5, 1.0) * scale + bias) * vec4<f32>(7.25, 0.75, 2.0, 3.25) - scale,
+  (vec4<f32>(9.125, 10.75, 0.25, 1.875) * scale + bias) * vec4<f32>(0.25, 1.5, 2.75, 4.0) - scale,
+  (vec4<f32>(10.0, 11.625, 1.125, 2.75) * scale + bias) * vec4<f32>(1.0, 2.25, 3.5, 4.75) - scale,
+  (vec4<f32>(10.875, 0.375, 2.0, 3.625) * scale + bias) * vec4<f32>(1.75, 3.0, 4.25, 5.5) - scale,
+  (vec4<f32>(11.75, 1.25, 2.875, 4.5) * scale + bias) * vec4<f32>(2.5, 3.75, 5.0, 6.25) - scale,
+  (vec4<f32>(0.5, 2.125, 3.75, 5.375) * scale + bias) * vec4<f32>(3.25, 4.5, 5.75, 7.0) - scale,
+  (vec4<f32>(1.375, 3.0, 4.625, 6.25) * scale + bias) * vec4<f32>(4.0, 5.25, 6.5, 0.0) - scale,
+  (vec4<f32>(2.25, 3.875, 5.5, 7.125) * scale + bias) * vec4<f32>(4.75, 6.0, 7.25, 0.75) - scale,
+  (vec4<f32>(3.125, 4.75, 6.375, 8.0) * scale + bias) * vec4<f32>(5.5, 6.75, 0.25, 1.5) - scale,
+  (vec4<f32>(4.0, 5.625, 7.25, 8.875) * scale + bias) * vec4<f32>(6.25, 7.5, 1.0, 2.25) - scale,
+  (vec4<f32>(4.875, 6.5, 8.125, 9.75) * scale + bias) * vec4<f32>(7.0, 0.5, 1.75, 3.0) - scale,
+  (vec4<f32>(5.75, 7.375, 9.0, 10.625) * scale + bias) * vec4<f32>(0.0, 1.25, 2.5, 3.75) - scale,
+  (vec4<f32>(6.625, 8.25, 9.875, 11.5) * scale + bias) * vec4<f32>(0.75, 2.0, 3.25, 4.5) - scale,
+  (vec4<f32>(7.5, 9.125, 10.75, 0.25) * scale + bias) * vec4<f32>(1.5, 2.75, 4.0, 5.25) - scale,
+  (vec4<f32>(8.375, 10.0, 11.625, 1.125) * scale + bias) * vec4<f32>(2.25, 3.5, 4.75, 6.0) - scale,
+  (vec4<f32>(9.25, 10.875, 0.375, 2.0) * scale + bias) * vec4<f32>(3.0, 4.25, 5.5, 6.75) - scale,
+  (vec4<f32>(10.125, 11.75, 1.25, 2.875) * scale + bias) * vec4<f32>(3.75, 5.0, 6.25, 7.5) - scale,
+  (vec4<f32>(11.0, 0.5, 2.125, 3.75) * scale + bias) * vec4<f32>(4.5, 5.75, 7.0, 0.5) - scale,
+  (vec4<f32>(11.875, 1.375, 3.0, 4.625) * scale + bias) * vec4<f32>(5.25, 6.5, 0.0, 1.25) - scale,
+  (vec4<f32>(0.625, 2.25, 3.875, 5.5) * scale + bias) * vec4<f32>(6.0, 7.25, 0.75, 2.0) - scale,
+  (vec4<f32>(1.5, 3.125, 4.75, 6.375) * scale + bias) * vec4<f32>(6.75, 0.25, 1.5, 2.75) - scale,
+  (vec4<f32>(2.375, 4.0, 5.625, 7.25) * scale + bias) * vec4<f32>(7.5, 1.0, 2.25, 3.5) - scale,
+  (vec4<f32>(3.25, 4.875, 6.5, 8.125) * scale + bias) * vec4<f32>(0.5, 1.75, 3.0, 4.25) - scale,
+  (vec4<f32>(4.125, 5.75, 7.375, 9.0) * scale + bias) * vec4<f32>(1.25, 2.5, 3.75, 5.0) - scale,
+  (vec4<f32>(5.0, 6.625, 8.25, 9.875) * scale + bias) * vec4<f32>(2.0, 3.25, 4.5, 5.75) - scale,
+  (vec4<f32>(5.875, 7.5, 9.125, 10.75) * scale + bias) * vec4<f32>(2.75, 4.0, 5.25, 6.5) - scale,
+  (vec4<f32>(6.75, 8.375, 10.0, 11.625) * scale + bias) * vec4<f32>(3.5, 4.75, 6.0, 7.25) - scale,
+  (vec4<f32>(7.625, 9.25, 10.875, 0.375) * scale + bias) * vec4<f32>(4.25, 5.5, 6.75, 0.25) - scale,
+  (vec4<f32>(8.5, 10.125, 11.75, 1.25) * scale + bias) * vec4<f32>(5.0, 6.25, 7.5, 1.0) - scale,
+  (vec4<f32>(9.375, 11.0, 0.5, 2.125) * scale + bias) * vec4<f32>(5.75, 7.0, 0.5, 1.75) - scale,
+  (vec4<f32>(10.25, 11.875, 1.375, 3.0) * scale + bias) * vec4<f32>(6.5, 0.0, 1.25, 2.5) - scale,
+  (vec4<f32>(11.125, 0.625, 2.25, 3.875) * scale + bias) * vec4<f32>(7.25, 0.75, 2.0, 3.25) - scale,
+  (vec4<f32>(12.0, 1.5, 3.125, 4.75) * scale + bias) * vec4<f32>(0.25, 1.5, 2.75, 4.0) - scale,
+  (vec4<f32>(0.75, 2.375, 4.0, 5.625) * scale + bias) * vec4<f32>(1.0, 2.25, 3.5, 4.75) - scale,
+  (vec4<f32>(1.625, 3.25, 4.875, 6.5) * scale + bias) * vec4<f32>(1.75, 3.0, 4.25, 5.5) - scale,
+  (vec4<f32>(2.5, 4.125, 5.75, 7.375) * scale + bias) * vec4<f32>(2.5, 3.75, 5.0, 6.25) - scale,
+  (vec4<f32>(3.375, 5.0, 6.625, 8.25) * scale + bias) * vec4<f32>(3.25, 4.5, 5.75, 7.0) - scale,
+  (vec4<f32>(4.25, 5.875, 7.5, 9.125) * scale + bias) * vec4<f32>(4.0, 5.25, 6.5, 0.0) - scale,
+  (vec4<f32>(5.125, 6.75, 8.375, 10.0) * scale + bias) * vec4<f32>(4.75, 6.0, 7.25, 0.75) - scale,
+  (vec4<f32>(6.0, 7.625, 9.25, 10.875) * scale + bias) * vec4<f32>(5.5, 6.75, 0.25, 1.5) - scale,
+  (vec4<f32>(6.875, 8.5, 10.125, 11.75) * scale + bias) * vec4<f32>(6.25, 7.5, 1.0, 2.25) - scale,
+  (vec4<f32>(7.75, 9.375, 11.0, 0.5) * scale + bias) * vec4<f32>(7.0, 0.5, 1.75, 3.0) - scale,
+  (vec4<f32>(8.625, 10.25, 11.875, 1.375) * scale + bias) * vec4<f32>(0.0, 1.25, 2.5, 3.75) - scale,
+  (vec4<f32>(9.5, 11.125, 0.625, 2.25) * scale + bias) * vec4<f32>(0.75, 2.0, 3.25, 4.5) - scale,
+  (vec4<f32>(10.375, 12.0, 1.5, 3.125) * scale + bias) * vec4<f32>(1.5, 2.75, 4.0, 5.25) - scale,
+  (vec4<f32>(11.25, 0.75, 2.375, 4.0) * scale + bias) * vec4<f32>(2.25, 3.5, 4.75, 6.0) - scale,
+  (vec4<f32>(0.0, 1.625, 3.25, 4.875) * scale + bias) * vec4<f32>(3.0, 4.25, 5.5, 6.75) - scale,
+  (vec4<f32>(0.875, 2.5, 4.125, 5.75) * scale + bias) * vec4<f32>(3.75, 5.0, 6.25, 7.5) - scale,
+  (vec4<f32>(1.75, 3.375, 5.0, 6.625) * scale + bias) * vec4<f32>(4.5, 5.75, 7.0, 0.5) - scale,
+  (vec4<f32>(2.625, 4.25, 5.875, 7.5) * scale + bias) * vec4<f32>(5.25, 6.5, 0.0, 1.25) - scale,
+  (vec4<f32>(3.5, 5.125, 6.75, 8.375) * scale + bias) * vec4<f32>(6.0, 7.25, 0.75, 2.0) - scale,
+  (vec4<f32>(4.375, 6.0, 7.625, 9.25) * scale + bias) * vec4<f32>(6.75, 0.25, 1.5, 2.75) - scale,
+  (vec4<f32>(5.25, 6.875, 8.5, 10.125) * scale + bias) * vec4<f32>(7.5, 1.0, 2.25, 3.5) - scale,
+  (vec4<f32>(6.125, 7.75, 9.375, 11.0) * scale + bias) * vec4<f32>(0.5, 1.75, 3.0, 4.25) - scale,
+  (vec4<f32>(7.0, 8.625, 10.25, 11.875) * scale + bias) * vec4<f32>(1.25, 2.5, 3.75, 5.0) - scale,
+  (vec4<f32>(7.875, 9.5, 11.125, 0.625) * scale + bias) * vec4<f32>(2.0, 3.25, 4.5, 5.75) - scale,
+  (vec4<f32>(8.75, 10.375, 12.0, 1.5) * scale + bias) * vec4<f32>(2.75, 4.0, 5.25, 6.5) - scale,
+  (vec4<f32>(9.625, 11.25, 0.75, 2.375) * scale + bias) * vec4<f32>(3.5, 4.75, 6.0, 7.25) - scale,
+  (vec4<f32>(10.5, 0.0, 1.625, 3.25) * scale + bias) * vec4<f32>(4.25, 5.5, 6.75, 0.25) - scale,
+  (vec4<f32>(11.375, 0.875, 2.5, 4.125) * scale + bias) * vec4<f32>(5.0, 6.25, 7.5, 1.0) - scale,
+  (vec4<f32>(0.125, 1.75, 3.375, 5.0) * scale + bias) * vec4<f32>(5.75, 7.0, 0.5, 1.75) - scale,
+  (vec4<f32>(1.0, 2.625, 4.25, 5.875) * scale + bias) * vec4<f32>(6.5, 0.0, 1.25, 2.5) - scale,
+  (vec4<f32>(1.875, 3.5, 5.125, 6.75) * scale + bias) * vec4<f32>(7.25, 0.75, 2.0, 3.25) - scale,
+  (vec4<f32>(2.75, 4.375, 6.0, 7.625) * scale + bias) * vec4<f32>(0.25, 1.5, 2.75, 4.0) - scale,
+  (vec4<f32>(3.625, 5.25, 6.875, 8.5) * scale + bias) * vec4<f32>(1.0, 2.25, 3.5, 4.75) - scale,
+  (vec4<f32>(4.5, 6.125, 7.75, 9.375) * scale + bias) * vec4<f32>(1.75, 3.0, 4.25, 5.5) - scale,
+  (vec4<f32>(5.375, 7.0, 8.625, 10.25) * scale + bias) * vec4<f32>(2.5, 3.75, 5.0, 6.25) - scale,
+  (vec4<f32>(6.25, 7.875, 9.5, 11.125) * scale + bias) * vec4<f32>(3.25, 4.5, 5.75, 7.0) - scale,
+  (vec4<f32>(7.125, 8.75, 10.375, 12.0) * scale + bias) * vec4<f32>(4.0, 5.25, 6.5, 0.0) - scale,
+  (vec4<f32>(8.0, 9.625, 11.25, 0.75) * scale + bias) * vec4<f32>(4.75, 6.0, 7.25, 0.75) - scale,
+  (vec4<f32>(8.875, 10.5, 0.0, 1.625) * scale + bias) * vec4<f32>(5.5, 6.75, 0.25, 1.5) - scale,
+  (vec4<f32>(9.75, 11.375, 0.875, 2.5) * scale + bias) * vec4<f32>(6.25, 7.5, 1.0, 2.25) - scale,
+  (vec4<f32>(10.625, 0.125, 1.75, 3.375) * scale + bias) * vec4<f32>(7.0, 0.5, 1.75, 3.0) - scale,
+  (vec4<f32>(11.5, 1.0, 2.625, 4.25) * scale + bias) * vec4<f32>(0.0, 1.25, 2.5, 3.75) - scale,
+  (vec4<f32>(0.25, 1.875, 3.5, 5.125) * scale + bias) * vec4<f32>(0.75, 2.0, 3.25, 4.5) - scale,
+  (vec4<f32>(1.125, 2.75, 4.375, 6.0) * scale + bias) * vec4<f32>(1.5, 2.75, 4.0, 5.25) - scale,
+  (vec4<f32>(2.0, 3.625, 5.25, 6.875) * scale + bias) * vec4<f32>(2.25, 3.5, 4.75, 6.0) - scale,
+  (vec4<f32>(2.875, 4.5, 6.125, 7.75) * scale + bias) * vec4<f32>(3.0, 4.25, 5.5, 6.75) - scale,
+  (vec4<f32>(3.75, 5.375, 7.0, 8.625) * scale + bias) * vec4<f32>(3.75, 5.0, 6.25, 7.5) - scale,
+  (vec4<f32>(4.625, 6.25, 7.875, 9.5) * scale + bias) * vec4<f32>(4.5, 5.75, 7.0, 0.5) - scale,
+  (vec4<f32>(5.5, 7.125, 8.75, 10.375) * scale + bias) * vec4<f32>(5.25, 6.5, 0.0, 1.25) - scale,
+  (vec4<f32>(6.375, 8.0, 9.625, 11.25) * scale + bias) * vec4<f32>(6.0, 7.25, 0.75, 2.0) - scale,
+  (vec4<f32>(7.25, 8.875, 10.5, 0.0) * scale + bias) * vec4<f32>(6.75, 0.25, 1.5, 2.75) - scale,
+  (vec4<f32>(8.125, 9.75, 11.375, 0.875) * scale + bias) * vec4<f32>(7.5, 1.0, 2.25, 3.5) - scale,
+  (vec4<f32>(9.0, 10.625, 0.125, 1.75) * scale + bias) * vec4<f32>(0.5, 1.75, 3.0, 4.25) - scale,
+  (vec4<f32>(9.875, 11.5, 1.0, 2.625) * scale + bias) * vec4<f32>(1.25, 2.5, 3.75, 5.0) - scale,
+  (vec4<f32>(10.75, 0.25, 1.875, 3.5) * scale + bias) * vec4<f32>(2.0, 3.25, 4.5, 5.75) - scale,
+  (vec4<f32>(11.625, 1.125, 2.75, 4.375) * scale + bias) * vec4<f32>(2.75, 4.0, 5.25, 6.5) - scale,
+  (vec4<f32>(0.375, 2.0, 3.625, 5.25) * scale + bias) * vec4<f32>(3.5, 4.75, 6.0, 7.25) - scale,
+  (vec4<f32>(1.25, 2.875, 4.5, 6.125) * scale + bias) * vec4<f32>(4.25, 5.5, 6.75, 0.25) - scale,
+  (vec4<f32>(2.125, 3.75, 5.375, 7.0) * scale + bias) * vec4<f32>(5.0, 6.25, 7.5, 1.0) - scale,
+  (vec4<f32>(3.0, 4.625, 6.25, 7.875) * scale + bias) * vec4<f32>(5.75, 7.0, 0.5, 1.75) - scale,
+  (vec4<f32>(3.875, 5.5, 7.125, 8.75) * scale + bias) * vec4<f32>(6.5, 0.0, 1.25, 2.5) - scale,
+  (vec4<f32>(4.75, 6.375, 8.0, 9.625) * scale + bias) * vec4<f32>(7.25, 0.75, 2.0, 3.25) - scale,
+  (vec4<f32>(5.625, 7.25, 8.875, 10.5) * scale + bias) * vec4<f32>(0.25, 1.5, 2.75, 4.0) - scale,
+  (vec4<f32>(6.5, 8.125, 9.75, 11.375) * scale + bias) * vec4<f32>(1.0, 2.25, 3.5, 4.75) - scale,
+  (vec4<f32>(7.375, 9.0, 10.625, 0.125) * scale + bias) * vec4<f32>(1.75, 3.0, 4.25, 5.5) - scale,
+  (vec4<f32>(8.25, 9.875, 11.5, 1.0) * scale + bias) * vec4<f32>(2.5, 3.75, 5.0, 6.25) - scale,
+  (vec4<f32>(9.125, 10.75, 0.25, 1.875) * scale + bias) * vec4<f32>(3.25, 4.5, 5.75, 7.0) - scale,
+  (vec4<f32>(10.0, 11.625, 1.125, 2.75) * scale + bias) * vec4<f32>(4.0, 5.25, 6.5, 0.0) - scale,
+  (vec4<f32>(10.875, 0.375, 2.0, 3.625) * scale + bias) * vec4<f32>(4.75, 6.0, 7.25, 0.75) - scale,
+  (vec4<f32>(11.75, 1.25, 2.875, 4.5) * scale + bias) * vec4<f32>(5.5, 6.75, 0.25, 1.5) - scale,
+  (vec4<f32>(0.5, 2.125, 3.75, 5.375) * scale + bias) * vec4<f32>(6.25, 7.5, 1.0, 2.25) - scale,
+  (vec4<f32>(1.375, 3.0, 4.625, 6.25) * scale + bias) * vec4<f32>(7.0, 0.5, 1.75, 3.0) - scale,
+  (vec4<f32>(2.25, 3.875, 5.5, 7.125) * scale + bias) * vec4<f32>(0.0, 1.25, 2.5, 3.75) - scale,
+  (vec4<f32>(3.125, 4.75, 6.375, 8.0) * scale + bias) * vec4<f32>(0.75, 2.0, 3.25, 4.5) - scale,
+  (vec4<f32>(4.0, 5.625, 7.25, 8.875) * scale + bias) * vec4<f32>(1.5, 2.75, 4.0, 5.25) - scale,
+  (vec4<f32>(4.875, 6.5, 8.125, 9.75) * scale + bias) * vec4<f32>(2.25, 3.5, 4.75, 6.0) - scale,
+  (vec4<f32>(5.75, 7.375, 9.0, 10.625) * scale + bias) * vec4<f32>(3.0, 4.25, 5.5, 6.75) - scale,
+  (vec4<f32>(6.625, 8.25, 9.875, 11.5) * scale + bias) * vec4<f32>(3.75, 5.0, 6.25, 7.5) - scale,
+  (vec4<f32>(7.5, 9.125, 10.75, 0.25) * scale + bias) * vec4<f32>(4.5, 5.75, 7.0, 0.5) - scale,
+  (vec4<f32>(8.375, 10.0, 11.625, 1.125) * scale + bias) * vec4<f32>(5.25, 6.5, 0.0, 1.25) - scale,
+  (vec4<f32>(9.25, 10.875, 0.375, 2.0) * scale + bias) * vec4<f32>(6.0, 7.25, 0.75, 2.0) - scale,
+  (vec4<f32>(10.125, 11.75, 1.25, 2.875) * scale + bias) * vec4<f32>(6.75, 0.25, 1.5, 2.75) - scale,
+  (vec4<f32>(11.0, 0.5, 2.125, 3.75) * scale + bias) * vec4<f32>(7.5, 1.0, 2.25, 3.5) - scale,
+  (vec4<f32>(11.875, 1.375, 3.0, 4.625) * scale + bias) * vec4<f32>(0.5, 1.75, 3.0, 4.25) - scale,
+  (vec4<f32>(0.625, 2.25, 3.875, 5.5) * scale + bias) * vec4<f32>(1.25, 2.5, 3.75, 5.0) - scale,
+  (vec4<f32>(1.5, 3.125, 4.75, 6.375) * scale + bias) * vec4<f32>(2.0, 3.25, 4.5, 5.75) - scale,
+  (vec4<f32>(2.375, 4.0, 5.625, 7.25) * scale + bias) * vec4<f32>(2.75, 4.0, 5.25, 6.5) - scale,
+  (vec4<f32>(3.25, 4.875, 6.5, 8.125) * scale + bias) * vec4<f32>(3.5, 4.75, 6.0, 7.25) - scale,
+  (vec4<f32>(4.125, 5.75, 7.375, 9.0) * scale + bias) * vec4<f32>(4.25, 5.5, 6.75, 0.25) - scale,
+  (vec4<f32>(5.0, 6.625, 8.25, 9.875) * scale + bias) * vec4<f32>(5.0, 6.25, 7.5, 1.0) - scale,
+  (vec4<f32>(5.875, 7.5, 9.125, 10.75) * scale + bias) * vec4<f32>(5.75, 7.0, 0.5, 1.75) - scale,
+  (vec4<f32>(6.75, 8.375, 10.0, 11.625) * scale + bias) * vec4<f32>(6.5, 0.0, 1.25, 2.5) - scale,
+  (vec4<f32>(7.625, 9.25, 10.875, 0.375) * scale + bias) * vec4<f32>(7.25, 0.75, 2.0, 3.25) - scale,
+  (vec4<f32>(8.5, 10.125, 11.75, 1.25) * scale + bias) * vec4<f32>(0.25, 1.5, 2.75, 4.0) - scale,
+  (vec4<f32>(9.375, 11.0, 0.5, 2.125) * scale + bias) * vec4<f32>(1.0, 2.25, 3.5, 4.75) - scale,
+  (vec4<f32>(10.25, 11.875, 1.375, 3.0) * scale + bias) * vec4<f32>(1.75, 3.0, 4.25, 5.5) - scale,
+  (vec4<f32>(11.125, 0.625, 2.25, 3.875) * scale + bias) * vec4<f32>(2.5, 3.75, 5.0, 6.25) - scale,
+  (vec4<f32>(12.0, 1.5, 3.125, 4.75) * scale + bias) * vec4<f32>(3.25, 4.5, 5.75, 7.0) - scale,
+  (vec4<f32>(0.75, 2.375, 4.0, 5.625) * scale + bias) * vec4<f32>(4.0, 5.25, 6.5, 0.0) - scale,
+  (vec4<f32>(1.625, 3.25, 4.875, 6.5) * scale + bias) * vec4<f32>(4.75, 6.0, 7.25, 0.75) - scale,
+  (vec4<f32>(2.5, 4.125, 5.75, 7.375) * scale + bias) * vec4<f32>(5.5, 6.75, 0.25, 1.5) - scale,
+  (vec4<f32>(3.375, 5.0, 6.625, 8.25) * scale + bias) * vec4<f32>(6.25, 7.5, 1.0, 2.25) - scale,
+  (vec4<f32>(4.25, 5.875, 7.5, 9.125) * scale + bias) * vec4<f32>(7.0, 0.5, 1.75, 3.0) - scale,
+  (vec4<f32>(5.125, 6.75, 8.375, 10.0) * scale + bias) * vec4<f32>(0.0, 1.25, 2.5, 3.75) - scale,
+  (vec4<f32>(6.0, 7.625, 9.25, 10.875) * scale + bias) * vec4<f32>(0.75, 2.0, 3.25, 4.5) - scale,
+  (vec4<f32>(6.875, 8.5, 10.125, 11.75) * scale + bias) * vec4<f32>(1.5, 2.75, 4.0, 5.25) - scale,
+  (vec4<f32>(7.75, 9.375, 11.0, 0.5) * scale + bias) * vec4<f32>(2.25, 3.5, 4.75, 6.0) - scale,
+  (vec4<f32>(8.625, 10.25, 11.875, 1.375) * scale + bias) * vec4<f32>(3.0, 4.25, 5.5, 6.75) - scale,
+  (vec4<f32>(9.5, 11.125, 0.625, 2.25) * scale + bias) * vec4<f32>(3.75, 5.0, 6.25, 7.5) - scale,
+  (vec4<f32>(10.375, 12.0, 1.5, 3.125) * scale + bias) * vec4<f32>(4.5, 5.75, 7.0, 0.5) - scale,
+  (vec4<f32>(11.25, 0.75, 2.375, 4.0) * scale + bias) * vec4<f32>(5.25, 6.5, 0.0, 1.25) - scale,
+  (vec4<f32>(0.0, 1.625, 3.25, 4.875) * scale + bias) * vec4<f32>(6.0, 7.25, 0.75, 2.0) - scale,
+  (vec4<f32>(0.875, 2.5, 4.125, 5.75) * scale + bias) * vec4<f32>(6.75, 0.25, 1.5, 2.75) - scale,
+  (vec4<f32>(1.75, 3.375, 5.0, 6.625) * scale + bias) * vec4<f32>(7.5, 1.0, 2.25, 3.5) - scale,
+  (vec4<f32>(2.625, 4.25, 5.875, 7.5) * scale + bias) * vec4<f32>(0.5, 1.75, 3.0, 4.25) - scale,
+  (vec4<f32>(3.5, 5.125, 6.75, 8.375) * scale + bias) * vec4<f32>(1.25, 2.5, 3.75, 5.0) - scale,
+  (vec4<f32>(4.375, 6.0, 7.625, 9.25) * scale + bias) * vec4<f32>(2.0, 3.25, 4.5, 5.75) - scale,
+  (vec4<f32>(5.25, 6.875, 8.5, 10.125) * scale + bias) * vec4<f32>(2.75, 4.0, 5.25, 6.5) - scale,
+  (vec4<f32>(6.125, 7.75, 9.375, 11.0) * scale + bias) * vec4<f32>(3.5, 4.75, 6.0, 7.25) - scale,
+  (vec4<f32>(7.0, 8.625, 10.25, 11.875) * scale + bias) * vec4<f32>(4.25, 5.5, 6.75, 0.25) - scale,
+  (vec4<f32>(7.875, 9.5, 11.125, 0.625) * scale + bias) * vec4<f32>(5.0, 6.25, 7.5, 1.0) - scale,
+  (vec4<f32>(8.75, 10.375, 12.0, 1.5) * scale + bias) * vec4<f32>(5.75, 7.0, 0.5, 1.75) - scale,
+  (vec4<f32>(9.625, 11.25, 0.75, 2.375) * scale + bias) * vec4<f32>(6.5, 0.0, 1.25, 2.5) - scale,
+  (vec4<f32>(10.5, 0.0, 1.625, 3.25) * scale + bias) * vec4<f32>(7.25, 0.75, 2.0, 3.25) - scale,
+  (vec4<f32>(11.375, 0.875, 2.5, 4.125) * scale + bias) * vec4<f32>(0.25, 1.5, 2.75, 4.0) - scale,
+  (vec4<f32>(0.125, 1.75, 3.375, 5.0) * scale + bias) * vec4<f32>(1.0, 2.25, 3.5, 4.75) - scale,
+  (vec4<f32>(1.0, 2.625, 4.25, 5.875) * scale + bias) * vec4<f32>(1.75, 3.0, 4.25, 5.5) - scale,
+  (vec4<f32>(1.875, 3.5, 5.125, 6.75) * scale + bias) * vec4<f32>(2.5, 3.75, 5.0, 6.25) - scale,
+  (vec4<f32>(2.75, 4.375, 6.0, 7.625) * scale + bias) * vec4<f32>(3.25, 4.5, 5.75, 7.0) - scale,
+  (vec4<f32>(3.625, 5.25, 6.875, 8.5) * scale + bias) * vec4<f32>(4.0, 5.25, 6.5, 0.0) - scale,
+  (vec4<f32>(4.5, 6.125, 7.75, 9.375) * scale + bias) * vec4<f32>(4.75, 6.0, 7.25, 0.75) - scale,
+  (vec4<f32>(5.375, 7.0, 8.625, 10.25) * scale + bias) * vec4<f32>(5.5, 6.75, 0.25, 1.5) - scale,
+  (vec4<f32>(6.25, 7.875, 9.5, 11.125) * scale + bias) * vec4<f32>(6.25, 7.5, 1.0, 2.25) - scale,
+  (vec4<f32>(7.125, 8.75, 10.375, 12.0) * scale + bias) * vec4<f32>(7.0, 0.5, 1.75, 3.0) - scale,
+  (vec4<f32>(8.0, 9.625, 11.25, 0.75) * scale + bias) * vec4<f32>(0.0, 1.25, 2.5, 3.75) - scale,
+  (vec4<f32>(8.875, 10.5, 0.0, 1.625) * scale + bias) * vec4<f32>(0.75, 2.0, 3.25, 4.5) - scale,
+  (vec4<f32>(9.75, 11.375, 0.875, 2.5) * scale + bias) * vec4<f32>(1.5, 2.75, 4.0, 5.25) - scale,
+  (vec4<f32>(10.625, 0.125, 1.75, 3.375) * scale + bias) * vec4<f32>(2.25, 3.5, 4.75, 6.0) - scale,
+  (vec4<f32>(11.5, 1.0, 2.625, 4.25) * scale + bias) * vec4<f32>(3.0, 4.25, 5.5, 6.75) - scale,
+  (vec4<f32>(0.25, 1.875, 3.5, 5.125) * scale + bias) * vec4<f32>(3.75, 5.0, 6.25, 7.5) - scale,
+  (vec4<f32>(1.125, 2.75, 4.375, 6.0) * scale + bias) * vec4<f32>(4.5, 5.75, 7.0, 0.5) - scale,
+  (vec4<f32>(2.0, 3.625, 5.25, 6.875) * scale + bias) * vec4<f32>(5.25, 6.5, 0.0, 1.25) - scale,
+  (vec4<f32>(2.875, 4.5, 6.125, 7.75) * scale + bias) * vec4<f32>(6.0, 7.25, 0.75, 2.0) - scale,
+  (vec4<f32>(3.75, 5.375, 7.0, 8.625) * scale + bias) * vec4<f32>(6.75, 0.25, 1.5, 2.75) - scale,
+  (vec4<f32>(4.625, 6.25, 7.875, 9.5) * scale + bias) * vec4<f32>(7.5, 1.0, 2.25, 3.5) - scale,
+  (vec4<f32>(5.5, 7.125, 8.75, 10.375) * scale + bias) * vec4<f32>(0.5, 1.75, 3.0, 4.25) - scale,
+  (vec4<f32>(6.375, 8.0, 9.625, 11.25) * scale + bias) * vec4<f32>(1.25, 2.5, 3.75, 5.0) - scale,
+  (vec4<f32>(7.25, 8.875, 10.5, 0.0) * scale + bias) * vec4<f32>(2.0, 3.25, 4.5, 5.75) - scale,
+  (vec4<f32>(8.125, 9.75, 11.375, 0.875) * scale + bias) * vec4<f32>(2.75, 4.0, 5.25, 6.5) - scale,
+  (vec4<f32>(9.0, 10.625, 0.125, 1.75) * scale + bias) * vec4<f32>(3.5, 4.75, 6.0, 7.25) - scale,
+  (vec4<f32>(9.875, 11.5, 1.0, 2.625) * scale + bias) * vec4<f32>(4.25, 5.5, 6.75, 0.25) - scale,
+  (vec4<f32>(10.75, 0.25, 1.875, 3.5) * scale + bias) * vec4<f32>(5.0, 6.25, 7.5, 1.0) - scale,
+  (vec4<f32>(11.625, 1.125, 2.75, 4.375) * scale + bias) * vec4<f32>(5.75, 7.0, 0.5, 1.75) - scale,
+  (vec4<f32>(0.375, 2.0, 3.625, 5.25) * scale + bias) * vec4<f32>(6.5, 0.0, 1.25, 2.5) - scale,
+  (vec4<f32>(1.25, 2.875, 4.5, 6.125) * scale + bias) * vec4<f32>(7.25, 0.75, 2.0, 3.25) - scale,
+  (vec4<f32>(2.125, 3.75, 5.375, 7.0) * scale + bias) * vec4<f32>(0.25, 1.5, 2.75, 4.0) - scale,
+  (vec4<f32>(3.0, 4.625, 6.25, 7.875) * scale + bias) * vec4<f32>(1.0, 2.25, 3.5, 4.75) - scale,
+  (vec4<f32>(3.875, 5.5, 7.125, 8.75) * scale + bias) * vec4<f32>(1.75, 3.0, 4.25, 5.5) - scale,
+  (vec4<f32>(4.75, 6.375, 8.0, 9.625) * scale + bias) * vec4<f32>(2.5, 3.75, 5.0, 6.25) - scale,
+  (vec4<f32>(5.625, 7.25, 8.875, 10.5) * scale + bias) * vec4<f32>(3.25, 4.5, 5.75, 7.0) - scale,
+  (vec4<f32>(6.5, 8.125, 9.75, 11.375) * scale + bias) * vec4<f32>(4.0, 5.25, 6.5, 0.0) - scale,
+  (vec4<f32>(7.375, 9.0, 10.625, 0.125) * scale + bias) * vec4<f32>(4.75, 6.0, 7.25, 0.75) - scale,
+  (vec4<f32>(8.25, 9.875, 11.5, 1.0) * scale + bias) * vec4<f32>(5.5, 6.75, 0.25, 1.5) - scale,
+  (vec4<f32>(9.125, 10.75, 0.25, 1.875) * scale + bias) * vec4<f32>(6.25, 7.5, 1.0, 2.25) - scale,
+  (vec4<f32>(10.0, 11.625, 1.125, 2.75) * scale + bias) * vec4<f32>(7.0, 0.5, 1.75, 3.0) - scale,
+  (vec4<f32>(10.875, 0.375, 2.0, 3.625) * scale + bias) * vec4<f32>(0.0, 1.25, 2.5, 3.75) - scale,
+  (vec4<f32>(11.75, 1.25, 2.875, 4.5) * scale + bias) * vec4<f32>(0.75, 2.0, 3.25, 4.5) - scale,
+  (vec4<f32>(0.5, 2.125, 3.75, 5.375) * scale + bias) * vec4<f32>(1.5, 2.75, 4.0, 5.25) - scale,
+  (vec4<f32>(1.375, 3.0, 4.625, 6.25) * scale + bias) * vec4<f32>(2.25, 3.5, 4.75, 6.0) - scale,
+  (vec4<f32>(2.25, 3.875, 5.5, 7.125) * scale + bias) * vec4<f32>(3.0, 4.25, 5.5, 6.75) - scale,
+  (vec4<f32>(3.125, 4.75, 6.375, 8.0) * scale + bias) * vec4<f32>(3.75, 5.0, 6.25, 7.5) - scale,
+  (vec4<f32>(4.0, 5.625, 7.25, 8.875) * scale + bias) * vec4<f32>(4.5, 5.75, 7.0, 0.5) - scale,
+  (vec4<f32>(4.875, 6.5, 8.125, 9.75) * scale + bias) * vec4<f32>(5.25, 6.5, 0.0, 1.25) - scale,
+);
+
+const ilut = array<vec4<i32>, 256>(
+  vec4<i32>(-100, -83, -66, -49) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(0) - 0,
+  vec4<i32>(-89, -72, -55, -38) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(1) - 1,
+  vec4<i32>(-78, -61, -44, -27) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(2) - 2,
+  vec4<i32>(-67, -50, -33, -16) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(3) - 3,
+  vec4<i32>(-56, -39, -22, -5) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(4) - 4,
+  vec4<i32>(-45, -28, -11, 6) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(5) - 5,
+  vec4<i32>(-34, -17, 0, 17) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(6) - 6,
+  vec4<i32>(-23, -6, 11, 28) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(7) - 0,
+  vec4<i32>(-12, 5, 22, 39) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(8) - 1,
+  vec4<i32>(-1, 16, 33, 50) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(9) - 2,
+  vec4<i32>(10, 27, 44, 61) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(10) - 3,
+  vec4<i32>(21, 38, 55, 72) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(11) - 4,
+  vec4<i32>(32, 49, 66, 83) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(12) - 5,
+  vec4<i32>(43, 60, 77, 94) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(13) - 6,
+  vec4<i32>(54, 71, 88, 105) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(14) - 0,
+  vec4<i32>(65, 82, 99, -95) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(15) - 1,
+  vec4<i32>(76, 93, 110, -84) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(16) - 2,
+  vec4<i32>(87, 104, -90, -73) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(17) - 3,
+  vec4<i32>(98, -96, -79, -62) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(18) - 4,
+  vec4<i32>(109, -85, -68, -51) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(19) - 5,
+  vec4<i32>(-91, -74, -57, -40) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(20) - 6,
+  vec4<i32>(-80, -63, -46, -29) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(21) - 0,
+  vec4<i32>(-69, -52, -35, -18) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(22) - 1,
+  vec4<i32>(-58, -41, -24, -7) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(23) - 2,
+  vec4<i32>(-47, -30, -13, 4) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(24) - 3,
+  vec4<i32>(-36, -19, -2, 15) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(25) - 4,
+  vec4<i32>(-25, -8, 9, 26) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(26) - 5,
+  vec4<i32>(-14, 3, 20, 37) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(27) - 6,
+  vec4<i32>(-3, 14, 31, 48) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(28) - 0,
+  vec4<i32>(8, 25, 42, 59) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(29) - 1,
+  vec4<i32>(19, 36, 53, 70) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(30) - 2,
+  vec4<i32>(30, 47, 64, 81) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(31) - 3,
+  vec4<i32>(41, 58, 75, 92) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(32) - 4,
+  vec4<i32>(52, 69, 86, 103) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(33) - 5,
+  vec4<i32>(63, 80, 97, -97) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(34) - 6,
+  vec4<i32>(74, 91, 108, -86) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(35) - 0,
+  vec4<i32>(85, 102, -92, -75) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(36) - 1,
+  vec4<i32>(96, -98, -81, -64) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(37) - 2,
+  vec4<i32>(107, -87, -70, -53) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(38) - 3,
+  vec4<i32>(-93, -76, -59, -42) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(39) - 4,
+  vec4<i32>(-82, -65, -48, -31) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(40) - 5,
+  vec4<i32>(-71, -54, -37, -20) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(41) - 6,
+  vec4<i32>(-60, -43, -26, -9) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(42) - 0,
+  vec4<i32>(-49, -32, -15, 2) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(43) - 1,
+  vec4<i32>(-38, -21, -4, 13) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(44) - 2,
+  vec4<i32>(-27, -10, 7, 24) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(45) - 3,
+  vec4<i32>(-16, 1, 18, 35) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(46) - 4,
+  vec4<i32>(-5, 12, 29, 46) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(47) - 5,
+  vec4<i32>(6, 23, 40, 57) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(48) - 6,
+  vec4<i32>(17, 34, 51, 68) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(49) - 0,
+  vec4<i32>(28, 45, 62, 79) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(50) - 1,
+  vec4<i32>(39, 56, 73, 90) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(51) - 2,
+  vec4<i32>(50, 67, 84, 101) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(52) - 3,
+  vec4<i32>(61, 78, 95, -99) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(53) - 4,
+  vec4<i32>(72, 89, 106, -88) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(54) - 5,
+  vec4<i32>(83, 100, -94, -77) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(55) - 6,
+  vec4<i32>(94, -100, -83, -66) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(56) - 0,
+  vec4<i32>(105, -89, -72, -55) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(57) - 1,
+  vec4<i32>(-95, -78, -61, -44) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(58) - 2,
+  vec4<i32>(-84, -67, -50, -33) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(59) - 3,
+  vec4<i32>(-73, -56, -39, -22) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(60) - 4,
+  vec4<i32>(-62, -45, -28, -11) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(61) - 5,
+  vec4<i32>(-51, -34, -17, 0) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(62) - 6,
+  vec4<i32>(-40, -23, -6, 11) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(63) - 0,
+  vec4<i32>(-29, -12, 5, 22) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(64) - 1,
+  vec4<i32>(-18, -1, 16, 33) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(65) - 2,
+  vec4<i32>(-7, 10, 27, 44) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(66) - 3,
+  vec4<i32>(4, 21, 38, 55) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(67) - 4,
+  vec4<i32>(15, 32, 49, 66) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(68) - 5,
+  vec4<i32>(26, 43, 60, 77) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(69) - 6,
+  vec4<i32>(37, 54, 71, 88) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(70) - 0,
+  vec4<i32>(48, 65, 82, 99) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(71) - 1,
+  vec4<i32>(59, 76, 93, 110) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(72) - 2,
+  vec4<i32>(70, 87, 104, -90) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(73) - 3,
+  vec4<i32>(81, 98, -96, -79) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(74) - 4,
+  vec4<i32>(92, 109, -85, -68) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(75) - 5,
+  vec4<i32>(103, -91, -74, -57) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(76) - 6,
+  vec4<i32>(-97, -80, -63, -46) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(77) - 0,
+  vec4<i32>(-86, -69, -52, -35) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(78) - 1,
+  vec4<i32>(-75, -58, -41, -24) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(79) - 2,
+  vec4<i32>(-64, -47, -30, -13) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(80) - 3,
+  vec4<i32>(-53, -36, -19, -2) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(81) - 4,
+  vec4<i32>(-42, -25, -8, 9) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(82) - 5,
+  vec4<i32>(-31, -14, 3, 20) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(83) - 6,
+  vec4<i32>(-20, -3, 14, 31) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(84) - 0,
+  vec4<i32>(-9, 8, 25, 42) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(85) - 1,
+  vec4<i32>(2, 19, 36, 53) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(86) - 2,
+  vec4<i32>(13, 30, 47, 64) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(87) - 3,
+  vec4<i32>(24, 41, 58, 75) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(88) - 4,
+  vec4<i32>(35, 52, 69, 86) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(89) - 5,
+  vec4<i32>(46, 63, 80, 97) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(90) - 6,
+  vec4<i32>(57, 74, 91, 108) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(91) - 0,
+  vec4<i32>(68, 85, 102, -92) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(92) - 1,
+  vec4<i32>(79, 96, -98, -81) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(93) - 2,
+  vec4<i32>(90, 107, -87, -70) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(94) - 3,
+  vec4<i32>(101, -93, -76, -59) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(95) - 4,
+  vec4<i32>(-99, -82, -65, -48) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(96) - 5,
+  vec4<i32>(-88, -71, -54, -37) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(97) - 6,
+  vec4<i32>(-77, -60, -43, -26) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(98) - 0,
+  vec4<i32>(-66, -49, -32, -15) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(99) - 1,
+  vec4<i32>(-55, -38, -21, -4) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(100) - 2,
+  vec4<i32>(-44, -27, -10, 7) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(101) - 3,
+  vec4<i32>(-33, -16, 1, 18) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(102) - 4,
+  vec4<i32>(-22, -5, 12, 29) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(103) - 5,
+  vec4<i32>(-11, 6, 23, 40) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(104) - 6,
+  vec4<i32>(0, 17, 34, 51) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(105) - 0,
+  vec4<i32>(11, 28, 45, 62) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(106) - 1,
+  vec4<i32>(22, 39, 56, 73) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(107) - 2,
+  vec4<i32>(33, 50, 67, 84) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(108) - 3,
+  vec4<i32>(44, 61, 78, 95) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(109) - 4,
+  vec4<i32>(55, 72, 89, 106) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(110) - 5,
+  vec4<i32>(66, 83, 100, -94) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(111) - 6,
+  vec4<i32>(77, 94, -100, -83) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(112) - 0,
+  vec4<i32>(88, 105, -89, -72) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(113) - 1,
+  vec4<i32>(99, -95, -78, -61) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(114) - 2,
+  vec4<i32>(110, -84, -67, -50) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(115) - 3,
+  vec4<i32>(-90, -73, -56, -39) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(116) - 4,
+  vec4<i32>(-79, -62, -45, -28) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(117) - 5,
+  vec4<i32>(-68, -51, -34, -17) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(118) - 6,
+  vec4<i32>(-57, -40, -23, -6) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(119) - 0,
+  vec4<i32>(-46, -29, -12, 5) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(120) - 1,
+  vec4<i32>(-35, -18, -1, 16) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(121) - 2,
+  vec4<i32>(-24, -7, 10, 27) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(122) - 3,
+  vec4<i32>(-13, 4, 21, 38) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(123) - 4,
+  vec4<i32>(-2, 15, 32, 49) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(124) - 5,
+  vec4<i32>(9, 26, 43, 60) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(125) - 6,
+  vec4<i32>(20, 37, 54, 71) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(126) - 0,
+  vec4<i32>(31, 48, 65, 82) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(127) - 1,
+  vec4<i32>(42, 59, 76, 93) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(128) - 2,
+  vec4<i32>(53, 70, 87, 104) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(129) - 3,
+  vec4<i32>(64, 81, 98, -96) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(130) - 4,
+  vec4<i32>(75, 92, 109, -85) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(131) - 5,
+  vec4<i32>(86, 103, -91, -74) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(132) - 6,
+  vec4<i32>(97, -97, -80, -63) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(133) - 0,
+  vec4<i32>(108, -86, -69, -52) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(134) - 1,
+  vec4<i32>(-92, -75, -58, -41) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(135) - 2,
+  vec4<i32>(-81, -64, -47, -30) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(136) - 3,
+  vec4<i32>(-70, -53, -36, -19) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(137) - 4,
+  vec4<i32>(-59, -42, -25, -8) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(138) - 5,
+  vec4<i32>(-48, -31, -14, 3) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(139) - 6,
+  vec4<i32>(-37, -20, -3, 14) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(140) - 0,
+  vec4<i32>(-26, -9, 8, 25) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(141) - 1,
+  vec4<i32>(-15, 2, 19, 36) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(142) - 2,
+  vec4<i32>(-4, 13, 30, 47) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(143) - 3,
+  vec4<i32>(7, 24, 41, 58) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(144) - 4,
+  vec4<i32>(18, 35, 52, 69) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(145) - 5,
+  vec4<i32>(29, 46, 63, 80) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(146) - 6,
+  vec4<i32>(40, 57, 74, 91) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(147) - 0,
+  vec4<i32>(51, 68, 85, 102) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(148) - 1,
+  vec4<i32>(62, 79, 96, -98) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(149) - 2,
+  vec4<i32>(73, 90, 107, -87) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(150) - 3,
+  vec4<i32>(84, 101, -93, -76) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(151) - 4,
+  vec4<i32>(95, -99, -82, -65) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(152) - 5,
+  vec4<i32>(106, -88, -71, -54) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(153) - 6,
+  vec4<i32>(-94, -77, -60, -43) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(154) - 0,
+  vec4<i32>(-83, -66, -49, -32) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(155) - 1,
+  vec4<i32>(-72, -55, -38, -21) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(156) - 2,
+  vec4<i32>(-61, -44, -27, -10) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(157) - 3,
+  vec4<i32>(-50, -33, -16, 1) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(158) - 4,
+  vec4<i32>(-39, -22, -5, 12) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(159) - 5,
+  vec4<i32>(-28, -11, 6, 23) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(160) - 6,
+  vec4<i32>(-17, 0, 17, 34) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(161) - 0,
+  vec4<i32>(-6, 11, 28, 45) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(162) - 1,
+  vec4<i32>(5, 22, 39, 56) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(163) - 2,
+  vec4<i32>(16, 33, 50, 67) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(164) - 3,
+  vec4<i32>(27, 44, 61, 78) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(165) - 4,
+  vec4<i32>(38, 55, 72, 89) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(166) - 5,
+  vec4<i32>(49, 66, 83, 100) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(167) - 6,
+  vec4<i32>(60, 77, 94, -100) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(168) - 0,
+  vec4<i32>(71, 88, 105, -89) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(169) - 1,
+  vec4<i32>(82, 99, -95, -78) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(170) - 2,
+  vec4<i32>(93, 110, -84, -67) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(171) - 3,
+  vec4<i32>(104, -90, -73, -56) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(172) - 4,
+  vec4<i32>(-96, -79, -62, -45) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(173) - 5,
+  vec4<i32>(-85, -68, -51, -34) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(174) - 6,
+  vec4<i32>(-74, -57, -40, -23) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(175) - 0,
+  vec4<i32>(-63, -46, -29, -12) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(176) - 1,
+  vec4<i32>(-52, -35, -18, -1) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(177) - 2,
+  vec4<i32>(-41, -24, -7, 10) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(178) - 3,
+  vec4<i32>(-30, -13, 4, 21) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(179) - 4,
+  vec4<i32>(-19, -2, 15, 32) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(180) - 5,
+  vec4<i32>(-8, 9, 26, 43) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(181) - 6,
+  vec4<i32>(3, 20, 37, 54) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(182) - 0,
+  vec4<i32>(14, 31, 48, 65) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(183) - 1,
+  vec4<i32>(25, 42, 59, 76) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(184) - 2,
+  vec4<i32>(36, 53, 70, 87) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(185) - 3,
+  vec4<i32>(47, 64, 81, 98) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(186) - 4,
+  vec4<i32>(58, 75, 92, 109) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(187) - 5,
+  vec4<i32>(69, 86, 103, -91) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(188) - 6,
+  vec4<i32>(80, 97, -97, -80) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(189) - 0,
+  vec4<i32>(91, 108, -86, -69) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(190) - 1,
+  vec4<i32>(102, -92, -75, -58) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(191) - 2,
+  vec4<i32>(-98, -81, -64, -47) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(192) - 3,
+  vec4<i32>(-87, -70, -53, -36) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(193) - 4,
+  vec4<i32>(-76, -59, -42, -25) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(194) - 5,
+  vec4<i32>(-65, -48, -31, -14) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(195) - 6,
+  vec4<i32>(-54, -37, -20, -3) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(196) - 0,
+  vec4<i32>(-43, -26, -9, 8) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(197) - 1,
+  vec4<i32>(-32, -15, 2, 19) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(198) - 2,
+  vec4<i32>(-21, -4, 13, 30) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(199) - 3,
+  vec4<i32>(-10, 7, 24, 41) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(200) - 4,
+  vec4<i32>(1, 18, 35, 52) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(201) - 5,
+  vec4<i32>(12, 29, 46, 63) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(202) - 6,
+  vec4<i32>(23, 40, 57, 74) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(203) - 0,
+  vec4<i32>(34, 51, 68, 85) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(204) - 1,
+  vec4<i32>(45, 62, 79, 96) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(205) - 2,
+  vec4<i32>(56, 73, 90, 107) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(206) - 3,
+  vec4<i32>(67, 84, 101, -93) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(207) - 4,
+  vec4<i32>(78, 95, -99, -82) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(208) - 5,
+  vec4<i32>(89, 106, -88, -71) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(209) - 6,
+  vec4<i32>(100, -94, -77, -60) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(210) - 0,
+  vec4<i32>(-100, -83, -66, -49) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(211) - 1,
+  vec4<i32>(-89, -72, -55, -38) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(212) - 2,
+  vec4<i32>(-78, -61, -44, -27) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(213) - 3,
+  vec4<i32>(-67, -50, -33, -16) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(214) - 4,
+  vec4<i32>(-56, -39, -22, -5) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(215) - 5,
+  vec4<i32>(-45, -28, -11, 6) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(216) - 6,
+  vec4<i32>(-34, -17, 0, 17) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(217) - 0,
+  vec4<i32>(-23, -6, 11, 28) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(218) - 1,
+  vec4<i32>(-12, 5, 22, 39) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(219) - 2,
+  vec4<i32>(-1, 16, 33, 50) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(220) - 3,
+  vec4<i32>(10, 27, 44, 61) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(221) - 4,
+  vec4<i32>(21, 38, 55, 72) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(222) - 5,
+  vec4<i32>(32, 49, 66, 83) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(223) - 6,
+  vec4<i32>(43, 60, 77, 94) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(224) - 0,
+  vec4<i32>(54, 71, 88, 105) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(225) - 1,
+  vec4<i32>(65, 82, 99, -95) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(226) - 2,
+  vec4<i32>(76, 93, 110, -84) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(227) - 3,
+  vec4<i32>(87, 104, -90, -73) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(228) - 4,
+  vec4<i32>(98, -96, -79, -62) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(229) - 5,
+  vec4<i32>(109, -85, -68, -51) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(230) - 6,
+  vec4<i32>(-91, -74, -57, -40) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(231) - 0,
+  vec4<i32>(-80, -63, -46, -29) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(232) - 1,
+  vec4<i32>(-69, -52, -35, -18) * vec4<i32>(4, 7, 10, -10) + vec4<i32>(233) - 2,
+  vec4<i32>(-58, -41, -24, -7) * vec4<i32>(9, -11, -8, -5) + vec4<i32>(234) - 3,
+  vec4<i32>(-47, -30, -13, 4) * vec4<i32>(-9, -6, -3, 0) + vec4<i32>(235) - 4,
+  vec4<i32>(-36, -19, -2, 15) * vec4<i32>(-4, -1, 2, 5) + vec4<i32>(236) - 5,
+  vec4<i32>(-25, -8, 9, 26) * vec4<i32>(1, 4, 7, 10) + vec4<i32>(237) - 6,
+  vec4<i32>(-14, 3, 20, 37) * vec4<i32>(6, 9, -11, -8) + vec4<i32>(238) - 0,
+  vec4<i32>(-3, 14, 31, 48) * vec4<i32>(11, -9, -6, -3) + vec4<i32>(239) - 1,
+  vec4<i32>(8, 25, 42, 59) * vec4<i32>(-7, -4, -1, 2) + vec4<i32>(240) - 2,
+  vec4<i32>(19, 36, 53, 70) * vec4<i32>(-2, 1, 4, 7) + vec4<i32>(241) - 3,
+  vec4<i32>(30, 47, 64, 81) * vec4<i32>(3, 6, 9, -11) + vec4<i32>(242) - 4,
+  vec4<i32>(41, 58, 75, 92) * vec4<i32>(8, 11, -9, -6) + vec4<i32>(243) - 5,
+  vec4<i32>(52, 69, 86, 103) * vec4<i32>(-10, -7, -4, -1) + vec4<i32>(244) - 6,
+  vec4<i32>(63, 80, 97, -97) * vec4<i32>(-5, -2, 1, 4) + vec4<i32>(245) - 0,
+  vec4<i32>(74, 91, 108, -86) * vec4<i32>(0, 3, 6, 9) + vec4<i32>(246) - 1,
+  vec4<i32>(85, 102, -92, -75) * vec4<i32>(5, 8, 11, -9) + vec4<i32>(247) - 2,
+  vec4<i32>(96, -98, -81, -64) * vec4<i32>(10, -10, -7, -4) + vec4<i32>(248) - 3,
+  vec4<i32>(107, -87, -70, -53) * vec4<i32>(-8, -5, -2, 1) + vec4<i32>(249) - 4,
+  vec4<i32>(-93, -76, -59, -42) * vec4<i32>(-3, 0, 3, 6) + vec4<i32>(250) - 5,
+  vec4<i32>(-82, -65, -48, -31) * vec4<i32>(2, 5, 8, 11) + vec4<i32>(251) - 6,
+  vec4<i32>(-71, -54, -37, -20) * vec4<i32>(7, 10, -10, -7) + vec4<i32>(252) - 0,
+  vec4<i32>(-60, -43, -26, -9) * vec4<i32>(-11, -8, -5, -2) + vec4<i32>(253) - 1,
+  vec4<i32>(-49, -32, -15, 2) * vec4<i32>(-6, -3, 0, 3) + vec4<i32>(254) - 2,
+  vec4<i32>(-38, -21, -4, 13) * vec4<i32>(-1, 2, 5, 8) + vec4<i32>(255) - 3,
+);
+
+const mats = array<mat4x4<f32>, 32>(
+  basis * 1.0 + basis * 0.5 - basis,
+  basis * 1.0625 + basis * 0.75 - basis,
+  basis * 1.125 + basis * 1.0 - basis,
+  basis * 1.1875 + basis * 1.25 - basis,
+  basis * 1.25 + basis * 1.5 - basis,
+  basis * 1.3125 + basis * 0.5 - basis,
+  basis * 1.375 + basis * 0.75 - basis,
+  basis * 1.4375 + basis * 1.0 - basis,
+  basis * 1.5 + basis * 1.25 - basis,
+  basis * 1.5625 + basis * 1.5 - basis,
+  basis * 1.625 + basis * 0.5 - basis,
+  basis * 1.6875 + basis * 0.75 - basis,
+  basis * 1.75 + basis * 1.0 - basis,
+  basis * 1.8125 + basis * 1.25 - basis,
+  basis * 1.875 + basis * 1.5 - basis,
+  basis * 1.9375 + basis * 0.5 - basis,
+  basis * 2.0 + basis * 0.75 - basis,
+  basis * 2.0625 + basis * 1.0 - basis,
+  basis * 2.125 + basis * 1.25 - basis,
+  basis * 2.1875 + basis * 1.5 - basis,
+  basis * 2.25 + basis * 0.5 - basis,
+  basis * 2.3125 + basis * 0.75 - basis,
+  basis * 2.375 + basis * 1.0 - basis,
+  basis * 2.4375 + basis * 1.25 - basis,
+  basis * 2.5 + basis * 1.5 - basis,
+  basis * 2.5625 + basis * 0.5 - basis,
+  basis * 2.625 + basis * 0.75 - basis,
+  basis * 2.6875 + basis * 1.0 - basis,
+  basis * 2.75 + basis * 1.25 - basis,
+  basis * 2.8125 + basis * 1.5 - basis,
+  basis * 2.875 + basis * 0.5 - basis,
+  basis * 2.9375 + basis * 0.75 - basis,
+);
+
+@group(0) @binding(0) var<storage, read_write> outputs : array<vec4<f32>>;
+
+@compute @workgroup_size(64)
+fn main(@builtin(global_invocation_id) id : vec3<u32>) {
+  let i = id.x;
+  let v = lut[i % 256u] + vec4<f32>(ilut[(i + 1u) % 256u]);
+  outputs[i] = mats[i % 32u] * v;
+}